@@ -0,0 +1,144 @@
+/*
+   RadioLib AX.25 Connected Mode Example
+
+   This example connects to another AX.25 station
+   and sends text over the link. Frames that are
+   lost are sent again until acknowledged, and up
+   to 4 frames can be sent before waiting for
+   acknowledgement.
+
+   Frames are received the same way as in
+   AX25_Receive example, so 9600 baud G3RUH
+   scrambled 2-FSK is used here.
+
+   Other modules that can be used for AX.25
+   connected mode:
+    - SX127x/RFM9x
+    - RF69
+    - SX1231
+    - CC1101
+    - Si443x/RFM2x
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// SX1278 has the following connections:
+// NSS pin:   10
+// DIO0 pin:  2
+// RESET pin: 9
+// DIO1 pin:  3
+SX1278 radio = new Module(10, 2, 9, 3);
+
+// DIO2 pin:  5
+const int pin = 5;
+
+// create AX.25 client instance using the FSK module
+AX25Client ax25(&radio);
+
+// this function is called when data is received over the link
+void printData(uint8_t* data, size_t len) {
+  Serial.print(F("[AX.25] Received: "));
+  for(size_t i = 0; i < len; i++) {
+    Serial.print((char)data[i]);
+  }
+  Serial.println();
+}
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize SX1278
+  Serial.print(F("[SX1278] Initializing ... "));
+  // carrier frequency:           434.0 MHz
+  // bit rate:                    9.6 kbps (9600 baud G3RUH AX.25)
+  // frequency deviation:         3.0 kHz
+  int state = radio.beginFSK(434.0, 9.6, 3.0);
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // initialize AX.25 client
+  Serial.print(F("[AX.25] Initializing ... "));
+  state = ax25.begin("N7LEM");
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // set the function that will be called
+  // when data is received over the link
+  ax25.setLinkDataAction(printData);
+
+  // start listening, G3RUH descrambler enabled
+  Serial.print(F("[AX.25] Starting to listen ... "));
+  state = ax25.startReceive(pin, true);
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // connect to the remote station
+  // NOTE: ax25.update() must be called periodically
+  //       for the connection to be established
+  Serial.print(F("[AX.25] Connecting ... "));
+  ax25.connect("NJ7P");
+  while(ax25.getLinkState() == RADIOLIB_AX25_LINK_AWAITING_CONNECTION) {
+    ax25.update();
+  }
+  if(ax25.getLinkState() == RADIOLIB_AX25_LINK_CONNECTED) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.println(F("failed!"));
+    while(true);
+  }
+}
+
+// counter to keep track of sent messages
+int count = 0;
+
+void loop() {
+  // process received frames, send queued data and handle timeouts
+  ax25.update();
+
+  // connection can be closed by the remote station, or lost
+  if(ax25.getLinkState() == RADIOLIB_AX25_LINK_DISCONNECTED) {
+    Serial.println(F("[AX.25] Disconnected!"));
+    while(true);
+  }
+
+  // queue a new message once per second
+  static unsigned long last = 0;
+  if(millis() - last < 1000) {
+    return;
+  }
+  last = millis();
+
+  String str = "Hello World! #" + String(count);
+  int state = ax25.sendData((uint8_t*)str.c_str(), str.length());
+  if(state == RADIOLIB_ERR_NONE) {
+    count++;
+  } else if(state == RADIOLIB_ERR_LINK_WINDOW_FULL) {
+    // too many frames are waiting for acknowledgement, try again later
+    Serial.println(F("[AX.25] Waiting for acknowledgement ..."));
+  } else {
+    Serial.print(F("[AX.25] Failed to send data, code "));
+    Serial.println(state);
+  }
+}
@@ -0,0 +1,116 @@
+/*
+   RadioLib AX.25 Receive Example
+
+   This example receives AX.25 frames using
+   SX1278's FSK modem in direct mode. HDLC deframing,
+   NRZI decoding, bit destuffing and CRC check
+   are done by RadioLib, complete frames are kept
+   in a pool until they are read.
+
+   Here, 9600 baud G3RUH-scrambled frames are received.
+   Plain 1200 baud AFSK can't be demodulated by the 2-FSK modem.
+
+   Other modules that can be used to receive AX.25:
+    - SX127x/RFM9x
+    - RF69
+    - SX1231
+    - CC1101
+    - Si443x/RFM2x
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// SX1278 has the following connections:
+// NSS pin:   10
+// DIO0 pin:  2
+// RESET pin: 9
+// DIO1 pin:  3
+SX1278 radio = new Module(10, 2, 9, 3);
+
+// DIO2 pin:  5
+const int pin = 5;
+
+// create AX.25 client instance using the FSK module
+AX25Client ax25(&radio);
+
+// received frame
+AX25Frame frame("", 0, "", 0, 0);
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize SX1278
+  Serial.print(F("[SX1278] Initializing ... "));
+  // carrier frequency:           434.0 MHz
+  // bit rate:                    9.6 kbps (9600 baud G3RUH AX.25)
+  // frequency deviation:         3.0 kHz
+  int state = radio.beginFSK(434.0, 9.6, 3.0);
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // initialize AX.25 client
+  Serial.print(F("[AX.25] Initializing ... "));
+  state = ax25.begin("N7LEM");
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // start listening, G3RUH descrambler enabled
+  Serial.print(F("[AX.25] Starting to listen ... "));
+  state = ax25.startReceive(pin, true);
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+}
+
+void loop() {
+  // print all complete frames
+  while(ax25.available()) {
+    int state = ax25.readFrame(&frame);
+    if(state != RADIOLIB_ERR_NONE) {
+      Serial.print(F("[AX.25] Malformed frame, code "));
+      Serial.println(state);
+      continue;
+    }
+
+    Serial.print(F("[AX.25] "));
+    Serial.print(frame.srcCallsign);
+    Serial.print('-');
+    Serial.print(frame.srcSSID);
+    Serial.print(F(" > "));
+    Serial.print(frame.destCallsign);
+    Serial.print('-');
+    Serial.print(frame.destSSID);
+    for(uint8_t i = 0; i < frame.numRepeaters; i++) {
+      Serial.print(',');
+      Serial.print(frame.repeaterCallsigns[i]);
+      Serial.print('-');
+      Serial.print(frame.repeaterSSIDs[i]);
+    }
+    Serial.print(':');
+    for(uint16_t i = 0; i < frame.infoLen; i++) {
+      Serial.print((char)frame.info[i]);
+    }
+    Serial.println();
+  }
+}
@@ -57,12 +57,13 @@ void setup() {
   // NOTE: moved to ISM band on purpose
   //       DO NOT transmit in APRS bands without ham radio license!
   Serial.print(F("[AX5043] Initializing ... "));
+  // carrier frequency:           144.39 MHz (in Hz)
+  // the other parameters are register values, they depend on the crystal
   #ifdef AX5043_XTAL_16368KHz
-  int state = radio.beginAFSK(0x8D24C93, 0x4CE, 0xA51, 0x13, 0x23);
+  int state = radio.beginAFSK(144390000UL, 0x4CE, 0xA51, 0x13, 0x23);
   #else
-  int state = radio.beginAFSK(0x9063D71);
+  int state = radio.beginAFSK(144390000UL);
   #endif
-  // int state = radio.beginAFSK(142.39e6);
 
   // when using one of the non-LoRa modules for AX.25
   // (RF69, CC1101, Si4432 etc.), use the basic begin() method
@@ -26,7 +26,7 @@ void setup() {
 
   // initialize SX1278
   Serial.print(F("[AX5043] Initializing ... "));
-  // carrier frequency:           169.0 MHz
+  // carrier frequency:           144.39 MHz (in Hz)
   int state = radio.beginAFSK(144.390e6);
 
   if(state == RADIOLIB_ERR_NONE) {
@@ -0,0 +1,100 @@
+/*
+   RadioLib AX5043 AFSK Receive Example
+
+   This example receives AX.25 frames using
+   AX5043's AFSK modem. HDLC deframing, bit
+   destuffing and CRC check are done by the chip,
+   so only complete and valid frames are received.
+   Frames are kept in a queue together with RSSI,
+   frequency offset and timestamp.
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// AX5043 has the following connections:
+// NSS pin:   7
+// IRQ pin:   2
+// RESET pin: 9
+// GPIO pin:  3
+AX5043 radio = new Module(7, 2, 9, 3);
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize AX5043
+  Serial.print(F("[AX5043] Initializing ... "));
+  // carrier frequency:           144.390 MHz
+  int state = radio.beginAFSK(144.390e6);
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // set the function that will be called
+  // when there is data in FIFO
+  radio.setIrqAction(setFlag);
+
+  // start listening
+  Serial.print(F("[AX5043] Starting to listen ... "));
+  state = radio.startReceive();
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+}
+
+// flag to indicate that there is data in FIFO
+volatile bool dataFlag = false;
+
+// this function is called when there is data in FIFO
+// IMPORTANT: this function MUST be 'void' type
+//            and MUST NOT have any arguments!
+#if defined(ESP8266) || defined(ESP32)
+  ICACHE_RAM_ATTR
+#endif
+void setFlag(void) {
+  dataFlag = true;
+}
+
+// received frame
+AX5043Packet_t pkt;
+
+void loop() {
+  // move everything from FIFO into the packet queue
+  if(dataFlag) {
+    dataFlag = false;
+    radio.readFifo();
+  }
+
+  // print all complete frames
+  while(radio.available()) {
+    radio.readPacket(&pkt);
+
+    Serial.print(F("[AX5043] Received frame, length "));
+    Serial.print(pkt.len);
+    Serial.print(F(" bytes, RSSI "));
+    Serial.print(pkt.rssi);
+    Serial.print(F(" dBm, frequency offset "));
+    Serial.print(pkt.freqOffset);
+    Serial.println(F(" Hz"));
+
+    for(uint16_t i = 0; i < pkt.len; i++) {
+      if(pkt.data[i] < 0x10) {
+        Serial.print('0');
+      }
+      Serial.print(pkt.data[i], HEX);
+      Serial.print(' ');
+    }
+    Serial.println();
+  }
+}
@@ -0,0 +1,85 @@
+/*
+   RadioLib CC1101 Frequency Hopping Example
+
+   This example transmits packets while hopping over
+   a set of channels. Each channel is calibrated once
+   at startup, so hopping only takes a few SPI transfers
+   instead of waiting for synthesizer calibration.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#cc1101
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// CC1101 has the following connections:
+// CS pin:    10
+// GDO0 pin:  2
+// RST pin:   unused
+// GDO2 pin:  3 (optional)
+CC1101 radio = new Module(10, 2, RADIOLIB_NC, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//CC1101 radio = RadioShield.ModuleA;
+
+// channels to hop over, all of them must be in the same band
+#define NUM_CHANNELS  8
+float freqs[NUM_CHANNELS] = { 433.1, 433.3, 433.5, 433.7, 433.9, 434.1, 434.3, 434.5 };
+
+// table of cached channel calibrations
+CC1101HopChannel_t hopTable[NUM_CHANNELS];
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize CC1101 with default settings
+  Serial.print(F("[CC1101] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // calibrate all channels
+  Serial.print(F("[CC1101] Calibrating channels ... "));
+  state = radio.setHopTable(hopTable, freqs, NUM_CHANNELS);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+}
+
+// pseudo-random hop sequence
+uint8_t channel = 0;
+
+void loop() {
+  // move to the next channel
+  channel = (channel + 3) % NUM_CHANNELS;
+  radio.hop(channel);
+
+  Serial.print(F("[CC1101] Transmitting on "));
+  Serial.print(freqs[channel]);
+  Serial.print(F(" MHz ... "));
+
+  int state = radio.transmit("Hello World!");
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+  }
+
+  // wait before transmitting again
+  delay(100);
+}
@@ -0,0 +1,124 @@
+/*
+   RadioLib CC1101 Receive Stream Example
+
+   This example receives packets longer than CC1101 FIFO
+   (and longer than 255 bytes) sent by CC1101_Transmit_Stream
+   example. The FIFO is drained in bursts each time it fills
+   above threshold or the packet ends, which is signalled on GDO0.
+
+   To successfully receive data, the following settings have to be the same
+   on both transmitter and receiver:
+    - carrier frequency
+    - bit rate
+    - frequency deviation
+    - sync word
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#cc1101
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// CC1101 has the following connections:
+// CS pin:    10
+// GDO0 pin:  2
+// RST pin:   unused
+// GDO2 pin:  3 (optional)
+CC1101 radio = new Module(10, 2, RADIOLIB_NC, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//CC1101 radio = RadioShield.ModuleA;
+
+// buffer for received data, longer packets are dropped
+#define BUFFER_LENGTH   1024
+uint8_t data[BUFFER_LENGTH];
+
+// flag to indicate that FIFO needs to be drained
+volatile bool fifoFlag = false;
+
+// this function is called when Rx FIFO is above threshold or packet ended
+// IMPORTANT: this function MUST be 'void' type
+//            and MUST NOT have any arguments!
+#if defined(ESP8266) || defined(ESP32)
+  ICACHE_RAM_ATTR
+#endif
+void setFlag(void) {
+  fifoFlag = true;
+}
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize CC1101 with default settings
+  Serial.print(F("[CC1101] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // set the function that will be called
+  // when Rx FIFO is above threshold or packet ended
+  radio.setGdo0Action(setFlag, RISING);
+
+  // start listening for packets
+  Serial.print(F("[CC1101] Starting to listen ... "));
+  state = radio.startReceiveStream(data, BUFFER_LENGTH);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+}
+
+void loop() {
+  if(!fifoFlag) {
+    return;
+  }
+  fifoFlag = false;
+
+  // drain the FIFO
+  int state = radio.streamUpdate();
+  if((state == RADIOLIB_ERR_NONE) && !radio.isStreamFinished()) {
+    // packet is not complete yet
+    return;
+  }
+
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.print(F("[CC1101] Received "));
+    Serial.print(radio.getStreamLength());
+    Serial.println(F(" bytes"));
+
+    // print LQI (Link Quality Indicator)
+    Serial.print(F("[CC1101] LQI:\t\t"));
+    Serial.println(radio.getLQI());
+
+  } else if (state == RADIOLIB_ERR_CRC_MISMATCH) {
+    Serial.println(F("[CC1101] CRC error!"));
+
+  } else if (state == RADIOLIB_ERR_RX_FIFO_OVERFLOW) {
+    // reception is restarted automatically
+    Serial.println(F("[CC1101] FIFO overflow!"));
+    return;
+
+  } else {
+    Serial.print(F("[CC1101] Failed, code "));
+    Serial.println(state);
+
+  }
+
+  // listen for the next packet
+  if(radio.isStreamFinished() || (state == RADIOLIB_ERR_CRC_MISMATCH)) {
+    radio.startReceiveStream(data, BUFFER_LENGTH);
+  }
+}
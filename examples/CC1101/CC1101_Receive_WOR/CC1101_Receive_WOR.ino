@@ -0,0 +1,132 @@
+/*
+   RadioLib CC1101 Wake-on-Radio Receive Example
+
+   This example listens for FSK transmissions using wake-on-radio.
+   The radio sleeps and wakes up once per second to listen
+   for a short while, which saves a lot of power compared
+   to continuous reception. Once a packet is received,
+   an interrupt is triggered.
+
+   Packets must be sent with preamble longer than the wake-up period,
+   see CC1101_Transmit_WOR example.
+
+   To successfully receive data, the following settings have to be the same
+   on both transmitter and receiver:
+    - carrier frequency
+    - bit rate
+    - frequency deviation
+    - sync word
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#cc1101
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// CC1101 has the following connections:
+// CS pin:    10
+// GDO0 pin:  2
+// RST pin:   unused
+// GDO2 pin:  3 (optional)
+CC1101 radio = new Module(10, 2, RADIOLIB_NC, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//CC1101 radio = RadioShield.ModuleA;
+
+// wake-up period in ms and Rx window in % of the period
+#define WOR_PERIOD      1000
+#define WOR_DUTY_CYCLE  1.0
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize CC1101 with default settings
+  Serial.print(F("[CC1101] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // set the function that will be called
+  // when new packet is received
+  radio.setGdo0Action(setFlag);
+
+  // start wake-on-radio
+  Serial.print(F("[CC1101] Starting wake-on-radio ... "));
+  state = radio.startReceiveWOR(WOR_PERIOD, WOR_DUTY_CYCLE);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // the microcontroller can now sleep as well,
+  // until it is woken up by interrupt on GDO0
+}
+
+// flag to indicate that a packet was received
+volatile bool receivedFlag = false;
+
+// this function is called when a packet
+// is received by the module
+// IMPORTANT: this function MUST be 'void' type
+//            and MUST NOT have any arguments!
+#if defined(ESP8266) || defined(ESP32)
+  ICACHE_RAM_ATTR
+#endif
+void setFlag(void) {
+  // we got a packet, set the flag
+  receivedFlag = true;
+}
+
+void loop() {
+  // check if the flag is set
+  if(receivedFlag) {
+    // reset flag
+    receivedFlag = false;
+
+    // read received data, this also ends wake-on-radio
+    String str;
+    int state = radio.readData(str);
+
+    if (state == RADIOLIB_ERR_NONE) {
+      // packet was successfully received
+      Serial.println(F("[CC1101] Received packet!"));
+
+      // print data of the packet
+      Serial.print(F("[CC1101] Data:\t\t"));
+      Serial.println(str);
+
+      // print RSSI (Received Signal Strength Indicator)
+      // of the last received packet
+      Serial.print(F("[CC1101] RSSI:\t\t"));
+      Serial.print(radio.getRSSI());
+      Serial.println(F(" dBm"));
+
+    } else if (state == RADIOLIB_ERR_CRC_MISMATCH) {
+      // packet was received, but is malformed
+      Serial.println(F("CRC error!"));
+
+    } else {
+      // some other error occurred
+      Serial.print(F("failed, code "));
+      Serial.println(state);
+
+    }
+
+    // go back to wake-on-radio
+    radio.startReceiveWOR(WOR_PERIOD, WOR_DUTY_CYCLE);
+  }
+
+}
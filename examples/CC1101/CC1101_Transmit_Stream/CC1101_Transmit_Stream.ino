@@ -0,0 +1,110 @@
+/*
+   RadioLib CC1101 Transmit Stream Example
+
+   This example transmits packets longer than CC1101 FIFO
+   (and longer than 255 bytes) in infinite packet length mode.
+   The FIFO is refilled in bursts each time it drops below
+   threshold, which is signalled on GDO0.
+
+   The receiver must use startReceiveStream(), see
+   CC1101_Receive_Stream example.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#cc1101
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// CC1101 has the following connections:
+// CS pin:    10
+// GDO0 pin:  2
+// RST pin:   unused
+// GDO2 pin:  3 (optional)
+CC1101 radio = new Module(10, 2, RADIOLIB_NC, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//CC1101 radio = RadioShield.ModuleA;
+
+// data to send, it must stay valid until transmission is finished
+#define DATA_LENGTH   1000
+uint8_t data[DATA_LENGTH];
+
+// flag to indicate that FIFO needs to be refilled
+volatile bool fifoFlag = false;
+
+// this function is called when Tx FIFO drops below threshold
+// IMPORTANT: this function MUST be 'void' type
+//            and MUST NOT have any arguments!
+#if defined(ESP8266) || defined(ESP32)
+  ICACHE_RAM_ATTR
+#endif
+void setFlag(void) {
+  fifoFlag = true;
+}
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize CC1101 with default settings
+  Serial.print(F("[CC1101] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // fill the data with something
+  for(int i = 0; i < DATA_LENGTH; i++) {
+    data[i] = i;
+  }
+
+  // set the function that will be called
+  // when Tx FIFO drops below threshold
+  radio.setGdo0Action(setFlag, FALLING);
+}
+
+void loop() {
+  Serial.print(F("[CC1101] Sending "));
+  Serial.print(DATA_LENGTH);
+  Serial.print(F(" bytes ... "));
+
+  uint32_t start = millis();
+  int state = radio.startTransmitStream(data, DATA_LENGTH);
+
+  // keep refilling FIFO until the whole packet is sent
+  // refill is also attempted periodically, to catch the end of packet
+  uint32_t lastUpdate = micros();
+  while((state == RADIOLIB_ERR_NONE) && !radio.isStreamFinished()) {
+    if(fifoFlag || (micros() - lastUpdate > 1000)) {
+      fifoFlag = false;
+      lastUpdate = micros();
+      state = radio.streamUpdate();
+    }
+  }
+
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.print(F("success! ("));
+    Serial.print(millis() - start);
+    Serial.println(F(" ms)"));
+
+  } else if (state == RADIOLIB_ERR_TX_FIFO_UNDERFLOW) {
+    // FIFO was not refilled in time
+    Serial.println(F("FIFO underflow!"));
+
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+
+  }
+
+  // wait a second before transmitting again
+  delay(1000);
+}
@@ -0,0 +1,131 @@
+/*
+   RadioLib RF69 Receive in Listen Mode Example
+
+   This example listens for FSK transmissions using Listen mode
+   of RF69. The module wakes up on its own for a short receive
+   phase, and goes back to low-power idle phase when nothing
+   is received. Once a packet is received, an interrupt is
+   triggered.
+
+   Transmitter has to repeat each packet for longer than
+   idle and receive phase together, see RF69_Transmit_Burst.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#rf69sx1231
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// RF69 has the following connections:
+// CS pin:    10
+// DIO0 pin:  2
+// RESET pin: 3
+RF69 radio = new Module(10, 2, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//RF69 radio = RadioShield.ModuleA;
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize RF69 with default settings
+  Serial.print(F("[RF69] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // receive phase is only extended when signal
+  // above this threshold is detected
+  radio.setRSSIThreshold(-90.0);
+
+  // set the function that will be called
+  // when new packet is received
+  radio.setDio0Action(setFlag);
+
+  // start Listen mode with 2 ms receive phase
+  // and 500 ms idle phase, packet is accepted when
+  // RSSI is above threshold and sync word matches
+  Serial.print(F("[RF69] Starting Listen mode ... "));
+  state = radio.startListen(2000, 500000, true);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // if needed, Listen mode can be disabled by calling
+  // any of the following methods:
+  //
+  // radio.standby()
+  // radio.sleep()
+  // radio.transmit();
+  // radio.receive();
+  // radio.readData();
+}
+
+// flag to indicate that a packet was received
+volatile bool receivedFlag = false;
+
+// this function is called when a complete packet
+// is received by the module
+// IMPORTANT: this function MUST be 'void' type
+//            and MUST NOT have any arguments!
+#if defined(ESP8266) || defined(ESP32)
+  ICACHE_RAM_ATTR
+#endif
+void setFlag(void) {
+  // we got a packet, set the flag
+  receivedFlag = true;
+}
+
+void loop() {
+  // check if the flag is set
+  if(receivedFlag) {
+    // reset flag
+    receivedFlag = false;
+
+    // read the packet before the next receive phase starts
+    String str;
+    int state = radio.readData(str);
+
+    if (state == RADIOLIB_ERR_NONE) {
+      // packet was successfully received
+      Serial.println(F("[RF69] Received packet!"));
+
+      // print data of the packet
+      Serial.print(F("[RF69] Data:\t\t"));
+      Serial.println(str);
+
+      // print RSSI (Received Signal Strength Indicator)
+      // of the last received packet
+      Serial.print(F("[RF69] RSSI:\t\t"));
+      Serial.print(radio.getRSSI());
+      Serial.println(F(" dBm"));
+
+    } else {
+      // some error occurred
+      Serial.print(F("failed, code "));
+      Serial.println(state);
+
+    }
+
+    // the burst is still on air, wait for it to end
+    // so that the same packet is not received again
+    delay(600);
+
+    // put module back to Listen mode
+    radio.startListen(2000, 500000, true);
+  }
+}
@@ -0,0 +1,169 @@
+/*
+   RadioLib RF69 Secure Link Example
+
+   This example exchanges encrypted packets with another node
+   using RF69 FSK radio module. Short packets (up to 56 bytes)
+   are encrypted using hardware AES, longer ones (up to 239 bytes)
+   are streamed through the FIFO, encrypted and authenticated
+   in software.
+   Every packet carries a frame counter, replayed packets
+   are rejected. The counter must never repeat, so it has
+   to be kept in non-volatile memory (EEPROM, flash etc.)
+   across restarts. Replace loadCounter and saveCounter
+   below with storage available on your platform.
+
+   The other node should run the same sketch with the addresses
+   swapped. Keys can be rotated at any time, the receiving
+   node should rotate first.
+
+   NOTE: Short packets are encrypted, but not authenticated!
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#rf69sx1231
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// RF69 has the following connections:
+// CS pin:    10
+// DIO0 pin:  2
+// RESET pin: 3
+RF69 radio = new Module(10, 2, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//RF69 radio = RadioShield.ModuleA;
+
+// create secure link client instance using the module
+SecureLinkClient link(&radio);
+
+// addresses of this node and of the other node
+uint8_t ownAddr = 0x01;
+uint8_t peerAddr = 0x02;
+
+// 16-byte key shared with the other node
+uint8_t key[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+                  0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+int peer = 0;
+
+// number of frame counter values reserved at once,
+// non-volatile memory is only written once per block
+#define COUNTER_BLOCK 256
+
+// first counter value not reserved yet
+uint32_t counterLimit = 0;
+
+// placeholder for non-volatile storage - a RAM variable
+// starts from the same value after every restart!
+uint32_t storedCounter = 1;
+
+uint32_t loadCounter() {
+  return storedCounter;
+}
+
+void saveCounter(uint32_t counter) {
+  storedCounter = counter;
+}
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize RF69 with default settings
+  Serial.print(F("[RF69] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // frame counter must never repeat with the same key,
+  // restore it before starting the link, counters reserved
+  // but not used before restart are skipped
+  uint32_t counter = loadCounter();
+  counterLimit = counter + COUNTER_BLOCK;
+  saveCounter(counterLimit);
+  link.setTxCounter(counter);
+
+  // initialize secure link
+  Serial.print(F("[RF69] Starting secure link ... "));
+  state = link.begin(ownAddr);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // add the other node to the key table
+  peer = link.addPeer(peerAddr, key);
+}
+
+void loop() {
+  // reserve the next block of frame counters
+  // before the two packets below could run out of it
+  if (link.getTxCounter() + 2 > counterLimit) {
+    counterLimit += COUNTER_BLOCK;
+    saveCounter(counterLimit);
+  }
+
+  // send short packet, encrypted using hardware AES
+  Serial.print(F("[RF69] Transmitting short packet ... "));
+  uint8_t shortData[] = "Hello World!";
+  int state = link.transmit(peer, shortData, sizeof(shortData));
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+  }
+
+  // send long packet, encrypted in software
+  Serial.print(F("[RF69] Transmitting long packet ... "));
+  uint8_t longData[200];
+  for (int i = 0; i < 200; i++) {
+    longData[i] = i;
+  }
+  state = link.transmit(peer, longData, sizeof(longData));
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+  }
+
+  // listen for packets from the other node for a while
+  Serial.print(F("[RF69] Waiting for incoming packet ... "));
+  uint8_t data[RADIOLIB_SECURE_LINK_MAX_PAYLOAD_LENGTH];
+  size_t len = 0;
+  uint8_t from = 0;
+  state = link.receive(data, &len, &from, 1000);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+    Serial.print(F("[RF69] Received "));
+    Serial.print(len);
+    Serial.print(F(" bytes from peer "));
+    Serial.println(from);
+
+  } else if (state == RADIOLIB_ERR_RX_TIMEOUT) {
+    Serial.println(F("timeout!"));
+
+  } else if (state == RADIOLIB_ERR_FRAME_REPLAYED) {
+    Serial.println(F("replayed packet rejected!"));
+
+  } else if (state == RADIOLIB_ERR_MAC_MISMATCH) {
+    Serial.println(F("forged packet rejected!"));
+
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+  }
+}
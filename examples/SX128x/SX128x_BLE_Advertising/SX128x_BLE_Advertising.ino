@@ -0,0 +1,120 @@
+/*
+   RadioLib SX128x BLE Advertising Example
+
+   This example sends Bluetooth Low Energy advertising
+   packets on all three advertising channels (37, 38 and 39)
+   and listens for advertising packets of other devices
+   in between advertising events. Packets sent by this example
+   can be seen by BLE scanner apps on phones.
+
+   Other modules that can be used for BLE advertising:
+    - SX1280
+    - SX1281
+    - SX1282
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// SX1280 has the following connections:
+// NSS pin:   10
+// DIO1 pin:  2
+// NRST pin:  3
+// BUSY pin:  9
+SX1280 radio = new Module(10, 2, 3, 9);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//SX1280 radio = RadioShield.ModuleA;
+
+// create BLE advertising client instance using the module
+BLEAdvClient ble(&radio);
+
+// random static address, two most significant bits must be set
+uint8_t addr[] = { 0xC0, 0x11, 0x22, 0x33, 0x44, 0x55 };
+
+// advertising interval in ms
+#define ADV_INTERVAL  100
+
+uint32_t lastAdv = 0;
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize SX1280 for BLE advertising
+  // output power:                10 dBm
+  Serial.print(F("[BLE] Initializing ... "));
+  int state = ble.begin(10);
+  if (state == RADIOLIB_ERR_NONE) {
+    state = ble.setAddress(addr, true, RADIOLIB_BLE_PDU_TYPE_ADV_NONCONN_IND);
+  }
+  if (state == RADIOLIB_ERR_NONE) {
+    state = ble.addFlags();
+  }
+  if (state == RADIOLIB_ERR_NONE) {
+    state = ble.addName("RadioLib");
+  }
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // scan all advertising channels, hop every 30 ms
+  state = ble.startScan(RADIOLIB_BLE_ADV_CHANNEL_37, 30);
+  if (state != RADIOLIB_ERR_NONE) {
+    Serial.print(F("[BLE] Failed to start scan, code "));
+    Serial.println(state);
+    while (true);
+  }
+}
+
+void loop() {
+  // advertising interval is extended by random delay of 0 - 10 ms
+  // to avoid repeated collisions with other advertisers
+  if (millis() - lastAdv >= ADV_INTERVAL) {
+    lastAdv = millis() + random(0, 10);
+    int state = ble.advertise();
+    if (state != RADIOLIB_ERR_NONE) {
+      Serial.print(F("[BLE] Advertising failed, code "));
+      Serial.println(state);
+    }
+  }
+
+  // process received packets
+  ble.update();
+
+  // print everything in the queue
+  BLEAdvRecord_t rec;
+  while (ble.read(&rec) == RADIOLIB_ERR_NONE) {
+    Serial.print(F("[BLE] Ch "));
+    Serial.print(rec.channel);
+    Serial.print(F(", "));
+    for (uint8_t i = 0; i < 6; i++) {
+      if (rec.addr[i] < 0x10) {
+        Serial.print('0');
+      }
+      Serial.print(rec.addr[i], HEX);
+      if (i < 5) {
+        Serial.print(':');
+      }
+    }
+    Serial.print(F(", RSSI "));
+    Serial.print(rec.rssi);
+    Serial.print(F(" dBm"));
+
+    // print device name, if present
+    uint8_t len = 0;
+    uint8_t* name = BLEAdvClient::findData(&rec, RADIOLIB_BLE_AD_TYPE_NAME_COMPLETE, &len);
+    if (name != NULL) {
+      Serial.print(F(", name "));
+      Serial.write(name, len);
+    }
+    Serial.println();
+  }
+}
@@ -0,0 +1,102 @@
+/*
+   RadioLib SX128x Channel Monitor Example
+
+   This example monitors occupancy of several 2.4 GHz channels
+   by periodically sampling instantaneous RSSI, and reports
+   the least loaded channel. This can be used to avoid
+   channels occupied by Wi-Fi before a transfer.
+
+   Other modules that can be used for channel monitoring:
+    - SX126x
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#sx128x---lora-modem
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// SX1280 has the following connections:
+// NSS pin:   10
+// DIO1 pin:  2
+// NRST pin:  3
+// BUSY pin:  9
+SX1280 radio = new Module(10, 2, 3, 9);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//SX1280 radio = RadioShield.ModuleA;
+
+// create channel monitor instance using the module
+ChannelMonitor monitor(&radio);
+
+// channels to monitor - these fall between
+// Wi-Fi channels 1, 6 and 11 as well as on top of them
+float channels[] = { 2405.0, 2412.0, 2425.0, 2437.0, 2450.0, 2462.0, 2475.0 };
+
+uint32_t lastReport = 0;
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize SX1280 with default settings
+  Serial.print(F("[SX1280] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // initialize channel monitor
+  // busy threshold:              -85 dBm
+  // sampling interval:           2 ms
+  Serial.print(F("[Monitor] Starting ... "));
+  state = monitor.begin(channels, 7, -85.0, 2);
+  if (state == RADIOLIB_ERR_NONE) {
+    state = monitor.start();
+  }
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+}
+
+void loop() {
+  // keep sampling in the background
+  monitor.update();
+
+  // report once per second
+  if (millis() - lastReport >= 1000) {
+    lastReport = millis();
+
+    for (uint8_t i = 0; i < 7; i++) {
+      ChannelStats_t stats;
+      monitor.getStats(i, &stats);
+      Serial.print(F("[Monitor] "));
+      Serial.print(stats.freq, 1);
+      Serial.print(F(" MHz\tbusy "));
+      Serial.print(100.0 * monitor.getBusyRatio(i), 1);
+      Serial.print(F(" %\tavg "));
+      Serial.print(stats.rssiAvg, 1);
+      Serial.print(F(" dBm\tmax "));
+      Serial.print(stats.rssiMax, 1);
+      Serial.println(F(" dBm"));
+    }
+
+    float freq = 0;
+    if (monitor.getLeastLoaded(&freq) >= 0) {
+      Serial.print(F("[Monitor] Least loaded channel: "));
+      Serial.print(freq, 1);
+      Serial.println(F(" MHz"));
+    }
+  }
+}
@@ -0,0 +1,136 @@
+/*
+   RadioLib SX128x FLRC Bulk Transfer Example
+
+   This example transfers a large buffer between two SX128x
+   modules using FLRC modem. Chunks are sent back-to-back
+   without returning to standby, and lost chunks are
+   repeated using selective ACKs. After each transfer,
+   throughput and latency statistics are printed,
+   so the example can be used to benchmark different
+   bit rates, coding rates and chunk sizes.
+
+   Upload the example to two boards, one with TRANSMITTER
+   defined and the other without it.
+
+   Other modules from SX128x family can also be used.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#sx128x---flrc-modem
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// comment out on the receiving side
+#define TRANSMITTER
+
+// SX1280 has the following connections:
+// NSS pin:   10
+// DIO1 pin:  2
+// NRST pin:  3
+// BUSY pin:  9
+SX1280 radio = new Module(10, 2, 3, 9);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//SX1280 radio = RadioShield.ModuleA;
+
+// create bulk transfer client instance using the module
+BulkTransferClient bulk(&radio);
+
+// data buffer, 4 kB
+#define BUFFER_SIZE   4096
+uint8_t buff[BUFFER_SIZE];
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize SX1280 with FLRC modem
+  // carrier frequency:           2400.0 MHz
+  // bit rate:                    1300 kbps
+  // coding rate:                 3
+  // output power:                10 dBm
+  // preamble length:             16 bits
+  Serial.print(F("[SX1280] Initializing ... "));
+  int state = radio.beginFLRC(2400.0, 1300, 3, 10, 16);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // initialize bulk transfer client
+  // chunk size:                  120 bytes
+  // selective ACK window:        16 chunks
+  // ACK timeout:                 20 ms
+  Serial.print(F("[Bulk] Initializing ... "));
+  state = bulk.begin(120, 16, 20);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // fill the buffer with some data
+  for (uint16_t i = 0; i < BUFFER_SIZE; i++) {
+    buff[i] = i & 0xFF;
+  }
+}
+
+void printStats() {
+  BulkTransferStats_t stats;
+  bulk.getStats(&stats);
+  Serial.print(F("[Bulk] Bytes:\t\t"));
+  Serial.println(stats.bytes);
+  Serial.print(F("[Bulk] Frames:\t\t"));
+  Serial.println(stats.packets);
+  Serial.print(F("[Bulk] Repeated:\t"));
+  Serial.println(stats.retransmissions);
+  Serial.print(F("[Bulk] ACKs:\t\t"));
+  Serial.println(stats.acks);
+  Serial.print(F("[Bulk] Time:\t\t"));
+  Serial.print(stats.elapsed);
+  Serial.println(F(" us"));
+  Serial.print(F("[Bulk] Max. gap:\t"));
+  Serial.print(stats.maxGap);
+  Serial.println(F(" us"));
+  Serial.print(F("[Bulk] Throughput:\t"));
+  Serial.print(stats.throughput);
+  Serial.println(F(" kbps"));
+}
+
+void loop() {
+#if defined(TRANSMITTER)
+  Serial.print(F("[Bulk] Sending ... "));
+  int state = bulk.transmit(buff, BUFFER_SIZE);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+    printStats();
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+  }
+  delay(1000);
+
+#else
+  Serial.print(F("[Bulk] Waiting for transfer ... "));
+  int state = bulk.receive(buff, BUFFER_SIZE, 10000);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.print(F("received "));
+    Serial.print(bulk.getReceivedLength());
+    Serial.println(F(" bytes"));
+    printStats();
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+  }
+
+#endif
+}
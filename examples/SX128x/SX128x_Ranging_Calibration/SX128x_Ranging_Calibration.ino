@@ -0,0 +1,139 @@
+/*
+   RadioLib SX128x Ranging Calibration Example
+
+   This example generates ranging calibration table
+   for a pair of SX1280 modules. Place the modules
+   at a known distance, run this sketch as master
+   on one of them and as slave on the other.
+   All combinations of bandwidth and spreading factor
+   are swept, this may take a few minutes.
+
+   Only SX1280 and SX1282 without external RF switch support ranging!
+
+   The measured distances are also printed as CSV,
+   which can be processed on a PC by
+   extras/ranging/RangingCalibration.py
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#sx128x---lora-modem
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// SX1280 has the following connections:
+// NSS pin:   10
+// DIO1 pin:  2
+// NRST pin:  3
+// BUSY pin:  9
+SX1280 radio = new Module(10, 2, 3, 9);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//SX1280 radio = RadioShield.ModuleA;
+
+// create ranging client instance using the module
+RangingClient ranging(&radio);
+
+// set to false on the slave module
+const bool master = true;
+
+// reference distance between the modules in meters
+const float distance = 10.0;
+
+// address of the slave module
+uint32_t addr = 0x12345678;
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize SX1280 with default settings
+  Serial.print(F("[SX1280] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // initialize ranging client
+  state = ranging.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    state = ranging.setAnchors(&addr, 1);
+  }
+  if (state != RADIOLIB_ERR_NONE) {
+    Serial.print(F("[Ranging] Initialization failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  if (!master) {
+    // slave just follows the master through the sweep
+    Serial.print(F("[Ranging] Waiting for master ... "));
+    state = ranging.calibrateSlave(addr);
+    if (state == RADIOLIB_ERR_NONE) {
+      Serial.println(F("done!"));
+    } else {
+      Serial.print(F("failed, code "));
+      Serial.println(state);
+    }
+    return;
+  }
+
+  // start from the default calibration from AN1200.29
+  uint16_t calibration[3][6] = {
+    { 10299, 10271, 10244, 10242, 10230, 10246 },
+    { 11486, 11474, 11453, 11426, 11417, 11401 },
+    { 13308, 13493, 13528, 13515, 13430, 13376 }
+  };
+  uint16_t initial[3][6];
+  memcpy(initial, calibration, sizeof(initial));
+  float measured[3][6];
+
+  Serial.print(F("[Ranging] Calibrating ... "));
+  state = ranging.calibrate(distance, calibration, measured);
+  if (state != RADIOLIB_ERR_NONE) {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    return;
+  }
+  Serial.println(F("success!"));
+
+  // print the log for RangingCalibration.py
+  const float bandwidths[] = { 406.25, 812.5, 1625.0 };
+  Serial.println(F("bw,sf,cal,distance"));
+  for (uint8_t b = 0; b < 3; b++) {
+    for (uint8_t s = 0; s < 6; s++) {
+      Serial.print(bandwidths[b]);
+      Serial.print(',');
+      Serial.print(s + 5);
+      Serial.print(',');
+      Serial.print(initial[b][s]);
+      Serial.print(',');
+      Serial.println(measured[b][s]);
+    }
+  }
+
+  // print the table, it can be pasted into a sketch
+  Serial.println(F("uint16_t calibration[3][6] = {"));
+  for (uint8_t b = 0; b < 3; b++) {
+    Serial.print(F("  { "));
+    for (uint8_t s = 0; s < 6; s++) {
+      Serial.print(calibration[b][s]);
+      if (s < 5) {
+        Serial.print(F(", "));
+      }
+    }
+    Serial.println(b < 2 ? F(" },") : F(" }"));
+  }
+  Serial.println(F("};"));
+}
+
+void loop() {
+
+}
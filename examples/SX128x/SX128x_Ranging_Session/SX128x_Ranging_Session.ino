@@ -0,0 +1,151 @@
+/*
+   RadioLib SX128x Ranging Session Example
+
+   This example performs a ranging session against multiple
+   SX1280 anchors. Each anchor is ranged several times
+   on multiple channels, results are filtered and
+   the position is estimated using multilateration.
+
+   Only SX1280 and SX1282 without external RF switch support ranging!
+
+   The anchors must run ranging session in slave mode,
+   with the same channel plan and their own address:
+     ranging.startSlave(0x12345678);
+   and call ranging.update() from loop.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#sx128x---lora-modem
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// SX1280 has the following connections:
+// NSS pin:   10
+// DIO1 pin:  2
+// NRST pin:  3
+// BUSY pin:  9
+SX1280 radio = new Module(10, 2, 3, 9);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//SX1280 radio = RadioShield.ModuleA;
+
+// create ranging client instance using the module
+RangingClient ranging(&radio);
+
+// addresses of the anchors
+uint32_t addrs[] = { 0x12345678, 0x12345679, 0x1234567A };
+
+// anchor positions in meters (x, y, z), in the same order
+float anchors[][3] = {
+  {  0.0,  0.0, 0.0 },
+  { 10.0,  0.0, 0.0 },
+  {  0.0, 10.0, 0.0 }
+};
+
+// channel plan for frequency diversity
+float channels[] = { 2403.0, 2425.0, 2450.0, 2475.0 };
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize SX1280 with default settings
+  Serial.print(F("[SX1280] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // initialize ranging client
+  // exchanges per channel:       4
+  // exchange timeout:            50 ms
+  Serial.print(F("[Ranging] Initializing ... "));
+  state = ranging.begin(4, 50);
+  if (state == RADIOLIB_ERR_NONE) {
+    state = ranging.setChannels(channels, 4);
+  }
+  if (state == RADIOLIB_ERR_NONE) {
+    state = ranging.setAnchors(addrs, 3);
+  }
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // if ranging calibration is known, it can be provided
+  // residual distance offsets in meters can also be set
+  /*
+    uint16_t calibration[3][6] = {
+      { 10299, 10271, 10244, 10242, 10230, 10246 },
+      { 11486, 11474, 11453, 11426, 11417, 11401 },
+      { 13308, 13493, 13528, 13515, 13430, 13376 }
+    };
+    ranging.setCalibration(calibration);
+  */
+
+  // start non-blocking session
+  ranging.startMaster();
+}
+
+void loop() {
+  // process the session, this does not block
+  int state = ranging.update();
+  if (state != RADIOLIB_ERR_NONE) {
+    Serial.print(F("[Ranging] Failed, code "));
+    Serial.println(state);
+  }
+
+  if (!ranging.isFinished()) {
+    // do something else while ranging is in progress
+    return;
+  }
+
+  // print the estimates
+  RangingEstimate_t estimates[3];
+  for (uint8_t i = 0; i < 3; i++) {
+    Serial.print(F("[Ranging] Anchor "));
+    Serial.print(addrs[i], HEX);
+    state = ranging.getEstimate(i, &estimates[i]);
+    if (state == RADIOLIB_ERR_NONE) {
+      Serial.print(F(":\t"));
+      Serial.print(estimates[i].distance);
+      Serial.print(F(" m, variance "));
+      Serial.print(estimates[i].variance);
+      Serial.print(F(" m^2, "));
+      Serial.print(estimates[i].numSamples);
+      Serial.print('/');
+      Serial.print(estimates[i].numExchanges);
+      Serial.println(F(" samples"));
+    } else {
+      Serial.println(F(":\tno result"));
+    }
+  }
+
+  // solve 2D position
+  float pos[3];
+  state = RangingClient::multilaterate(anchors, estimates, 3, pos);
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.print(F("[Ranging] Position:\t\t"));
+    Serial.print(pos[0]);
+    Serial.print(F(", "));
+    Serial.println(pos[1]);
+  } else {
+    Serial.print(F("[Ranging] Position not solved, code "));
+    Serial.println(state);
+  }
+
+  // wait for a second before ranging again
+  delay(1000);
+  ranging.startMaster();
+}
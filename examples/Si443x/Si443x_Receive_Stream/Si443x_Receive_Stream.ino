@@ -0,0 +1,107 @@
+/*
+   RadioLib Si443x Receive Stream Example
+
+   This example receives packets longer than the 64-byte FIFO
+   using Si4432 FSK radio module. FIFO is read whenever
+   it is almost full, and once more when the packet ends.
+   Packets can be up to 255 bytes long, variable packet length mode
+   (the default) is required.
+
+   Other modules from Si443x/RFM2x family can also be used.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#si443xrfm2x
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// Si4432 has the following connections:
+// nSEL pin:  10
+// nIRQ pin:  2
+// SDN pin:   9
+Si4432 radio = new Module(10, 2, 9);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//Si4432 radio = RadioShield.ModuleA;
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize Si4432 with default settings
+  Serial.print(F("[Si4432] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // set the function that will be called
+  // when receive buffer is almost full
+  // or the packet was received
+  radio.setFifoFullAction(fifoGet);
+
+  // start listening for packets
+  Serial.print(F("[Si4432] Starting to listen ... "));
+  state = radio.startReceive();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+}
+
+// flag to indicate that a packet was received
+volatile bool receivedFlag = false;
+
+// size of the receive buffer
+const int totalLength = 255;
+
+// counter to keep track of how many bytes have been received so far
+volatile int receivedLength = 0;
+
+// buffer to save the received data into
+volatile uint8_t rxBuffer[totalLength + 1];
+
+// this function is called when the radio receive buffer
+// is almost full, or when the packet was received
+// IMPORTANT: this function MUST be 'void' type
+//            and MUST NOT have any arguments!
+#if defined(ESP8266) || defined(ESP32)
+  ICACHE_RAM_ATTR
+#endif
+void fifoGet(void) {
+  // set the flag when we receive the full packet
+  receivedFlag = radio.fifoGet(rxBuffer, totalLength, &receivedLength);
+}
+
+void loop() {
+  // check if the flag is set
+  if(receivedFlag) {
+    // packet was successfully received
+    Serial.print(F("[Si4432] Received packet of "));
+    Serial.print(receivedLength);
+    Serial.println(F(" bytes!"));
+
+    // print data of the packet
+    rxBuffer[receivedLength] = '\0';
+    Serial.print(F("[Si4432] Data:\t\t"));
+    Serial.println((char*)rxBuffer);
+
+    // reset flag
+    receivedFlag = false;
+    receivedLength = 0;
+
+    // put module back to listen mode
+    radio.startReceive();
+  }
+}
@@ -115,6 +115,19 @@ void setup() {
     while (true);
   }
 
+  // when switching between a few modem configurations often,
+  // register values can be calculated once and applied later
+  // without any floating point math
+  // bit rate:                    9.6 kbps
+  // frequency deviation:         5.0 kHz
+  // receiver bandwidth:          42.1 kHz
+  Si443xModemConfig_t slowModem;
+  if (radio1.getModemConfig(&slowModem, 9.6, 5.0, 42.1) != RADIOLIB_ERR_NONE) {
+    Serial.println(F("[Si4432] Selected modem configuration is invalid for this module!"));
+    while (true);
+  }
+  radio1.setModemConfig(&slowModem);
+
   Serial.println(F("[Si4432] All settings changed successfully!"));
 }
 
@@ -0,0 +1,126 @@
+/*
+   RadioLib Si443x Transmit Stream Example
+
+   This example transmits packets longer than the 64-byte FIFO
+   using Si4432 FSK radio module. The first 64 bytes are written
+   by startTransmit, the rest is added whenever FIFO is almost empty.
+   Packets can be up to 255 bytes long, variable packet length mode
+   (the default) is required.
+
+   Other modules from Si443x/RFM2x family can also be used.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#si443xrfm2x
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// Si4432 has the following connections:
+// nSEL pin:  10
+// nIRQ pin:  2
+// SDN pin:   9
+Si4432 radio = new Module(10, 2, 9);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//Si4432 radio = RadioShield.ModuleA;
+
+// save transmission state between loops
+int transmissionState = RADIOLIB_ERR_NONE;
+
+// this packet is much longer than would normally fit
+// into Si4432's internal buffer
+String longPacket = "Lorem ipsum dolor sit amet, consectetur adipiscing elit.\
+ Maecenas at urna ut nunc imperdiet laoreet. Aliquam erat volutpat.\
+ Etiam mattis mauris vitae posuere tincidunt. In sit amet bibendum nisl,\
+ a ultrices lorem. Duis hendrerit.";
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize Si4432 with default settings
+  Serial.print(F("[Si4432] Initializing ... "));
+  int state = radio.begin();
+  if (state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while (true);
+  }
+
+  // set the function that will be called
+  // when transmit buffer is almost empty
+  // or the packet was sent
+  radio.setFifoEmptyAction(fifoAdd);
+
+  // start transmitting the long packet
+  Serial.print(F("[Si4432] Sending a long packet ... "));
+  transmissionState = radio.startTransmit(longPacket);
+}
+
+// flag to indicate nIRQ was activated
+volatile bool irqFlag = false;
+
+// how many bytes are there in total
+int totalLength = longPacket.length();
+
+// counter to keep track of how many bytes still need to be added
+int remLength = totalLength;
+
+// this function is called when the radio transmit buffer
+// is almost empty, or when the packet was sent
+// IMPORTANT: this function MUST be 'void' type
+//            and MUST NOT have any arguments!
+#if defined(ESP8266) || defined(ESP32)
+  ICACHE_RAM_ATTR
+#endif
+void fifoAdd(void) {
+  // we can send more bytes
+  irqFlag = true;
+}
+
+void loop() {
+  if(!irqFlag) {
+    return;
+  }
+
+  // reset flag
+  irqFlag = false;
+
+  // add more bytes to the transmit buffer,
+  // this will also report when the packet was sent
+  uint8_t* txBuffPtr = (uint8_t*)longPacket.c_str();
+  if(!radio.fifoAdd(txBuffPtr, totalLength, &remLength)) {
+    return;
+  }
+
+  // reset the counter
+  remLength = totalLength;
+
+  if (transmissionState == RADIOLIB_ERR_NONE) {
+    // packet was successfully sent
+    Serial.println(F("transmission finished!"));
+
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(transmissionState);
+
+  }
+
+  // clean up after transmission is finished
+  // this will ensure transmitter is disabled,
+  // RF switch is powered down etc.
+  radio.finishTransmit();
+
+  // wait a second before transmitting again
+  delay(1000);
+
+  // send another one
+  Serial.print(F("[Si4432] Sending another long packet ... "));
+  transmissionState = radio.startTransmit(longPacket);
+}
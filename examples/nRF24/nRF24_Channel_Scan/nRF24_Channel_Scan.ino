@@ -0,0 +1,87 @@
+/*
+   RadioLib nRF24 Channel Scan Example
+
+   This example sweeps all 126 channels of nRF24 2.4 GHz
+   radio module using its received power detector and
+   prints how often each channel was occupied (signal
+   above -64 dBm). The sweep runs in the background,
+   so other tasks can be done in loop in the meantime.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#nrf24
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// nRF24 has the following connections:
+// CS pin:    10
+// IRQ pin:   2
+// CE pin:    3
+nRF24 radio = new Module(10, 2, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//nRF24 radio = RadioShield.ModuleA;
+
+// number of passes through all channels before results are printed
+#define SCAN_PASSES   100
+
+// histogram of channel occupancy
+uint16_t hits[RADIOLIB_NRF24_NUM_CHANNELS];
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize nRF24 with default settings
+  Serial.print(F("[nRF24] Initializing ... "));
+  int state = radio.begin();
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // start sweeping all channels in the background
+  // alternatively, radio.scanChannels(hits, SCAN_PASSES)
+  // can be used for a blocking sweep
+  Serial.print(F("[nRF24] Starting channel scan ... "));
+  state = radio.startChannelScan(hits);
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+}
+
+void loop() {
+  // advance the sweep, this should be called as often as possible
+  if(radio.updateChannelScan() < SCAN_PASSES) {
+    return;
+  }
+  radio.stopChannelScan();
+
+  // print occupancy of each channel in percent
+  Serial.println(F("[nRF24] Channel occupancy:"));
+  for(uint8_t i = 0; i < RADIOLIB_NRF24_NUM_CHANNELS; i++) {
+    Serial.print(2400 + i);
+    Serial.print(F(" MHz\t"));
+    uint8_t percent = (uint32_t)hits[i] * 100 / SCAN_PASSES;
+    for(uint8_t j = 0; j < percent / 5; j++) {
+      Serial.print('#');
+    }
+    Serial.print(' ');
+    Serial.print(percent);
+    Serial.println('%');
+  }
+
+  // start over
+  radio.startChannelScan(hits);
+}
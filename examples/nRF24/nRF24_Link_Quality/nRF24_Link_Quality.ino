@@ -0,0 +1,115 @@
+/*
+   RadioLib nRF24 Link Quality Example
+
+   This example transmits packets to two nodes using nRF24 2.4 GHz
+   radio module while tracking retransmissions and packet loss
+   for each of them. Automatic retransmission delay and count
+   are adapted to each destination and the transmitter hops
+   to a cleaner channel from the hop schedule when the current
+   one becomes congested.
+
+   Receivers should use LinkQualityClient with the same
+   hop schedule, call startReceive() once, update() in loop
+   and readData() when a packet is received. They follow
+   the transmitter to the new channel automatically.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#nrf24
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// nRF24 has the following connections:
+// CS pin:    10
+// IRQ pin:   2
+// CE pin:    3
+nRF24 radio = new Module(10, 2, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//nRF24 radio = RadioShield.ModuleA;
+
+// create link quality controller instance using the module
+LinkQualityClient link(&radio);
+
+// hop schedule, must be the same on all nodes
+int16_t schedule[] = { 2402, 2426, 2440, 2464, 2480 };
+
+// destinations
+byte addrA[] = {0x01, 0x23, 0x45, 0x67, 0x89};
+byte addrB[] = {0x01, 0x23, 0x45, 0x67, 0x8A};
+int peerA = 0;
+int peerB = 0;
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize nRF24 with default settings
+  Serial.print(F("[nRF24] Initializing ... "));
+  int state = radio.begin();
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // initialize link quality controller
+  // followers wait 200 ms before they start looking for the transmitter
+  Serial.print(F("[nRF24] Starting link controller ... "));
+  state = link.begin(schedule, 5, 200);
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // add destinations
+  peerA = link.addPeer(addrA);
+  peerB = link.addPeer(addrB);
+}
+
+void printStats(int peer) {
+  LinkPeerStats_t stats;
+  link.getPeerStats(peer, &stats);
+  Serial.print(F("[nRF24] Peer "));
+  Serial.print(peer);
+  Serial.print(F(": sent "));
+  Serial.print(stats.sent);
+  Serial.print(F(", lost "));
+  Serial.print(stats.lost);
+  Serial.print(F(", retransmits/packet "));
+  Serial.print(stats.retransmitAvg);
+  Serial.print(F(", ARD "));
+  Serial.print(stats.retrDelay);
+  Serial.print(F(" us, ARC "));
+  Serial.println(stats.retrCount);
+}
+
+void loop() {
+  // send a packet to each destination
+  // packets must be sent more often than the follower dwell time
+  link.transmit(peerA, (uint8_t*)"Hello A!", 8);
+  link.transmit(peerB, (uint8_t*)"Hello B!", 8);
+
+  // print statistics every now and then
+  static uint32_t lastPrint = 0;
+  if(millis() - lastPrint > 5000) {
+    lastPrint = millis();
+    printStats(peerA);
+    printStats(peerB);
+    Serial.print(F("[nRF24] Channel "));
+    Serial.print(schedule[link.getChannel()]);
+    Serial.print(F(" MHz, hops: "));
+    Serial.println(link.getHopCount());
+  }
+
+  delay(50);
+}
@@ -0,0 +1,127 @@
+/*
+   RadioLib nRF24 Multi-Pipe Receive Example
+
+   This example receives packets from up to 6 transmitters
+   (one per receive pipe) using nRF24 2.4 GHz radio module.
+   The radio stays in receive mode, all packets waiting
+   in RX FIFO are read at once and sorted by the pipe
+   they were received on. Each transmitter also gets
+   a short payload back in the ACK packet.
+
+   Transmitters should use addresses 0x01, 0x23, 0x45, 0x67, 0xN0
+   where N is the pipe number (0 - 5), e.g. nRF24_Transmit example
+   with modified address.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#nrf24
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// nRF24 has the following connections:
+// CS pin:    10
+// IRQ pin:   2
+// CE pin:    3
+nRF24 radio = new Module(10, 2, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//nRF24 radio = RadioShield.ModuleA;
+
+// create multi-pipe client instance using the module
+MultiPipeClient hub(&radio);
+
+// flag to indicate that a packet was received
+volatile bool receivedFlag = false;
+
+// this function is called when a complete packet
+// is received by the module
+// IMPORTANT: this function MUST be 'void' type
+//            and MUST NOT have any arguments!
+#if defined(ESP8266) || defined(ESP32)
+  ICACHE_RAM_ATTR
+#endif
+void setFlag(void) {
+  // we got a packet, set the flag
+  receivedFlag = true;
+}
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize nRF24 with default settings
+  Serial.print(F("[nRF24] Initializing ... "));
+  int state = radio.begin();
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // set receive pipes - pipes 0 and 1 have full address,
+  // pipes 2 - 5 share the first 4 bytes with pipe 1
+  byte addr0[] = {0x01, 0x23, 0x45, 0x67, 0x00};
+  byte addr1[] = {0x01, 0x23, 0x45, 0x67, 0x10};
+  Serial.print(F("[nRF24] Setting receive pipes ... "));
+  state = radio.setReceivePipe(0, addr0);
+  state |= radio.setReceivePipe(1, addr1);
+  for(uint8_t i = 2; i < 6; i++) {
+    state |= radio.setReceivePipe(i, (uint8_t)(i << 4));
+  }
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // initialize multi-pipe receiver with ACK payloads enabled
+  Serial.print(F("[nRF24] Starting to listen ... "));
+  state = hub.begin(true);
+  if(state == RADIOLIB_ERR_NONE) {
+    state = hub.startReceive();
+  }
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // set the function that will be called
+  // when new packet is received
+  radio.setIrqAction(setFlag);
+}
+
+void loop() {
+  if(receivedFlag) {
+    receivedFlag = false;
+
+    // move everything from RX FIFO to pipe queues
+    hub.update();
+  }
+
+  // process packets in the order they were received
+  uint8_t pipe = 0;
+  uint8_t data[32];
+  uint8_t len = 0;
+  while(hub.readAny(&pipe, data, &len) == RADIOLIB_ERR_NONE) {
+    Serial.print(F("[nRF24] Pipe "));
+    Serial.print(pipe);
+    Serial.print(F(", "));
+    Serial.print(len);
+    Serial.println(F(" bytes"));
+
+    // reply in the next ACK on the same pipe
+    byte reply[] = { 'O', 'K', pipe };
+    hub.writeAckPayload(pipe, reply, 3);
+  }
+}
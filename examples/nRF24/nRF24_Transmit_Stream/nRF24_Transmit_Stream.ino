@@ -0,0 +1,117 @@
+/*
+   RadioLib nRF24 Streaming Transmit Example
+
+   This example transmits packets back-to-back using nRF24
+   streaming mode. CE is kept high and the 3-level TX FIFO
+   is refilled as soon as packets are sent, so throughput
+   is limited by the air data rate rather than by the MCU.
+   Outcome of every packet (ACK received or maximum number
+   of retransmits reached) is reported through a result queue.
+
+   Any nRF24 receive example can be used on the other side.
+
+   For default module settings, see the wiki page
+   https://github.com/jgromes/RadioLib/wiki/Default-configuration#nrf24
+
+   For full API reference, see the GitHub Pages
+   https://jgromes.github.io/RadioLib/
+*/
+
+// include the library
+#include <RadioLib.h>
+
+// nRF24 has the following connections:
+// CS pin:    10
+// IRQ pin:   2
+// CE pin:    3
+nRF24 radio = new Module(10, 2, 3);
+
+// or using RadioShield
+// https://github.com/jgromes/RadioShield
+//nRF24 radio = RadioShield.ModuleA;
+
+// packet counters
+uint32_t sent = 0;
+uint32_t acked = 0;
+uint32_t failed = 0;
+uint32_t lastReport = 0;
+
+void setup() {
+  Serial.begin(9600);
+
+  // initialize nRF24 at 2 Mbps
+  // carrier frequency:           2400 MHz
+  // data rate:                   2000 kbps
+  // output power:                -12 dBm
+  // address width:               5 bytes
+  Serial.print(F("[nRF24] Initializing ... "));
+  int state = radio.begin(2400, 2000, -12, 5);
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // set transmit address
+  // NOTE: address width in bytes MUST be equal to the
+  //       width set in begin() or setAddressWidth()
+  //       methods (5 by default)
+  byte addr[] = {0x01, 0x23, 0x45, 0x67, 0x89};
+  Serial.print(F("[nRF24] Setting transmit pipe ... "));
+  state = radio.setTransmitPipe(addr);
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+
+  // start streaming mode
+  Serial.print(F("[nRF24] Starting stream ... "));
+  state = radio.startStream();
+  if(state == RADIOLIB_ERR_NONE) {
+    Serial.println(F("success!"));
+  } else {
+    Serial.print(F("failed, code "));
+    Serial.println(state);
+    while(true);
+  }
+}
+
+void loop() {
+  // keep the FIFO full
+  // NOTE: the last argument can be set to true
+  //       to send packets without requesting ACK
+  byte packet[32];
+  memcpy(packet, &sent, sizeof(sent));
+  if(radio.streamWrite(packet, 32, false) == RADIOLIB_ERR_NONE) {
+    sent++;
+  }
+
+  // move completed packets to result queue
+  radio.streamUpdate();
+
+  // process results
+  nRF24TxResult_t res;
+  while(radio.getTxResult(&res) == RADIOLIB_ERR_NONE) {
+    if(res.state == RADIOLIB_ERR_NONE) {
+      acked++;
+    } else {
+      failed++;
+    }
+  }
+
+  // report once per second
+  if(millis() - lastReport >= 1000) {
+    lastReport = millis();
+    Serial.print(F("[nRF24] Sent: "));
+    Serial.print(sent);
+    Serial.print(F(", ACKed: "));
+    Serial.print(acked);
+    Serial.print(F(", failed: "));
+    Serial.println(failed);
+  }
+}
@@ -0,0 +1,84 @@
+import sys, argparse
+from argparse import RawTextHelpFormatter
+
+
+# configurations swept by RangingClient::calibrate, in calTable order
+BANDWIDTHS = [406.25, 812.5, 1625.0]
+SPREADING_FACTORS = [5, 6, 7, 8, 9, 10]
+
+# default calibration from AN1200.29
+DEFAULT_TABLE = [
+    [10299, 10271, 10244, 10242, 10230, 10246],
+    [11486, 11474, 11453, 11426, 11417, 11401],
+    [13308, 13493, 13528, 13515, 13430, 13376]
+]
+
+
+def to_cal_value(val):
+    return max(0, min(65535, int(round(val))))
+
+
+def compute_cal(bw, points, distance):
+    # nominal step - one calibration LSB shifts the result by one raw result LSB
+    lsb = 150.0 / (4.096 * bw)
+    cals = sorted(set(p[0] for p in points))
+    if len(cals) == 1:
+        dist = sum(p[1] for p in points) / len(points)
+        return to_cal_value(cals[0] + (dist - distance) / lsb)
+
+    # multiple calibration values logged, fit the actual slope
+    n = len(points)
+    mean_cal = sum(p[0] for p in points) / n
+    mean_dist = sum(p[1] for p in points) / n
+    cov = sum((p[0] - mean_cal) * (p[1] - mean_dist) for p in points)
+    var = sum((p[0] - mean_cal) ** 2 for p in points)
+    slope = cov / var
+    if slope >= 0:
+        # nonsensical fit, fall back to nominal step
+        slope = -lsb
+    return to_cal_value(mean_cal + (distance - mean_dist) / slope)
+
+
+parser = argparse.ArgumentParser(formatter_class=RawTextHelpFormatter, description='''
+    RadioLib SX1280 ranging calibration script. Computes ranging calibration table from logged measurements.
+
+    The input file is CSV with one measurement per line in the following format:
+      bandwidth [kHz],spreading factor,calibration value,measured distance [m]
+    e.g. as printed by the SX128x_Ranging_Calibration example. Lines that do not match are ignored.
+
+    When only one calibration value was logged for a configuration, the nominal step is used
+    (same as the first step of RangingClient::calibrate). When more calibration values were logged,
+    the actual slope is fitted by least squares. Configurations without data keep the default value.
+
+    Output is printed as C array that can be passed to SX1280::range or RangingClient::setCalibration.
+''')
+parser.add_argument('file', metavar='file', type=str, help='CSV file with the logged measurements')
+parser.add_argument('distance', metavar='distance', type=float, help='Reference distance in meters at which the measurements were taken')
+args = parser.parse_args()
+
+# parse the log
+data = {}
+for line in open(args.file, 'r').readlines():
+    fields = line.strip().split(',')
+    if len(fields) != 4:
+        continue
+    try:
+        bw, sf, cal, dist = float(fields[0]), int(fields[1]), float(fields[2]), float(fields[3])
+    except ValueError:
+        continue
+    data.setdefault((bw, sf), []).append((cal, dist))
+
+# compute the table
+table = [row[:] for row in DEFAULT_TABLE]
+for b, bw in enumerate(BANDWIDTHS):
+    for s, sf in enumerate(SPREADING_FACTORS):
+        points = [p for key, pts in data.items() if abs(key[0] - bw) < 0.001 and key[1] == sf for p in pts]
+        if len(points) == 0:
+            print('No data for BW {0} kHz SF{1}, keeping default'.format(bw, sf), file=sys.stderr)
+            continue
+        table[b][s] = compute_cal(bw, points, args.distance)
+
+print('uint16_t calibration[3][6] = {')
+for b, row in enumerate(table):
+    print('  { ' + ', '.join('{0:5d}'.format(v) for v in row) + (' },' if b < 2 else ' }'))
+print('};')
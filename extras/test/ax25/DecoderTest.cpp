@@ -0,0 +1,183 @@
+/*
+  AX.25 decoder test
+
+  Feeds the recorded bitstreams in this directory into AX25Client::decodeByte and checks
+  the frames delivered by readFrame (and so parseFrame) against the lists in the matching .txt files:
+    - plain.bin       NRZI-encoded frames, separated by flags and line noise
+    - scrambled.bin   the same frames, also G3RUH-scrambled
+    - corrupted.bin   valid frames mixed with frames with bad FCS, aborted, misaligned, too short or too long frames,
+                      and one frame with correct FCS but invalid address field
+  The bitstreams are generated by GenerateBitstreams.py, independently of the library encoder.
+
+  Each stream is decoded twice. First, frames are read as soon as they are available, so all listed frames
+  must be delivered in order and none may be dropped. Then the whole stream is decoded without reading,
+  so the receive pool fills up and the rest of the frames must be counted by getDropped.
+  Exit code is non-zero if any check fails.
+
+  Build and run from the repository root:
+    g++ -std=gnu++11 -DARDUINO=100 -DRADIOLIB_CUSTOM_ARDUINO -Iextras/test/host -Isrc \
+      extras/test/host/HostPlatform.cpp extras/test/ax25/DecoderTest.cpp \
+      src/Module.cpp src/protocols/PhysicalLayer/PhysicalLayer.cpp src/protocols/AFSK/AFSK.cpp src/protocols/AX25/AX25.cpp \
+      -o DecoderTest && ./DecoderTest extras/test/ax25
+*/
+
+#include <RadioLib.h>
+
+#include <string>
+#include <vector>
+
+#include "HostPlatform.h"
+
+// the decoder does not use the radio, it only needs a physical layer to be constructed
+class DecoderPhy : public PhysicalLayer {
+  public:
+    DecoderPhy() : PhysicalLayer(1.0, RADIOLIB_AX25_RX_MAX_LENGTH) {}
+    Module* getMod() override { return(NULL); }
+};
+
+struct Bitstream {
+  const char* name;
+  bool scrambled;
+};
+
+static int failed = 0;
+
+#define CHECK(cond, ...) do { \
+    if(!(cond)) { \
+      printf("  FAIL: "); \
+      printf(__VA_ARGS__); \
+      printf("\n"); \
+      failed++; \
+    } \
+  } while(0)
+
+static std::vector<uint8_t> loadBits(const std::string& path) {
+  std::vector<uint8_t> data;
+  FILE* f = fopen(path.c_str(), "rb");
+  if(!f) {
+    return(data);
+  }
+  int c;
+  while((c = fgetc(f)) != EOF) {
+    data.push_back((uint8_t)c);
+  }
+  fclose(f);
+  return(data);
+}
+
+static std::vector<std::string> loadList(const std::string& path) {
+  std::vector<std::string> lines;
+  FILE* f = fopen(path.c_str(), "r");
+  if(!f) {
+    return(lines);
+  }
+  char buff[1024];
+  while(fgets(buff, sizeof(buff), f)) {
+    buff[strcspn(buff, "\r\n")] = '\0';
+    if(buff[0] != '\0') {
+      lines.push_back(buff);
+    }
+  }
+  fclose(f);
+  return(lines);
+}
+
+// print the frame in the format of the lists, so that it can be compared as a string
+static std::string describe(int16_t state, AX25Frame& frame) {
+  if(state == RADIOLIB_ERR_INVALID_FRAME) {
+    return("invalid");
+  } else if(state != RADIOLIB_ERR_NONE) {
+    return("error " + std::to_string(state));
+  }
+
+  // sequence numbers are split off by parseFrame
+  char buff[1024];
+  uint8_t control = frame.control | (frame.rcvSeqNumber << 5) | (frame.sendSeqNumber << 1);
+  bool hasPid = ((control & 0x01) == 0) || ((control & ~RADIOLIB_AX25_CONTROL_POLL_FINAL_ENABLED) == 0x03);
+  snprintf(buff, sizeof(buff), "frame %s %u %s %u %02X ", frame.destCallsign, frame.destSSID, frame.srcCallsign, frame.srcSSID, control);
+  std::string str = buff;
+  if(hasPid) {
+    snprintf(buff, sizeof(buff), "%02X ", frame.protocolID);
+    str += buff;
+  } else {
+    str += "- ";
+  }
+  if(frame.infoLen == 0) {
+    str += "-";
+  }
+  for(uint16_t i = 0; i < frame.infoLen; i++) {
+    snprintf(buff, sizeof(buff), "%02X", frame.info[i]);
+    str += buff;
+  }
+  for(uint8_t i = 0; i < frame.numRepeaters; i++) {
+    snprintf(buff, sizeof(buff), " %s %u", frame.repeaterCallsigns[i], frame.repeaterSSIDs[i]);
+    str += buff;
+  }
+  return(str);
+}
+
+static void testStream(const std::string& dir, const Bitstream& stream) {
+  std::vector<uint8_t> bits = loadBits(dir + "/" + stream.name + ".bin");
+  std::vector<std::string> expected = loadList(dir + "/" + stream.name + ".txt");
+  printf("%s: %u bytes, %u frames expected\n", stream.name, (unsigned)bits.size(), (unsigned)expected.size());
+  if(bits.empty() || expected.empty()) {
+    CHECK(false, "could not load %s.bin or %s.txt from %s", stream.name, stream.name, dir.c_str());
+    return;
+  }
+
+  DecoderPhy phy;
+  AX25Frame frame("", 0, "", 0, 0);
+
+  // read frames as soon as they are decoded
+  AX25Client reader(&phy);
+  CHECK(reader.startReceive(RADIOLIB_NC, stream.scrambled) == RADIOLIB_ERR_NONE, "startReceive failed");
+  size_t parsed = 0;
+  for(size_t i = 0; i < bits.size(); i++) {
+    reader.decodeByte(bits[i]);
+    while(reader.available() > 0) {
+      std::string got = describe(reader.readFrame(&frame), frame);
+      if(parsed < expected.size()) {
+        CHECK(got == expected[parsed], "frame %u\n    expected: %s\n    got:      %s", (unsigned)parsed, expected[parsed].c_str(), got.c_str());
+      }
+      CHECK(got.find(" 424144") == std::string::npos, "frame marked as BAD was accepted: %s", got.c_str());
+      parsed++;
+    }
+  }
+  printf("  read immediately: %u frames parsed, %u dropped\n", (unsigned)parsed, reader.getDropped());
+  CHECK(parsed == expected.size(), "%u frames parsed, expected %u", (unsigned)parsed, (unsigned)expected.size());
+  CHECK(reader.getDropped() == 0, "%u frames dropped, expected none", reader.getDropped());
+
+  // decode everything first, only the frames that fit into the pool are kept
+  AX25Client hoarder(&phy);
+  CHECK(hoarder.startReceive(RADIOLIB_NC, stream.scrambled) == RADIOLIB_ERR_NONE, "startReceive failed");
+  for(size_t i = 0; i < bits.size(); i++) {
+    hoarder.decodeByte(bits[i]);
+  }
+  size_t kept = min(expected.size(), (size_t)RADIOLIB_AX25_RX_POOL_SIZE);
+  size_t dropped = expected.size() - kept;
+  size_t avail = hoarder.available();
+  printf("  read at the end:  %u frames kept, %u dropped\n", (unsigned)avail, hoarder.getDropped());
+  CHECK(avail == kept, "%u frames in pool, expected %u", (unsigned)avail, (unsigned)kept);
+  CHECK(hoarder.getDropped() == dropped, "%u frames dropped, expected %u", hoarder.getDropped(), (unsigned)dropped);
+  for(size_t i = 0; (i < kept) && (hoarder.available() > 0); i++) {
+    std::string got = describe(hoarder.readFrame(&frame), frame);
+    CHECK(got == expected[i], "pool frame %u\n    expected: %s\n    got:      %s", (unsigned)i, expected[i].c_str(), got.c_str());
+  }
+  CHECK(hoarder.readFrame(&frame) == RADIOLIB_ERR_QUEUE_EMPTY, "pool not empty after reading all frames");
+}
+
+int main(int argc, char** argv) {
+  std::string dir = (argc > 1) ? argv[1] : ".";
+  const Bitstream streams[] = {
+    { "plain", false },
+    { "scrambled", true },
+    { "corrupted", false },
+  };
+
+  for(size_t i = 0; i < sizeof(streams) / sizeof(streams[0]); i++) {
+    testStream(dir, streams[i]);
+  }
+
+  printf("%d failed\n", failed);
+  return(failed ? 1 : 0);
+}
@@ -0,0 +1,368 @@
+/*
+  AX.25 encoder benchmark
+
+  Compares the table-driven encoder used by AX25Client::sendFrame with the previous bit-by-bit encoder,
+  which is kept below as ReferenceEncoder (copied from sendFrame before commit 581320d).
+  Frames are captured from PhysicalLayer::transmit, so the whole sendFrame path is measured.
+
+  The output of both encoders must match exactly. The previous encoder had two bugs fixed by the new one,
+  so the reference is run with those fixed:
+    - NRZI encoding started at bit (preamble length + 1) instead of byte, leaving most of the preamble
+      flags unencoded. The reference encodes all bits starting from level 0, as the new encoder does.
+      The verbatim behavior is also checked: its NRZI-decoded output must match from the end of the preamble on.
+    - the output buffer was too short for frames made mostly of 1s, the reference allocates enough.
+
+  First, a few thousand random frames dense in 0xFF, 0x7E and 0xFC bytes (worst case for bit stuffing) are compared,
+  then both encoders are timed on typical frames. Exit code is non-zero if any output differs.
+
+  Build and run from the repository root:
+    g++ -std=gnu++11 -O2 -DARDUINO=100 -DRADIOLIB_CUSTOM_ARDUINO -Iextras/test/host -Isrc \
+      extras/test/host/HostPlatform.cpp extras/test/ax25/EncoderBench.cpp \
+      src/Module.cpp src/protocols/PhysicalLayer/PhysicalLayer.cpp src/protocols/AFSK/AFSK.cpp src/protocols/AX25/AX25.cpp \
+      -o EncoderBench && ./EncoderBench
+*/
+
+#include <RadioLib.h>
+
+#include <chrono>
+#include <vector>
+
+#include "HostPlatform.h"
+
+// keeps the last transmitted packet, no radio is involved
+class CapturePhy : public PhysicalLayer {
+  public:
+    std::vector<uint8_t> packet;
+
+    CapturePhy() : PhysicalLayer(1.0, 0xFFFF) {}
+    Module* getMod() override { return(NULL); }
+    int16_t transmit(uint8_t* data, size_t len, uint8_t addr = 0) override { (void)addr; packet.assign(data, data + len); return(RADIOLIB_ERR_NONE); }
+    int16_t setFrequencyDeviation(float freqDev) override { (void)freqDev; return(RADIOLIB_ERR_NONE); }
+    int16_t setDataShaping(uint8_t sh) override { (void)sh; return(RADIOLIB_ERR_NONE); }
+    int16_t setEncoding(uint8_t encoding) override { (void)encoding; return(RADIOLIB_ERR_NONE); }
+};
+
+class ReferenceEncoder {
+  public:
+    explicit ReferenceEncoder(uint8_t preambleLen) : _preambleLen(preambleLen) {}
+
+    /*
+      Previous AX25Client::sendFrame, from building the frame buffer up to NRZI encoding.
+      Set verbatim to reproduce the original NRZI start position.
+    */
+    std::vector<uint8_t> encode(AX25Frame* frame, bool verbatim = false) {
+      // calculate frame length without FCS (destination address, source address, repeater addresses, control, PID, info)
+      size_t frameBuffLen = ((2 + frame->numRepeaters)*(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1)) + 1 + frame->infoLen;
+      if(frame->protocolID != 0x00) {
+        frameBuffLen++;
+      }
+      // create frame buffer without preamble, start or stop flags
+      uint8_t* frameBuff = new uint8_t[frameBuffLen + 2];
+      uint8_t* frameBuffPtr = frameBuff;
+
+      // set destination callsign - all address field bytes are shifted by one bit to make room for HDLC address extension bit
+      memset(frameBuffPtr, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+      for(size_t i = 0; i < strlen(frame->destCallsign); i++) {
+        *(frameBuffPtr + i) = frame->destCallsign[i] << 1;
+      }
+      frameBuffPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN;
+
+      // set destination SSID
+      *(frameBuffPtr++) = RADIOLIB_AX25_SSID_RESPONSE_DEST | RADIOLIB_AX25_SSID_RESERVED_BITS | (frame->destSSID & 0x0F) << 1 | RADIOLIB_AX25_SSID_HDLC_EXTENSION_CONTINUE;
+
+      // set source callsign - all address field bytes are shifted by one bit to make room for HDLC address extension bit
+      memset(frameBuffPtr, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+      for(size_t i = 0; i < strlen(frame->srcCallsign); i++) {
+        *(frameBuffPtr + i) = frame->srcCallsign[i] << 1;
+      }
+      frameBuffPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN;
+
+      // set source SSID
+      *(frameBuffPtr++) = RADIOLIB_AX25_SSID_COMMAND_SOURCE | RADIOLIB_AX25_SSID_RESERVED_BITS | (frame->srcSSID & 0x0F) << 1 | RADIOLIB_AX25_SSID_HDLC_EXTENSION_CONTINUE;
+
+      // set repeater callsigns
+      for(uint16_t i = 0; i < frame->numRepeaters; i++) {
+        memset(frameBuffPtr, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+        for(size_t j = 0; j < strlen(frame->repeaterCallsigns[i]); j++) {
+          *(frameBuffPtr + j) = frame->repeaterCallsigns[i][j] << 1;
+        }
+        frameBuffPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN;
+        *(frameBuffPtr++) = RADIOLIB_AX25_SSID_HAS_NOT_BEEN_REPEATED | RADIOLIB_AX25_SSID_RESERVED_BITS | (frame->repeaterSSIDs[i] & 0x0F) << 1 | RADIOLIB_AX25_SSID_HDLC_EXTENSION_CONTINUE;
+      }
+
+      // set HDLC extension end bit
+      *(frameBuffPtr - 1) |= RADIOLIB_AX25_SSID_HDLC_EXTENSION_END;
+
+      // set sequence numbers of the frames that have it
+      uint8_t controlField = frame->control;
+      if((frame->control & 0x01) == 0) {
+        // information frame, set both sequence numbers
+        controlField |= frame->rcvSeqNumber << 5;
+        controlField |= frame->sendSeqNumber << 1;
+      } else if((frame->control & 0x02) == 0) {
+        // supervisory frame, set only receive sequence number
+        controlField |= frame->rcvSeqNumber << 5;
+      }
+
+      // set control field
+      *(frameBuffPtr++) = controlField;
+
+      // set PID field of the frames that have it
+      if(frame->protocolID != 0x00) {
+        *(frameBuffPtr++) = frame->protocolID;
+      }
+
+      // set info field of the frames that have it
+      if(frame->infoLen > 0) {
+        memcpy(frameBuffPtr, frame->info, frame->infoLen);
+        frameBuffPtr += frame->infoLen;
+      }
+
+      // flip bit order
+      for(size_t i = 0; i < frameBuffLen; i++) {
+        frameBuff[i] = Module::flipBits(frameBuff[i]);
+      }
+
+      // calculate FCS
+      uint16_t fcs = getFrameCheckSequence(frameBuff, frameBuffLen);
+      *(frameBuffPtr++) = (uint8_t)((fcs >> 8) & 0xFF);
+      *(frameBuffPtr++) = (uint8_t)(fcs & 0xFF);
+
+      // prepare buffer for the final frame (stuffed, with added preamble + flags and NRZI-encoded)
+      // the original allocated (6*frameBuffLen)/5 bytes for the stuffed frame, which is not enough for the FCS and end flag
+      size_t stuffedFrameBuffSize = _preambleLen + 1 + (6*(frameBuffLen + 2))/5 + 3;
+      uint8_t* stuffedFrameBuff = new uint8_t[stuffedFrameBuffSize];
+
+      // initialize buffer to all zeros
+      memset(stuffedFrameBuff, 0x00, stuffedFrameBuffSize);
+
+      // stuff bits (skip preamble and both flags)
+      uint16_t stuffedFrameBuffLenBits = 8*(_preambleLen + 1);
+      uint8_t count = 0;
+      for(size_t i = 0; i < frameBuffLen + 2; i++) {
+        for(int8_t shift = 7; shift >= 0; shift--) {
+          uint16_t stuffedFrameBuffPos = stuffedFrameBuffLenBits + 7 - 2*(stuffedFrameBuffLenBits%8);
+          if((frameBuff[i] >> shift) & 0x01) {
+            // copy 1 and increment counter
+            SET_BIT_IN_ARRAY(stuffedFrameBuff, stuffedFrameBuffPos);
+            stuffedFrameBuffLenBits++;
+            count++;
+
+            // check 5 consecutive 1s
+            if(count == 5) {
+              // get the new position in stuffed frame
+              stuffedFrameBuffPos = stuffedFrameBuffLenBits + 7 - 2*(stuffedFrameBuffLenBits%8);
+
+              // insert 0 and reset counter
+              CLEAR_BIT_IN_ARRAY(stuffedFrameBuff, stuffedFrameBuffPos);
+              stuffedFrameBuffLenBits++;
+              count = 0;
+            }
+
+          } else {
+            // copy 0 and reset counter
+            CLEAR_BIT_IN_ARRAY(stuffedFrameBuff, stuffedFrameBuffPos);
+            stuffedFrameBuffLenBits++;
+            count = 0;
+          }
+
+        }
+      }
+
+      // deallocate memory
+      delete[] frameBuff;
+
+      // set preamble bytes and start flag field
+      for(uint16_t i = 0; i < _preambleLen + 1; i++) {
+        stuffedFrameBuff[i] = RADIOLIB_AX25_FLAG;
+      }
+
+      // get stuffed frame length in bytes
+      size_t stuffedFrameBuffLen = stuffedFrameBuffLenBits/8 + 1;
+      uint8_t trailingLen = stuffedFrameBuffLenBits % 8;
+
+      // set end flag field (may be split into two bytes due to misalignment caused by extra stuffing bits)
+      if(trailingLen != 0) {
+        stuffedFrameBuffLen++;
+        stuffedFrameBuff[stuffedFrameBuffLen - 2] |= RADIOLIB_AX25_FLAG >> trailingLen;
+        stuffedFrameBuff[stuffedFrameBuffLen - 1] = RADIOLIB_AX25_FLAG << (8 - trailingLen);
+      } else {
+        stuffedFrameBuff[stuffedFrameBuffLen - 1] = RADIOLIB_AX25_FLAG;
+      }
+
+      // convert to NRZI
+      // the original started at bit _preambleLen + 1, fixed version starts at the first bit from level 0
+      size_t nrziStart = verbatim ? _preambleLen + 1 : 0;
+      for(size_t i = nrziStart; i < stuffedFrameBuffLen*8; i++) {
+        size_t currBitPos = i + 7 - 2*(i%8);
+        bool prevBit = false;
+        if(i > 0) {
+          size_t prevBitPos = (i - 1) + 7 - 2*((i - 1)%8);
+          prevBit = TEST_BIT_IN_ARRAY(stuffedFrameBuff, prevBitPos);
+        }
+        if(TEST_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos)) {
+          // bit is 1, no change, copy previous bit
+          if(prevBit) {
+            SET_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos);
+          } else {
+            CLEAR_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos);
+          }
+
+        } else {
+          // bit is 0, transition, copy inversion of the previous bit
+          if(prevBit) {
+            CLEAR_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos);
+          } else {
+            SET_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos);
+          }
+        }
+      }
+
+      std::vector<uint8_t> out(stuffedFrameBuff, stuffedFrameBuff + stuffedFrameBuffLen);
+      delete[] stuffedFrameBuff;
+      return(out);
+    }
+
+  private:
+    uint8_t _preambleLen;
+
+    /*
+      CCITT CRC implementation based on https://github.com/kicksat/ax25
+
+      Licensed under Creative Commons Attribution-ShareAlike 4.0 International
+      https://creativecommons.org/licenses/by-sa/4.0/
+    */
+    static uint16_t getFrameCheckSequence(uint8_t* buff, size_t len) {
+      uint8_t outBit;
+      uint16_t mask;
+      uint16_t shiftReg = CRC_CCITT_INIT;
+
+      for(size_t i = 0; i < len; i++) {
+        for(uint8_t b = 0x80; b > 0x00; b /= 2) {
+          outBit = (shiftReg & 0x01) ? 0x01 : 0x00;
+          shiftReg >>= 1;
+          mask = XOR((buff[i] & b), outBit) ? CRC_CCITT_POLY_REVERSED : 0x0000;
+          shiftReg ^= mask;
+        }
+      }
+
+      return(Module::flipBits16(~shiftReg));
+    }
+};
+
+// bit i of NRZI-decoded stream, 1 when the level did not change
+static uint8_t nrziBit(const std::vector<uint8_t>& data, size_t i) {
+  uint8_t curr = (data[i / 8] >> (7 - i % 8)) & 0x01;
+  uint8_t prev = (data[(i - 1) / 8] >> (7 - (i - 1) % 8)) & 0x01;
+  return(curr == prev);
+}
+
+static int compare(CapturePhy& phy, AX25Client& client, ReferenceEncoder& ref, AX25Frame& frame, uint8_t preambleLen) {
+  std::vector<uint8_t> expected = ref.encode(&frame);
+  phy.packet.clear();
+  client.sendFrame(&frame);
+  if(phy.packet != expected) {
+    printf("  FAIL: %u byte info field, output differs from reference (%u vs. %u bytes)\n", frame.infoLen, (unsigned)phy.packet.size(), (unsigned)expected.size());
+    return(1);
+  }
+
+  // the original encoder only differs in the preamble, the rest has the same transitions
+  std::vector<uint8_t> verbatim = ref.encode(&frame, true);
+  if(verbatim.size() != expected.size()) {
+    printf("  FAIL: %u byte info field, length differs from verbatim reference\n", frame.infoLen);
+    return(1);
+  }
+  for(size_t i = 8*(preambleLen + 1); i < 8*verbatim.size(); i++) {
+    if(nrziBit(verbatim, i) != nrziBit(phy.packet, i)) {
+      printf("  FAIL: %u byte info field, decoded bit %u differs from verbatim reference\n", frame.infoLen, (unsigned)i);
+      return(1);
+    }
+  }
+  return(0);
+}
+
+template<typename F> static double timePerCall(F func, size_t num) {
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < num; i++) {
+    func();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return(std::chrono::duration<double, std::micro>(end - start).count() / num);
+}
+
+int main() {
+  int failed = 0;
+  const uint8_t preambleLens[] = { 0, 1, 8, 32 };
+  char repeater1[] = "WIDE1";
+  char repeater2[] = "WIDE2";
+  char* repeaters[] = { repeater1, repeater2 };
+  uint8_t repeaterSSIDs[] = { 1, 2 };
+
+  // random frames, bytes that produce long runs of 1s are frequent
+  srand(1);
+  size_t num = 0;
+  for(size_t p = 0; p < sizeof(preambleLens) / sizeof(preambleLens[0]); p++) {
+    CapturePhy phy;
+    AX25Client client(&phy);
+    client.begin("N0CALL", 7, preambleLens[p]);
+    ReferenceEncoder ref(preambleLens[p]);
+    for(int k = 0; k < 1000; k++) {
+      uint8_t info[256];
+      uint16_t len = rand() % 257;
+      for(uint16_t i = 0; i < len; i++) {
+        int r = rand() % 4;
+        info[i] = (r == 0) ? 0xFF : (r == 1) ? 0x7E : (r == 2) ? 0xFC : (uint8_t)rand();
+      }
+      AX25Frame frame("APRS", rand() % 16, "N0CALL", rand() % 16, RADIOLIB_AX25_CONTROL_U_UNNUMBERED_INFORMATION, RADIOLIB_AX25_PID_NO_LAYER_3, info, len);
+      if(k % 3 == 0) {
+        frame.setRepeaters(repeaters, repeaterSSIDs, 2);
+      }
+      failed += compare(phy, client, ref, frame, preambleLens[p]);
+      num++;
+    }
+
+    // supervisory frame, without PID and info field
+    AX25Frame rr("N1CALL", 1, "N0CALL", 7, RADIOLIB_AX25_CONTROL_S_RECEIVE_READY | RADIOLIB_AX25_CONTROL_SUPERVISORY_FRAME);
+    rr.setRecvSequence(5);
+    failed += compare(phy, client, ref, rr, preambleLens[p]);
+    num++;
+  }
+  printf("%u frames compared, %d differ\n", (unsigned)num, failed);
+
+  // timing of the whole path from frame to encoded packet
+  CapturePhy phy;
+  AX25Client client(&phy);
+  client.begin("N0CALL", 7);
+  ReferenceEncoder ref(8);
+
+  char beacon[] = "!4903.50N/07201.75W-Test 001234 RadioLib APRS beacon with some comment text";
+  uint8_t random[256];
+  uint8_t ones[256];
+  for(size_t i = 0; i < sizeof(random); i++) {
+    random[i] = (uint8_t)rand();
+    ones[i] = 0xFF;
+  }
+  struct {
+    const char* name;
+    uint8_t* info;
+    uint16_t len;
+  } cases[] = {
+    { "APRS beacon", (uint8_t*)beacon, (uint16_t)strlen(beacon) },
+    { "256 random bytes", random, sizeof(random) },
+    { "256 bytes of 0xFF", ones, sizeof(ones) },
+  };
+
+  printf("%-20s %12s %12s %8s\n", "info field", "old us", "new us", "speedup");
+  for(size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    AX25Frame frame("APRS", 0, "N0CALL", 7, RADIOLIB_AX25_CONTROL_U_UNNUMBERED_INFORMATION, RADIOLIB_AX25_PID_NO_LAYER_3, cases[i].info, cases[i].len);
+    failed += compare(phy, client, ref, frame, 8);
+    size_t calls = 200000 / (1 + cases[i].len / 32);
+    volatile size_t sink = 0;
+    double oldUs = timePerCall([&]() { sink += ref.encode(&frame).size(); }, calls);
+    double newUs = timePerCall([&]() { client.sendFrame(&frame); sink += phy.packet.size(); }, calls);
+    printf("%-20s %12.2f %12.2f %7.1fx\n", cases[i].name, oldUs, newUs, oldUs / newUs);
+  }
+
+  printf("%d failed\n", failed);
+  return(failed ? 1 : 0);
+}
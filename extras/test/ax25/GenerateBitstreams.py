@@ -0,0 +1,247 @@
+import os, random, argparse
+from argparse import RawTextHelpFormatter
+
+
+'''
+Generates the bitstreams used by DecoderTest.cpp. The frames are encoded
+by this script, independently of the library encoder: FCS, bit stuffing,
+NRZI and G3RUH scrambling are implemented below from the AX.25 and G3RUH
+specifications. Output is deterministic, so the committed files can be
+regenerated and compared.
+
+Each stream is saved as <name>.bin, bits as sent over the air packed
+most significant bit first (the order of AX25Client::decodeByte),
+and <name>.txt, listing the frames the decoder must deliver, in order:
+    frame <dest> <destSSID> <src> <srcSSID> <control> <pid> <info hex> [<repeater> <SSID> ...]
+    invalid
+where "invalid" is a frame with good FCS that readFrame rejects, and "-"
+stands for an empty info field or missing PID.
+'''
+
+FLAG = 0x7E
+SEED = 0xA25
+
+
+def fcs(data):
+    # CRC-16/X.25 - reflected CCITT polynomial, inverted, sent low byte first
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0x8408 if crc & 1 else crc >> 1
+    crc ^= 0xFFFF
+    return bytes([crc & 0xFF, crc >> 8])
+
+
+def address(call, ssid, last):
+    call = call.ljust(6)
+    return bytes([ord(c) << 1 for c in call]) + bytes([0x60 | (ssid << 1) | (1 if last else 0)])
+
+
+class Frame:
+    def __init__(self, dest, src, control, pid=None, info=b'', repeaters=()):
+        self.dest = dest
+        self.src = src
+        self.control = control
+        self.pid = pid
+        self.info = info
+        self.repeaters = list(repeaters)
+
+    def contents(self):
+        addrs = [self.dest, self.src] + self.repeaters
+        data = b''
+        for i, (call, ssid) in enumerate(addrs):
+            data += address(call, ssid, i == len(addrs) - 1)
+        data += bytes([self.control])
+        if self.pid is not None:
+            data += bytes([self.pid])
+        return data + self.info
+
+    def manifest(self):
+        line = 'frame {} {} {} {} {:02X} {} {}'.format(
+            self.dest[0], self.dest[1], self.src[0], self.src[1], self.control,
+            '-' if self.pid is None else '{:02X}'.format(self.pid),
+            self.info.hex().upper() if self.info else '-')
+        for call, ssid in self.repeaters:
+            line += ' {} {}'.format(call, ssid)
+        return line
+
+
+def lsb_bits(data):
+    for b in data:
+        for i in range(8):
+            yield (b >> i) & 1
+
+
+def stuffed(data):
+    # a 0 is inserted after five consecutive 1s
+    ones = 0
+    for bit in lsb_bits(data):
+        yield bit
+        ones = ones + 1 if bit else 0
+        if ones == 5:
+            yield 0
+            ones = 0
+
+
+class Stream:
+    def __init__(self, scrambled=False):
+        self.bits = []
+        self.level = 0
+        self.scrambled = scrambled
+        self.scrambler = 0
+
+    def raw(self, bits):
+        # NRZI - 0 is a transition, 1 is no transition
+        for bit in bits:
+            if not bit:
+                self.level ^= 1
+            out = self.level
+            if self.scrambled:
+                # G3RUH, polynomial x^17 + x^12 + 1, applied after NRZI
+                out ^= ((self.scrambler >> 11) ^ (self.scrambler >> 16)) & 1
+                self.scrambler = ((self.scrambler << 1) | out) & 0x1FFFF
+            self.bits.append(out)
+
+    def flags(self, num):
+        for _ in range(num):
+            self.raw(lsb_bits([FLAG]))
+
+    def frame(self, data, fcs_bytes=None):
+        self.raw(stuffed(data + (fcs(data) if fcs_bytes is None else fcs_bytes)))
+
+    def noise(self, rng, num):
+        # line noise is random on air, so it is not NRZI-encoded or scrambled
+        for _ in range(num):
+            self.bits.append(rng.getrandbits(1))
+
+    def packed(self):
+        bits = self.bits + [0] * (-len(self.bits) % 8)
+        out = bytearray()
+        for i in range(0, len(bits), 8):
+            b = 0
+            for bit in bits[i:i + 8]:
+                b = (b << 1) | bit
+            out.append(b)
+        return bytes(out)
+
+
+def good_frames():
+    frames = [
+        Frame(('APRS', 0), ('N0CALL', 7), 0x03, 0xF0, b'!4903.50N/07201.75W-Test 001', [('WIDE1', 1), ('WIDE2', 2)]),
+        Frame(('CQ', 0), ('N0CALL', 0), 0x03, 0xF0, bytes(range(256))),
+        Frame(('N1CALL', 1), ('N0CALL', 2), (5 << 5) | 0x10 | (3 << 1), 0xF0, b'information frame'),
+        Frame(('N1CALL', 1), ('N0CALL', 2), (2 << 5) | 0x01),
+        Frame(('N1CALL', 1), ('N0CALL', 2), 0x3F),
+        Frame(('BEACON', 15), ('N0CALL', 3), 0x13, 0xF0, b'\xFF' * 20 + b'\x7E\x7D\x3F\xFC',
+              [('RPT{}'.format(i), i) for i in range(8)]),
+    ]
+    for i in range(6):
+        frames.append(Frame(('APRS', 0), ('N0CALL', 9), 0x03, 0xF0, 'frame {}'.format(i).encode()))
+    return frames
+
+
+def write(path, name, stream, manifest):
+    with open(os.path.join(path, name + '.bin'), 'wb') as f:
+        f.write(stream.packed())
+    with open(os.path.join(path, name + '.txt'), 'w') as f:
+        f.write('\n'.join(manifest) + '\n')
+
+
+def clean(path, name, scrambled):
+    # flags between frames vary from a single shared flag to a long run, noise between some of them
+    rng = random.Random(SEED + scrambled)
+    stream = Stream(scrambled)
+    stream.noise(rng, 200)
+    stream.flags(24)
+    manifest = []
+    for i, frame in enumerate(good_frames()):
+        stream.frame(frame.contents())
+        manifest.append(frame.manifest())
+        stream.flags(1 + (i % 3) * 4)
+        if i % 4 == 3:
+            stream.noise(rng, 100)
+            stream.flags(8)
+    stream.flags(4)
+    stream.noise(rng, 200)
+    write(path, name, stream, manifest)
+
+
+def corrupted(path):
+    rng = random.Random(SEED + 2)
+    stream = Stream()
+    stream.noise(rng, 200)
+    stream.flags(24)
+    manifest = []
+    for i in range(4):
+        good = Frame(('APRS', 0), ('N0CALL', 1), 0x03, 0xF0, 'GOOD {}'.format(i).encode())
+        bad = Frame(('APRS', 0), ('N0CALL', 1), 0x03, 0xF0, 'BAD {} corrupted in transit'.format(i).encode())
+        data = bytearray(bad.contents())
+        crc = fcs(bytes(data))
+        if i == 0:
+            # single bit error in the info field
+            data[20] ^= 0x04
+        elif i == 1:
+            # burst error across address and control
+            data[12] ^= 0xFF
+            data[13] ^= 0x0F
+        elif i == 2:
+            # error in the FCS itself
+            crc = bytes([crc[0] ^ 0x80, crc[1]])
+        else:
+            # FCS sent in the wrong byte order
+            crc = bytes([crc[1], crc[0]])
+        stream.frame(bytes(data), crc)
+        stream.flags(2)
+        stream.frame(good.contents())
+        manifest.append(good.manifest())
+        stream.flags(2)
+
+    # aborted frame - seven 1s in a row after the FCS
+    stream.frame(Frame(('APRS', 0), ('N0CALL', 1), 0x03, 0xF0, b'BAD aborted').contents())
+    stream.raw([1] * 8)
+    stream.flags(2)
+
+    # frame that does not end on a byte boundary - three extra bits after the FCS
+    stream.frame(Frame(('APRS', 0), ('N0CALL', 1), 0x03, 0xF0, b'BAD misaligned').contents())
+    stream.raw([0, 1, 0])
+    stream.flags(2)
+
+    # too short to be a frame, FCS is correct
+    stream.frame(b'BAD short')
+    stream.flags(2)
+
+    # too long for the receive pool slot, FCS is correct
+    stream.frame(Frame(('APRS', 0), ('N0CALL', 1), 0x03, 0xF0, b'BAD ' + bytes(330)).contents())
+    stream.flags(2)
+
+    # correct FCS, but the address field never ends
+    stream.frame(bytes([0x82] * 17) + b'BAD')
+    manifest.append('invalid')
+    stream.flags(2)
+
+    last = Frame(('APRS', 0), ('N0CALL', 1), 0x03, 0xF0, b'GOOD last')
+    stream.frame(last.contents())
+    manifest.append(last.manifest())
+    stream.flags(4)
+    stream.noise(rng, 200)
+    write(path, 'corrupted', stream, manifest)
+
+
+def main():
+    parser = argparse.ArgumentParser(formatter_class=RawTextHelpFormatter, description='''
+        RadioLib AX.25 decoder test bitstream generator.
+
+        Writes plain (NRZI), scrambled (NRZI and G3RUH) and corrupted bitstreams
+        together with the lists of frames the decoder is expected to deliver.
+    ''')
+    parser.add_argument('--out', default=os.path.dirname(os.path.abspath(__file__)), help='Output directory, defaults to the directory of this script')
+    args = parser.parse_args()
+
+    clean(args.out, 'plain', False)
+    clean(args.out, 'scrambled', True)
+    corrupted(args.out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,365 @@
+#if !defined(_RADIOLIB_CC1101_MODEL_H)
+#define _RADIOLIB_CC1101_MODEL_H
+
+#include <deque>
+
+#include "Arduino.h"
+#include "HostPlatform.h"
+
+// register map
+#define CC1101_MODEL_NUM_REGS                         0x2F
+#define CC1101_MODEL_REG_IOCFG0                       0x02
+#define CC1101_MODEL_REG_FIFOTHR                      0x03
+#define CC1101_MODEL_REG_PKTCTRL1                     0x07
+#define CC1101_MODEL_REG_PKTCTRL0                     0x08
+#define CC1101_MODEL_REG_MDMCFG4                      0x10
+#define CC1101_MODEL_REG_MDMCFG3                      0x11
+#define CC1101_MODEL_REG_MCSM1                        0x17
+#define CC1101_MODEL_REG_PARTNUM                      0x30
+#define CC1101_MODEL_REG_VERSION                      0x31
+#define CC1101_MODEL_REG_RSSI                         0x34
+#define CC1101_MODEL_REG_MARCSTATE                    0x35
+#define CC1101_MODEL_REG_TXBYTES                      0x3A
+#define CC1101_MODEL_REG_RXBYTES                      0x3B
+#define CC1101_MODEL_REG_PATABLE                      0x3E
+#define CC1101_MODEL_REG_FIFO                         0x3F
+
+// command strobes
+#define CC1101_MODEL_CMD_RESET                        0x30
+#define CC1101_MODEL_CMD_FSTXON                       0x31
+#define CC1101_MODEL_CMD_RX                           0x34
+#define CC1101_MODEL_CMD_TX                           0x35
+#define CC1101_MODEL_CMD_IDLE                         0x36
+#define CC1101_MODEL_CMD_POWER_DOWN                   0x39
+#define CC1101_MODEL_CMD_FLUSH_RX                     0x3A
+#define CC1101_MODEL_CMD_FLUSH_TX                     0x3B
+#define CC1101_MODEL_CMD_NOP                          0x3D
+
+// MARCSTATE values
+#define CC1101_MODEL_MARC_IDLE                        0x01
+#define CC1101_MODEL_MARC_RX                          0x0D
+#define CC1101_MODEL_MARC_RXFIFO_OVERFLOW             0x11
+#define CC1101_MODEL_MARC_FSTXON                      0x12
+#define CC1101_MODEL_MARC_TX                          0x13
+
+#define CC1101_MODEL_FIFO_SIZE                        64
+#define CC1101_MODEL_CRYSTAL_FREQ                     26000000.0
+#define CC1101_MODEL_VERSION                          0x14
+
+// appended status bytes
+#define CC1101_MODEL_RSSI                             0xD0
+#define CC1101_MODEL_LQI                              0x2A
+#define CC1101_MODEL_CRC_OK                           0x80
+
+/*!
+  \class CC1101Model
+
+  \brief SPI-level model of CC1101 receiver, driven by host platform virtual time.
+  Models register access, command strobes, Rx FIFO and the GDO0 "Rx FIFO threshold or packet end" signal.
+  Packets arrive one byte at a time at the configured bit rate, the two CRC bytes take two more byte periods
+  and then the RSSI and LQI/CRC status bytes are appended at once, as the real chip does.
+  Modulation, sync word detection and Tx are not modelled.
+*/
+class CC1101Model : public HostDevice {
+  public:
+    /*!
+      \brief Default constructor.
+
+      \param gdo0 Host pin number the library uses for GDO0.
+    */
+    explicit CC1101Model(uint8_t gdo0) : _gdo0(gdo0) {
+      reset();
+    }
+
+    /*!
+      \brief Start receiving a packet over the air.
+      Length byte is prepended in variable packet length mode.
+
+      \param data Packet payload, including address byte when address filtering is used.
+
+      \param len Payload length in bytes.
+
+      \param delayUs Time from now until the first byte is in Rx FIFO (preamble and sync word).
+
+      \param crcOk Value of CRC_OK flag in the appended status byte.
+    */
+    void receive(const uint8_t* data, size_t len, uint32_t delayUs, bool crcOk = true) {
+      uint32_t period = getBytePeriod();
+      uint32_t at = hostMicros() + delayUs;
+      if((_regs[CC1101_MODEL_REG_PKTCTRL0] & 0x03) == 0x01) {
+        queue(at, (uint8_t)len, false);
+        at += period;
+      }
+      for(size_t i = 0; i < len; i++) {
+        queue(at, data[i], false);
+        at += period;
+      }
+
+      // CRC bytes are not put in FIFO, status bytes replace them
+      at += period;
+      queue(at, CC1101_MODEL_RSSI, true);
+      queue(at, CC1101_MODEL_LQI | (crcOk ? CC1101_MODEL_CRC_OK : 0x00), true);
+    }
+
+    /*!
+      \brief Get time of one byte on air.
+
+      \returns Byte period in microseconds at the bit rate currently set in MDMCFG4/MDMCFG3.
+    */
+    uint32_t getBytePeriod() const {
+      uint8_t e = _regs[CC1101_MODEL_REG_MDMCFG4] & 0x0F;
+      uint8_t m = _regs[CC1101_MODEL_REG_MDMCFG3];
+      double br = (256.0 + m) * (double)(1UL << e) * CC1101_MODEL_CRYSTAL_FREQ / (double)(1UL << 28);
+      return((uint32_t)(8000000.0 / br + 0.5));
+    }
+
+    /*!
+      \brief Get time when the status bytes of the last packet were put in Rx FIFO.
+
+      \returns Virtual time in microseconds.
+    */
+    uint32_t getPacketEnd() const {
+      return(_packetEnd);
+    }
+
+    /*!
+      \brief Check whether status bytes of the last packet were put in Rx FIFO.
+
+      \returns True once the packet has ended.
+    */
+    bool isPacketEnded() const {
+      return(_ended);
+    }
+
+    /*!
+      \brief Get number of bytes the library read from Rx FIFO since the last reset.
+
+      \returns Number of Rx FIFO bytes read.
+    */
+    size_t getFifoReads() const {
+      return(_fifoReads);
+    }
+
+    /*!
+      \brief Get number of Rx FIFO reads while FIFO was empty (Rx FIFO underflow).
+
+      \returns Number of empty FIFO reads.
+    */
+    size_t getUnderflows() const {
+      return(_underflows);
+    }
+
+    void select() override {
+      _index = 0;
+    }
+
+    uint8_t transfer(uint8_t b) override {
+      // first byte is header, strobes have no data
+      if(_index++ == 0) {
+        _read = b & 0x80;
+        _burst = b & 0x40;
+        _addr = b & 0x3F;
+        if((_addr >= CC1101_MODEL_CMD_RESET) && (_addr <= CC1101_MODEL_CMD_NOP) && !_burst) {
+          strobe(_addr);
+        }
+        return(chipStatus());
+      }
+
+      if(_addr == CC1101_MODEL_REG_FIFO) {
+        if(!_read) {
+          return(chipStatus());
+        }
+        _fifoReads++;
+        if(_rxFifo.empty()) {
+          _underflows++;
+          return(0x00);
+        }
+        uint8_t val = _rxFifo.front();
+        _rxFifo.pop_front();
+        return(val);
+      }
+
+      if(_addr == CC1101_MODEL_REG_PATABLE) {
+        if(!_read) {
+          _patable = b;
+        }
+        return(_patable);
+      }
+
+      if(_addr >= CC1101_MODEL_REG_PARTNUM) {
+        return(status(_addr));
+      }
+
+      uint8_t addr = _addr;
+      if(_burst) {
+        _addr++;
+      }
+      if(addr >= CC1101_MODEL_NUM_REGS) {
+        return(0x00);
+      }
+      if(!_read) {
+        _regs[addr] = b;
+      }
+      return(_regs[addr]);
+    }
+
+    int pin(uint8_t pin) override {
+      if((pin != _gdo0) || (_regs[CC1101_MODEL_REG_IOCFG0] & 0x3F) != 0x01) {
+        return(0);
+      }
+
+      // asserted at or above Rx FIFO threshold or at packet end, de-asserted when Rx FIFO is empty
+      size_t thr = 4 * ((_regs[CC1101_MODEL_REG_FIFOTHR] & 0x0F) + 1);
+      return((_rxFifo.size() >= thr) || (_ended && !_rxFifo.empty()));
+    }
+
+    void advance(uint32_t now) override {
+      while(!_air.empty() && ((int32_t)(now - _air.front().at) >= 0)) {
+        Byte b = _air.front();
+        _air.pop_front();
+
+        // reception aborted
+        if(_marcState != CC1101_MODEL_MARC_RX) {
+          _air.clear();
+          break;
+        }
+
+        if(_rxFifo.size() >= CC1101_MODEL_FIFO_SIZE) {
+          _overflow = true;
+          _marcState = CC1101_MODEL_MARC_RXFIFO_OVERFLOW;
+          _air.clear();
+          break;
+        }
+        _rxFifo.push_back(b.val);
+
+        // last status byte ends the packet, next state given by RXOFF_MODE
+        if(b.last && _air.empty()) {
+          _ended = true;
+          _packetEnd = b.at;
+          switch((_regs[CC1101_MODEL_REG_MCSM1] >> 2) & 0x03) {
+            case 0:
+              _marcState = CC1101_MODEL_MARC_IDLE;
+              break;
+            case 1:
+              _marcState = CC1101_MODEL_MARC_FSTXON;
+              break;
+            case 2:
+              _marcState = CC1101_MODEL_MARC_TX;
+              break;
+            default:
+              break;
+          }
+        }
+      }
+    }
+
+  private:
+    struct Byte {
+      uint32_t at;
+      uint8_t val;
+      bool last;
+    };
+
+    uint8_t _gdo0;
+    uint8_t _regs[CC1101_MODEL_NUM_REGS];
+    uint8_t _patable = 0;
+    uint8_t _marcState = CC1101_MODEL_MARC_IDLE;
+    bool _overflow = false;
+    std::deque<uint8_t> _rxFifo;
+    std::deque<Byte> _air;
+    bool _ended = false;
+    uint32_t _packetEnd = 0;
+    size_t _fifoReads = 0;
+    size_t _underflows = 0;
+
+    // current SPI transaction
+    size_t _index = 0;
+    bool _read = false;
+    bool _burst = false;
+    uint8_t _addr = 0;
+
+    void reset() {
+      // reset values of the registers the library relies on, everything else is cleared
+      memset(_regs, 0x00, sizeof(_regs));
+      _regs[CC1101_MODEL_REG_IOCFG0] = 0x3F;
+      _regs[CC1101_MODEL_REG_FIFOTHR] = 0x07;
+      _regs[CC1101_MODEL_REG_PKTCTRL1] = 0x04;
+      _regs[CC1101_MODEL_REG_PKTCTRL0] = 0x45;
+      _regs[CC1101_MODEL_REG_MDMCFG4] = 0x8C;
+      _regs[CC1101_MODEL_REG_MDMCFG3] = 0x22;
+      _regs[CC1101_MODEL_REG_MCSM1] = 0x30;
+      _marcState = CC1101_MODEL_MARC_IDLE;
+      _rxFifo.clear();
+      _air.clear();
+      _overflow = false;
+      _ended = false;
+      _fifoReads = 0;
+      _underflows = 0;
+    }
+
+    void queue(uint32_t at, uint8_t val, bool last) {
+      Byte b = { at, val, last };
+      _air.push_back(b);
+      _ended = false;
+    }
+
+    void strobe(uint8_t cmd) {
+      switch(cmd) {
+        case CC1101_MODEL_CMD_RESET:
+          reset();
+          break;
+        case CC1101_MODEL_CMD_FSTXON:
+          _marcState = CC1101_MODEL_MARC_FSTXON;
+          break;
+        case CC1101_MODEL_CMD_RX:
+          _marcState = CC1101_MODEL_MARC_RX;
+          break;
+        case CC1101_MODEL_CMD_TX:
+          // Tx is not modelled, packet is sent instantly
+          _marcState = CC1101_MODEL_MARC_IDLE;
+          break;
+        case CC1101_MODEL_CMD_IDLE:
+        case CC1101_MODEL_CMD_POWER_DOWN:
+          _marcState = CC1101_MODEL_MARC_IDLE;
+          _air.clear();
+          break;
+        case CC1101_MODEL_CMD_FLUSH_RX:
+          // only allowed in idle or Rx FIFO overflow states
+          if((_marcState == CC1101_MODEL_MARC_IDLE) || (_marcState == CC1101_MODEL_MARC_RXFIFO_OVERFLOW)) {
+            _rxFifo.clear();
+            _overflow = false;
+            _marcState = CC1101_MODEL_MARC_IDLE;
+          }
+          break;
+        default:
+          break;
+      }
+    }
+
+    uint8_t status(uint8_t addr) const {
+      switch(addr) {
+        case CC1101_MODEL_REG_VERSION:
+          return(CC1101_MODEL_VERSION);
+        case CC1101_MODEL_REG_RSSI:
+          return(CC1101_MODEL_RSSI);
+        case CC1101_MODEL_REG_MARCSTATE:
+          return(_marcState);
+        case CC1101_MODEL_REG_RXBYTES:
+          return((_overflow ? 0x80 : 0x00) | (uint8_t)_rxFifo.size());
+        default:
+          return(0x00);
+      }
+    }
+
+    uint8_t chipStatus() const {
+      uint8_t state = 0;
+      if(_marcState == CC1101_MODEL_MARC_RX) {
+        state = 1;
+      } else if(_overflow) {
+        state = 6;
+      }
+      return((state << 4) | (uint8_t)min(_rxFifo.size(), (size_t)0x0F));
+    }
+};
+
+#endif
@@ -0,0 +1,101 @@
+/*
+  CC1101 readData per-packet latency benchmark
+
+  Runs CC1101::startReceive and CC1101::readData against CC1101Model on the host platform
+  and measures the time from the moment the status bytes of a packet are put in Rx FIFO
+  until readData returns. All time is virtual (see HostPlatform.h), so results do not depend
+  on the speed of the host PC, only on the SPI traffic and delays the library generates.
+
+  Each packet is also checked: readData must return RADIOLIB_ERR_NONE with the payload intact
+  and the LQI from the status bytes, and must not read empty Rx FIFO. Exit code is non-zero
+  if any packet fails.
+
+  Build and run from the repository root:
+    SRC=src
+    g++ -std=gnu++11 -DARDUINO=100 -DRADIOLIB_CUSTOM_ARDUINO -Iextras/test/host -I$SRC \
+      extras/test/host/HostPlatform.cpp extras/test/cc1101/ReadLatency.cpp \
+      $SRC/Module.cpp $SRC/modules/CC1101/CC1101.cpp $SRC/protocols/PhysicalLayer/PhysicalLayer.cpp \
+      -o ReadLatency && ./ReadLatency
+
+  To get figures for the readData implementation before it read packets as they arrive,
+  check out the parent of commit 8bee0d3 (e.g. "git worktree add /tmp/old 8bee0d3^")
+  and build the same sources with SRC=/tmp/old/src.
+*/
+
+#include <RadioLib.h>
+
+#include "HostPlatform.h"
+#include "CC1101Model.h"
+
+#define PIN_CS                      10
+#define PIN_GDO0                    2
+#define PIN_GDO2                    3
+
+// time from startReceive until the first byte is in Rx FIFO
+#define PACKET_DELAY_US             1000
+
+int main() {
+  const float bitRates[] = { 1.2, 4.8, 9.6, 38.4, 100.0, 250.0, 500.0 };
+  const size_t lengths[] = { 8, 32, 60 };
+
+  CC1101Model chip(PIN_GDO0);
+  hostAttach(&chip);
+  CC1101 radio(new Module(PIN_CS, PIN_GDO0, RADIOLIB_NC, PIN_GDO2));
+
+  int failed = 0;
+  printf("%8s %6s %12s %12s  %s\n", "br_kbps", "len", "byte_us", "latency_us", "result");
+  for(size_t i = 0; i < sizeof(bitRates) / sizeof(bitRates[0]); i++) {
+    int16_t state = radio.begin();
+    state |= radio.setBitRate(bitRates[i]);
+    if(state != RADIOLIB_ERR_NONE) {
+      printf("%8.1f configuration failed, code %d\n", bitRates[i], state);
+      failed++;
+      continue;
+    }
+
+    for(size_t j = 0; j < sizeof(lengths) / sizeof(lengths[0]); j++) {
+      uint8_t tx[RADIOLIB_CC1101_MAX_PACKET_LENGTH];
+      uint8_t rx[RADIOLIB_CC1101_MAX_PACKET_LENGTH];
+      for(size_t k = 0; k < lengths[j]; k++) {
+        tx[k] = (uint8_t)(k * 7 + i * 13 + j);
+      }
+      memset(rx, 0x00, sizeof(rx));
+
+      // wait for GDO0 the way interrupt-driven receive examples do
+      radio.startReceive();
+      size_t underflows = chip.getUnderflows();
+      chip.receive(tx, lengths[j], PACKET_DELAY_US);
+      while(!digitalRead(PIN_GDO0)) {
+        yield();
+      }
+      state = radio.readData(rx, lengths[j]);
+      uint32_t done = hostMicros();
+
+      // packet end after readData returned means status bytes were not read from this packet
+      const char* result = "OK";
+      if(state != RADIOLIB_ERR_NONE) {
+        result = "FAIL (error code)";
+      } else if(memcmp(tx, rx, lengths[j]) != 0) {
+        result = "FAIL (payload mismatch)";
+      } else if(!chip.isPacketEnded() || (chip.getUnderflows() != underflows)) {
+        result = "FAIL (read before packet end)";
+      } else if(radio.getLQI() != CC1101_MODEL_LQI) {
+        result = "FAIL (status bytes)";
+      }
+
+      if(result[0] == 'O') {
+        printf("%8.1f %6u %12u %12u  %s\n", bitRates[i], (unsigned)lengths[j], (unsigned)chip.getBytePeriod(), (unsigned)(done - chip.getPacketEnd()), result);
+      } else {
+        printf("%8.1f %6u %12u %12s  %s, code %d\n", bitRates[i], (unsigned)lengths[j], (unsigned)chip.getBytePeriod(), "-", result, state);
+        failed++;
+      }
+
+      // let the rest of the packet end before the next one
+      radio.standby();
+      hostAdvance(((uint32_t)lengths[j] + 3) * chip.getBytePeriod());
+    }
+  }
+
+  printf("%d failed\n", failed);
+  return(failed ? 1 : 0);
+}
@@ -0,0 +1,110 @@
+#if !defined(_RADIOLIB_HOST_ARDUINO_H)
+#define _RADIOLIB_HOST_ARDUINO_H
+
+/*
+  Minimal Arduino API for building RadioLib on a host PC.
+
+  Only what the library needs to compile with RADIOLIB_CUSTOM_ARDUINO is provided.
+  String and the Print family are inert, all output is discarded.
+  Time is virtual and pins/SPI are routed to a HostDevice model, see HostPlatform.h.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <ctype.h>
+
+#define PROGMEM
+#define PGM_P                       const char*
+#define pgm_read_byte(addr)         (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)         (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr)        (*(const uint32_t*)(addr))
+#define F(str)                      ((const __FlashStringHelper*)(str))
+
+#define HIGH                        1
+#define LOW                         0
+#define INPUT                       0
+#define OUTPUT                      1
+#define CHANGE                      1
+#define FALLING                     2
+#define RISING                      3
+#define LSBFIRST                    0
+#define MSBFIRST                    1
+#define BIN                         2
+#define DEC                         10
+#define HEX                         16
+#define digitalPinToInterrupt(p)    (p)
+
+template<class T, class U> auto min(T a, U b) -> decltype(a < b ? a : b) { return(a < b ? a : b); }
+template<class T, class U> auto max(T a, U b) -> decltype(a > b ? a : b) { return(a > b ? a : b); }
+
+typedef uint8_t byte;
+
+class __FlashStringHelper;
+
+class String {
+  public:
+    String(const char* str = "") { (void)str; }
+    String(int val, int base = DEC) { (void)val; (void)base; }
+    const char* c_str() const { return(""); }
+    size_t length() const { return(0); }
+    char charAt(size_t i) const { (void)i; return(0); }
+    void toCharArray(char* buf, unsigned int len) const { if(len) { buf[0] = '\0'; } }
+    unsigned char getBytes(unsigned char* buf, unsigned int len, unsigned int index = 0) const { (void)buf; (void)len; (void)index; return(0); }
+    bool reserve(unsigned int size) { (void)size; return(true); }
+    size_t concat(char c) { (void)c; return(0); }
+    size_t concat(const char* str) { (void)str; return(0); }
+    String& operator=(const char* str) { (void)str; return(*this); }
+    String operator+(const String& str) const { (void)str; return(*this); }
+    String& operator+=(char c) { (void)c; return(*this); }
+    String& operator+=(const char* str) { (void)str; return(*this); }
+    char operator[](unsigned int i) const { (void)i; return(0); }
+    char& operator[](unsigned int i) { static char c; (void)i; return(c); }
+};
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t b) = 0;
+    virtual size_t write(const uint8_t* buf, size_t len) { size_t n = 0; while(len--) { n += write(*buf++); } return(n); }
+    size_t write(const char* str) { return(write((const uint8_t*)str, strlen(str))); }
+    template<typename T> size_t print(T val) { (void)val; return(0); }
+    template<typename T> size_t print(T val, int fmt) { (void)val; (void)fmt; return(0); }
+    template<typename T> size_t println(T val) { (void)val; return(0); }
+    template<typename T> size_t println(T val, int fmt) { (void)val; (void)fmt; return(0); }
+    size_t println(void) { return(0); }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() { return(0); }
+    virtual int read() { return(-1); }
+};
+
+class HardwareSerial : public Stream {
+  public:
+    size_t write(uint8_t b) { (void)b; return(1); }
+    void begin(long speed) { (void)speed; }
+    void flush() {}
+};
+
+extern HardwareSerial Serial;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void tone(uint8_t _pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t _pin);
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(void), int mode);
+void detachInterrupt(uint8_t interruptNum);
+void yield(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long millis(void);
+unsigned long micros(void);
+unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout);
+
+#endif
@@ -0,0 +1,112 @@
+#include "Arduino.h"
+#include "SPI.h"
+#include "HostPlatform.h"
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+static HostDevice* hostDevice = NULL;
+static uint32_t hostTime = 0;
+
+void hostAttach(HostDevice* dev) {
+  hostDevice = dev;
+  if(hostDevice) {
+    hostDevice->advance(hostTime);
+  }
+}
+
+void hostAdvance(uint32_t us) {
+  hostTime += us;
+  if(hostDevice) {
+    hostDevice->advance(hostTime);
+  }
+}
+
+uint32_t hostMicros() {
+  return(hostTime);
+}
+
+void SPIClass::beginTransaction(SPISettings settings) {
+  (void)settings;
+  if(hostDevice) {
+    hostDevice->select();
+  }
+}
+
+uint8_t SPIClass::transfer(uint8_t b) {
+  hostAdvance(RADIOLIB_HOST_SPI_BYTE_US);
+  if(!hostDevice) {
+    return(0);
+  }
+  return(hostDevice->transfer(b));
+}
+
+void SPIClass::endTransaction() {
+  if(hostDevice) {
+    hostDevice->deselect();
+  }
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  (void)pin;
+  (void)value;
+}
+
+int digitalRead(uint8_t pin) {
+  if(!hostDevice) {
+    return(LOW);
+  }
+  return(hostDevice->pin(pin));
+}
+
+void tone(uint8_t _pin, unsigned int frequency, unsigned long duration) {
+  (void)_pin;
+  (void)frequency;
+  (void)duration;
+}
+
+void noTone(uint8_t _pin) {
+  (void)_pin;
+}
+
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(void), int mode) {
+  (void)interruptNum;
+  (void)userFunc;
+  (void)mode;
+}
+
+void detachInterrupt(uint8_t interruptNum) {
+  (void)interruptNum;
+}
+
+void yield(void) {
+  hostAdvance(RADIOLIB_HOST_YIELD_US);
+}
+
+void delay(unsigned long ms) {
+  hostAdvance(ms * 1000UL);
+}
+
+void delayMicroseconds(unsigned int us) {
+  hostAdvance(us);
+}
+
+unsigned long millis(void) {
+  return(hostTime / 1000UL);
+}
+
+unsigned long micros(void) {
+  return(hostTime);
+}
+
+unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout) {
+  (void)pin;
+  (void)state;
+  hostAdvance(timeout);
+  return(0);
+}
@@ -0,0 +1,81 @@
+#if !defined(_RADIOLIB_HOST_PLATFORM_H)
+#define _RADIOLIB_HOST_PLATFORM_H
+
+#include <stdint.h>
+
+// virtual time spent on each SPI byte (8 bits at 4 MHz)
+#define RADIOLIB_HOST_SPI_BYTE_US   2
+
+// virtual time spent by each call to yield()
+#define RADIOLIB_HOST_YIELD_US      1
+
+/*!
+  \class HostDevice
+
+  \brief Model of a radio module attached to the host platform.
+  Receives every SPI transaction and provides levels of input pins (e.g. GDO0 or DIO1).
+  Time only moves when the library spends it (SPI transfers, delays, yield) or when hostAdvance is called,
+  so all timing is deterministic and independent of the host PC speed.
+*/
+class HostDevice {
+  public:
+    virtual ~HostDevice() {}
+
+    /*!
+      \brief Called when SPI transaction starts (chip select pulled low).
+    */
+    virtual void select() {}
+
+    /*!
+      \brief Called for each byte of SPI transaction.
+
+      \param b Byte sent by the library.
+
+      \returns Byte returned by the device.
+    */
+    virtual uint8_t transfer(uint8_t b) = 0;
+
+    /*!
+      \brief Called when SPI transaction ends (chip select pulled high).
+    */
+    virtual void deselect() {}
+
+    /*!
+      \brief Level of an input pin.
+
+      \param pin Pin number used by the library.
+
+      \returns Pin level, HIGH or LOW.
+    */
+    virtual int pin(uint8_t pin) { (void)pin; return(0); }
+
+    /*!
+      \brief Called whenever virtual time moves forward.
+
+      \param now Current virtual time in microseconds.
+    */
+    virtual void advance(uint32_t now) { (void)now; }
+};
+
+/*!
+  \brief Attach device model to the SPI bus and input pins.
+
+  \param dev Device model, or NULL to detach.
+*/
+void hostAttach(HostDevice* dev);
+
+/*!
+  \brief Move virtual time forward.
+
+  \param us Number of microseconds to advance.
+*/
+void hostAdvance(uint32_t us);
+
+/*!
+  \brief Get current virtual time.
+
+  \returns Virtual time in microseconds, same as micros().
+*/
+uint32_t hostMicros();
+
+#endif
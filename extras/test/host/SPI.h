@@ -0,0 +1,26 @@
+#if !defined(_RADIOLIB_HOST_SPI_H)
+#define _RADIOLIB_HOST_SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0                   0
+
+class SPISettings {
+  public:
+    SPISettings() {}
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) { (void)clock; (void)bitOrder; (void)dataMode; }
+};
+
+// transactions and transfers are forwarded to the attached HostDevice
+class SPIClass {
+  public:
+    void begin() {}
+    void end() {}
+    void beginTransaction(SPISettings settings);
+    uint8_t transfer(uint8_t b);
+    void endTransaction();
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -99,10 +99,19 @@
   //#define RADIOLIB_EXCLUDE_SX128X
   //#define RADIOLIB_EXCLUDE_AFSK
   //#define RADIOLIB_EXCLUDE_AX25
+  //#define RADIOLIB_EXCLUDE_AX25_LINK   // dependent on RADIOLIB_EXCLUDE_AX25
   //#define RADIOLIB_EXCLUDE_HELLSCHREIBER
   //#define RADIOLIB_EXCLUDE_MORSE
   //#define RADIOLIB_EXCLUDE_RTTY
   //#define RADIOLIB_EXCLUDE_SSTV
+  //#define RADIOLIB_EXCLUDE_RANGING    // dependent on RADIOLIB_EXCLUDE_SX128X
+  //#define RADIOLIB_EXCLUDE_BLE        // dependent on RADIOLIB_EXCLUDE_SX128X
+  //#define RADIOLIB_EXCLUDE_BULK_TRANSFER  // dependent on RADIOLIB_EXCLUDE_SX128X
+  //#define RADIOLIB_EXCLUDE_CHANNEL_MONITOR  // dependent on RADIOLIB_EXCLUDE_SX128X and RADIOLIB_EXCLUDE_SX126X
+  //#define RADIOLIB_EXCLUDE_NRF24_STREAM   // dependent on RADIOLIB_EXCLUDE_NRF24
+  //#define RADIOLIB_EXCLUDE_MULTI_PIPE   // dependent on RADIOLIB_EXCLUDE_NRF24
+  //#define RADIOLIB_EXCLUDE_LINK_QUALITY   // dependent on RADIOLIB_EXCLUDE_NRF24
+  //#define RADIOLIB_EXCLUDE_SECURE_LINK   // dependent on RADIOLIB_EXCLUDE_RF69
   //#define RADIOLIB_EXCLUDE_DIRECT_RECEIVE
 
 #else
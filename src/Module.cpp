@@ -212,7 +212,8 @@ void Module::SPItransfer(uint8_t cmd, uint16_t reg, uint8_t* dataOut, uint8_t* d
   this->digitalWrite(_cs, LOW);
 
   // send SPI register address with access command
-  if( reg >= 0x70) {
+  // 12-bit addresses use long address format (AX5043), shorter addresses may have access bits set (e.g. CC1101 burst/status)
+  if(reg > 0xFF) {
     this->SPItransfer(0x70 | (reg >> 8) | cmd);
     this->SPItransfer(0xff & reg);
   } else {
@@ -22,6 +22,13 @@
     - Hellschreiber (HellClient)
     - 4-FSK (FSK4Client)
     - APRS (APRSClient)
+    - SX1280 ranging sessions (RangingClient)
+    - Bluetooth Low Energy advertising (BLEAdvClient)
+    - SX128x FLRC/GFSK bulk transfers (BulkTransferClient)
+    - SX128x/SX126x channel occupancy monitor (ChannelMonitor)
+    - nRF24 multi-pipe receiver (MultiPipeClient)
+    - nRF24 link quality controller (LinkQualityClient)
+    - RF69 encrypted link with key rotation (SecureLinkClient)
 
   \par Quick Links
   Documentation for most common methods can be found in its reference page (see the list above).\n
@@ -100,6 +107,13 @@
 #include "protocols/SSTV/SSTV.h"
 #include "protocols/FSK4/FSK4.h"
 #include "protocols/APRS/APRS.h"
+#include "protocols/Ranging/Ranging.h"
+#include "protocols/BLE/BLE.h"
+#include "protocols/BulkTransfer/BulkTransfer.h"
+#include "protocols/ChannelMonitor/ChannelMonitor.h"
+#include "protocols/MultiPipe/MultiPipe.h"
+#include "protocols/LinkQuality/LinkQuality.h"
+#include "protocols/SecureLink/SecureLink.h"
 #include "protocols/ExternalRadio/ExternalRadio.h"
 
 // only create Radio class when using RadioShield
@@ -265,6 +265,26 @@
 */
 #define RADIOLIB_ERR_INVALID_OOK_RSSI_PEAK_TYPE                (-108)
 
+/*!
+  \brief Received frame counter was already used, or is too old to be checked.
+*/
+#define RADIOLIB_ERR_FRAME_REPLAYED                            (-109)
+
+/*!
+  \brief Received frame is encrypted with key that is not in the key table.
+*/
+#define RADIOLIB_ERR_UNKNOWN_KEY                               (-110)
+
+/*!
+  \brief Message authentication code of received frame does not match its contents.
+*/
+#define RADIOLIB_ERR_MAC_MISMATCH                              (-111)
+
+/*!
+  \brief Transmit frame counter was not restored before starting the link, or all counter values were used up.
+*/
+#define RADIOLIB_ERR_TX_COUNTER_NOT_SET                        (-112)
+
 // APRS status codes
 
 /*!
@@ -321,6 +341,36 @@
 */
 #define RADIOLIB_ERR_ACK_NOT_RECEIVED                          (-504)
 
+/*!
+  \brief Transmit FIFO is full, wait for some of the queued packets to be sent.
+*/
+#define RADIOLIB_ERR_TX_FIFO_FULL                              (-505)
+
+/*!
+  \brief No entry is waiting in the queue.
+*/
+#define RADIOLIB_ERR_QUEUE_EMPTY                               (-506)
+
+/*!
+  \brief Streaming mode was not started.
+*/
+#define RADIOLIB_ERR_STREAM_NOT_ACTIVE                         (-507)
+
+/*!
+  \brief Supplied automatic retransmission delay or count is invalid.
+*/
+#define RADIOLIB_ERR_INVALID_AUTO_RETRANSMIT                   (-508)
+
+/*!
+  \brief No more peers can be added to the peer table.
+*/
+#define RADIOLIB_ERR_PEER_TABLE_FULL                           (-509)
+
+/*!
+  \brief Supplied peer index is invalid.
+*/
+#define RADIOLIB_ERR_INVALID_PEER                              (-510)
+
 // CC1101-specific status codes
 
 /*!
@@ -328,6 +378,26 @@
 */
 #define RADIOLIB_ERR_INVALID_NUM_BROAD_ADDRS                   (-601)
 
+/*!
+  \brief Tx FIFO underflowed during transmission, the packet was aborted.
+*/
+#define RADIOLIB_ERR_TX_FIFO_UNDERFLOW                         (-602)
+
+/*!
+  \brief Rx FIFO overflowed during reception, the packet was dropped.
+*/
+#define RADIOLIB_ERR_RX_FIFO_OVERFLOW                          (-603)
+
+/*!
+  \brief Supplied wake-on-radio period is invalid.
+*/
+#define RADIOLIB_ERR_INVALID_WOR_PERIOD                        (-604)
+
+/*!
+  \brief Supplied preamble quality threshold is invalid.
+*/
+#define RADIOLIB_ERR_INVALID_PREAMBLE_QUALITY                  (-605)
+
 // SX126x-specific status codes
 
 /*!
@@ -403,6 +473,30 @@
 */
 #define RADIOLIB_ERR_INVALID_REPEATER_CALLSIGN                 (-803)
 
+/*!
+  \brief The received frame is malformed.
+
+  The address field is not terminated, has more than 8 repeaters, or the frame is too short to contain control field.
+*/
+#define RADIOLIB_ERR_INVALID_FRAME                             (-804)
+
+/*!
+  \brief Connected mode link is not established.
+*/
+#define RADIOLIB_ERR_LINK_NOT_CONNECTED                        (-805)
+
+/*!
+  \brief Retransmission pool is full, data can be queued again once the remote station acknowledges some of the sent frames.
+*/
+#define RADIOLIB_ERR_LINK_WINDOW_FULL                          (-806)
+
+/*!
+  \brief The provided window size is invalid.
+
+  Window size must be at least 1, and can't be larger than RADIOLIB_AX25_LINK_MAX_WINDOW or RADIOLIB_AX25_LINK_POOL_SIZE.
+*/
+#define RADIOLIB_ERR_INVALID_WINDOW_SIZE                       (-807)
+
 // SX128x-specific status codes
 
 /*!
@@ -410,6 +504,16 @@
 */
 #define RADIOLIB_ERR_RANGING_TIMEOUT                           (-901)
 
+/*!
+  \brief No valid ranging result was collected for the requested anchor.
+*/
+#define RADIOLIB_ERR_RANGING_NO_RESULT                         (-902)
+
+/*!
+  \brief Position could not be solved - not enough anchors, or anchors are in degenerate geometry (e.g. all on a single line).
+*/
+#define RADIOLIB_ERR_RANGING_INVALID_GEOMETRY                  (-903)
+
 // Pager-specific status codes
 
 /*!
@@ -422,6 +526,37 @@
 */
 #define RADIOLIB_ERR_ADDRESS_NOT_FOUND                          (-1002)
 
+// BLE-specific status codes
+
+/*!
+  \brief No received advertising record is waiting in the queue.
+*/
+#define RADIOLIB_ERR_BLE_QUEUE_EMPTY                            (-1101)
+
+/*!
+  \brief Received packet is not a valid advertising PDU.
+*/
+#define RADIOLIB_ERR_BLE_INVALID_PDU                            (-1102)
+
+// channel monitor-specific status codes
+
+/*!
+  \brief None of the monitored channels has been sampled yet.
+*/
+#define RADIOLIB_ERR_CHANNEL_NOT_SAMPLED                        (-1201)
+
+// AX5043-specific status codes
+
+/*!
+  \brief PLL ranging was started, but has not finished yet.
+*/
+#define RADIOLIB_PLL_RANGING_IN_PROGRESS                        (-1301)
+
+/*!
+  \brief PLL ranging failed both with and without RF divider - frequency is out of range of the VCO.
+*/
+#define RADIOLIB_ERR_PLL_RANGING_FAILED                         (-1302)
+
 /*!
   \}
 */
@@ -27,29 +27,116 @@ int16_t AX5043::begin() {
 
 int16_t AX5043::configModulation(uint8_t modulation) {
   int16_t state = _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_MODULATION, modulation);
+  RADIOLIB_ASSERT(state);
+  _modulation = modulation;
   return state;
 }
 
+int16_t AX5043::configReceiver(float freqDev, float mark, float space) {
+  // receiver bandwidth has to cover the signal and the largest expected carrier offset
+  float bw = 2.0 * (freqDev + RADIOLIB_AX5043_RX_MAX_RF_OFFSET);
+  if(_modulation == RADIOLIB_AX5043_MODULATION_AFSK) {
+    bw += 2.0 * ((mark > space) ? mark : space);
+  } else {
+    bw += _br;
+  }
+
+  // decimation sets the baseband sample rate, channel filter bandwidth is 0.221 of it (AND9347-D.PDF)
+  float dec = (0.221 * RADIOLIB_AX5043_XTAL_FREQ) / (16.0 * bw);
+  uint8_t decimation = 127;
+  if(dec < 1.0) {
+    decimation = 1;
+  } else if(dec < 127.0) {
+    decimation = (uint8_t)dec;
+  }
+
+  // IF at the channel bandwidth keeps the image out of the channel
+  uint16_t ifFreq = (uint16_t)(bw * 1048576.0 / RADIOLIB_AX5043_XTAL_FREQ + 0.5);
+  uint32_t rxDataRate = (uint32_t)(128.0 * RADIOLIB_AX5043_XTAL_FREQ / (_br * decimation) + 0.5);
+
+  // offset is tracked and corrected at the first LO, so Doppler shift does not push the signal out of the channel filter
+  uint32_t maxRfOffset = (uint32_t)(RADIOLIB_AX5043_RX_MAX_RF_OFFSET * (RADIOLIB_AX5043_FREQUENCY_STEP_SIZE) + 0.5);
+
+  // IF, decimation, data rate and offsets are consecutive registers
+  uint8_t rx[12] = { (uint8_t)(ifFreq >> 8), (uint8_t)ifFreq, decimation,
+                     (uint8_t)(rxDataRate >> 16), (uint8_t)(rxDataRate >> 8), (uint8_t)rxDataRate,
+                     0x00, 0x00, 0x00,
+                     (uint8_t)(RADIOLIB_AX5043_MAXRFOFFSET_FREQOFFSCORR | ((maxRfOffset >> 16) & 0x0F)), (uint8_t)(maxRfOffset >> 8), (uint8_t)maxRfOffset };
+  _mod->SPIwriteRegisterBurst(RADIOLIB_AX5043_REG_IFFREQ1, rx, 12);
+
+  // AFSK tones are scaled by decimation, the detector output by the number of samples per bit
+  if(_modulation == RADIOLIB_AX5043_MODULATION_AFSK) {
+    uint16_t spaceRaw = (uint16_t)(space * decimation * 65536.0 / RADIOLIB_AX5043_XTAL_FREQ + 0.5);
+    uint16_t markRaw = (uint16_t)(mark * decimation * 65536.0 / RADIOLIB_AX5043_XTAL_FREQ + 0.5);
+    _afskRx[0] = (spaceRaw >> 8) & 0xFF;
+    _afskRx[1] = spaceRaw & 0xFF;
+    _afskRx[2] = (markRaw >> 8) & 0xFF;
+    _afskRx[3] = markRaw & 0xFF;
+    float shift = 2.0 * log(RADIOLIB_AX5043_XTAL_FREQ / (32.0 * _br * decimation)) / log(2.0);
+    _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_AFSKCTRL, (uint8_t)(shift + 0.5));
+  }
+
+  // single receiver parameter set, timing and data rate recovery gains follow the data rate
+  // gains are stored as 4-bit mantissa and 4-bit exponent
+  uint32_t gain[2] = { rxDataRate / 4, rxDataRate / 32 };
+  uint8_t gainRaw[2];
+  for(uint8_t i = 0; i < 2; i++) {
+    uint8_t exp = 0;
+    while(gain[i] > 0x0F) {
+      gain[i] >>= 1;
+      exp++;
+    }
+    gainRaw[i] = (gain[i] << 4) | exp;
+  }
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_RXPARAMSETS, 0x00);
+  _mod->SPIwriteRegisterBurst(RADIOLIB_AX5043_REG_TIMEGAIN0, gainRaw, 2);
+
+  // HDLC framing with CRC-CCITT and NRZI, as used by AX.25, LSB first
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_ENCODING, RADIOLIB_AX5043_ENCODING_NRZI);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_FRAMING, RADIOLIB_AX5043_FRAMING_HDLC | RADIOLIB_AX5043_FRAMING_CRC_CCITT);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PKTADDRCFG, 0x00);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PKTLENCFG, 0x00);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PKTLENOFFSET, 0x00);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PKTMAXLEN, 0xFF);
+
+  // AX.25 frames may be longer than one chunk, store metadata with each frame
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PKTCHUNKSIZE, RADIOLIB_AX5043_PKTCHUNKSIZE_240);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PKTSTOREFLAGS, RADIOLIB_AX5043_PKTSTOREFLAGS_TIMER | RADIOLIB_AX5043_PKTSTOREFLAGS_RFOFFS | RADIOLIB_AX5043_PKTSTOREFLAGS_RSSI);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PKTACCEPTFLAGS, RADIOLIB_AX5043_PKTACCEPTFLAGS_LRGP);
+
+  // performance tuning registers required for reception (AX5043 datasheet)
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F00, 0x0F);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F0C, 0x00);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F0D, 0x03);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F18, 0x06);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F1C, 0x07);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F21, 0x68);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F22, 0xFF);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F23, 0x84);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F26, 0x98);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F44, 0x25);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F72, 0x00);
+
+  return(RADIOLIB_ERR_NONE);
+}
+
 int16_t AX5043::getChipRevision() {
   return(_mod->SPIgetRegValue(RADIOLIB_AX5043_REG_SILICON_REVISION));
 }
 
-uint16_t AX5043::waitForXtal() {
-  uint8_t pll_range = 0;
-
-  // Wait for xtal to be running
-  while(!pll_range) {
-    pll_range = _mod->SPIgetRegValue(0x01D);
-    RADIOLIB_DEBUG_PRINTLN(pll_range, HEX);
-    delay(1);
+int16_t AX5043::waitForXtal() {
+  // crystal oscillator start takes about 1 ms
+  uint32_t start = _mod->millis();
+  while(!(_mod->SPIreadRegister(RADIOLIB_AX5043_REG_XTALSTATUS) & RADIOLIB_AX5043_XTALSTATUS_XTALRUN)) {
+    _mod->yield();
+    if(_mod->millis() - start > RADIOLIB_AX5043_RANGING_TIMEOUT) {
+      return(RADIOLIB_ERR_SPI_CMD_TIMEOUT);
+    }
   }
+  return(RADIOLIB_ERR_NONE);
 }
 
-int16_t AX5043::pllRanging() {
-  uint8_t pll_loop_bak;
-  uint8_t pll_cpi_bak;
-  uint8_t pll_range = 0;
-
+int16_t AX5043::configPll() {
   // Thanks for a lot of help on the register mapping
   // https://notblackmagic.com/bitsnpieces/ax5043//#rf-frequency-generation
 
@@ -60,12 +147,6 @@ int16_t AX5043::pllRanging() {
   // Charge pump current set to 16*8.5uA
   _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_PLLCPI, 0x10);
 
-  // TODO: Support dividing these for lower frequencies
-  // Essenitally, try to range. If ranging fails, double the 
-  // frequency and set the RFDIV bits here. Then retry ranging
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_PLLVCODIV, 0x30);
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_F34,       RADIOLIB_AX5043_F34_NO_RFDIV);
-
   // Setup unnanmed power registers based on data sheet
   _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_F10, RADIOLIB_AX5043_F10_TCXO); 
   _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_F11, RADIOLIB_AX5043_F11_TCXO);
@@ -73,24 +154,114 @@ int16_t AX5043::pllRanging() {
 
   _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_PWRMODE,   0x67 | 0x05);  // AX5043_PWRSTATE_XTAL_ON
 
-  waitForXtal();
+  return(waitForXtal());
+}
 
-  pll_range = 0x18;
-  
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_PLLRANGEA, RADIOLIB_AX5043_REG_PLLRANGEA_VCORANGE_RST | 
-                                                      RADIOLIB_AX5043_REG_PLLRANGEA_RNG_START);
+void AX5043::setPll(uint32_t freq, bool rfDiv) {
+  // RF divider is applied after the VCO, frequency register always holds the carrier frequency
+  uint8_t vcoDiv = RADIOLIB_AX5043_PLLVCODIV_VCOSEL | RADIOLIB_AX5043_PLLVCODIV_VCO2INT;
+  if(rfDiv) {
+    vcoDiv |= RADIOLIB_AX5043_PLLVCODIV_RFDIV;
+  }
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PLLVCODIV, vcoDiv);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_F34, rfDiv ? RADIOLIB_AX5043_F34_RFDIV : RADIOLIB_AX5043_F34_NO_RFDIV);
+
+  uint8_t buff[4] = { (uint8_t)(freq >> 24), (uint8_t)(freq >> 16), (uint8_t)(freq >> 8), (uint8_t)freq };
+  _mod->SPIwriteRegisterBurst(RADIOLIB_AX5043_REG_FREQA - 3, buff, 4);
+}
+
+int16_t AX5043::setFrequency(float freq) {
+  int16_t state = startPllRanging(freq);
+  RADIOLIB_ASSERT(state);
+
+  // ranging usually finishes within a few hundred us, do not sleep in between checks
+  do {
+    _mod->yield();
+    state = checkPllRanging();
+  } while(state == RADIOLIB_PLL_RANGING_IN_PROGRESS);
+
+  return(state);
+}
+
+int16_t AX5043::startPllRanging(float freq) {
+  RADIOLIB_CHECK_RANGE(freq, RADIOLIB_AX5043_FREQUENCY_MIN, RADIOLIB_AX5043_FREQUENCY_MAX, RADIOLIB_ERR_INVALID_FREQUENCY);
+
+  // From AND9347-D.PDF, It is strongly recommended to always set bit 0 to avoid spectral tones.
+  uint32_t frf = (uint32_t)(freq * 1000000.0 * (RADIOLIB_AX5043_FREQUENCY_STEP_SIZE) + 0.5) | 1;
+  uint16_t band = frf >> RADIOLIB_AX5043_VCO_CACHE_SHIFT;
+
+  // known band, only set the frequency and VCO range - this does not interrupt reception or transmission
+  for(uint8_t i = 0; i < _vcoCount; i++) {
+    if(_vcoBand[i] == band) {
+      _ranging = false;
+      setPll(frf, _vcoRange[i] & 0x80);
+      _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PLLRANGEA, _vcoRange[i] & RADIOLIB_AX5043_REG_PLLRANGEA_VCORANGE);
+      return(RADIOLIB_ERR_NONE);
+    }
+  }
+
+  // ranging needs the crystal, but not the synthesizer
+  int16_t state = standby();
+  RADIOLIB_ASSERT(state);
+  state = waitForXtal();
+  RADIOLIB_ASSERT(state);
+
+  // try without RF divider first
+  _ranging = true;
+  _rangingRfDiv = false;
+  _rangingFreq = frf;
+  setPll(frf, false);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PLLRANGEA, RADIOLIB_AX5043_REG_PLLRANGEA_VCORANGE_RST | RADIOLIB_AX5043_REG_PLLRANGEA_RNG_START);
+  _rangingStart = _mod->millis();
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t AX5043::checkPllRanging() {
+  if(!_ranging) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // start bit is cleared by the chip when ranging is done
+  uint8_t range = _mod->SPIreadRegister(RADIOLIB_AX5043_REG_PLLRANGEA);
+  if(range & RADIOLIB_AX5043_REG_PLLRANGEA_RNG_START) {
+    if(_mod->millis() - _rangingStart > RADIOLIB_AX5043_RANGING_TIMEOUT) {
+      _ranging = false;
+      return(RADIOLIB_ERR_RANGING_TIMEOUT);
+    }
+    return(RADIOLIB_PLL_RANGING_IN_PROGRESS);
+  }
 
-  while(pll_range & RADIOLIB_AX5043_REG_PLLRANGEA_RNG_START) {
-    pll_range = _mod->SPIgetRegValue(RADIOLIB_AX5043_REG_PLLRANGEA);
-    RADIOLIB_DEBUG_PRINTLN(pll_range, HEX);
-    delay(100);
+  // frequency may be reachable through RF divider
+  if(range & RADIOLIB_AX5043_REG_PLLRANGEA_RNG_ERROR) {
+    if(_rangingRfDiv) {
+      _ranging = false;
+      return(RADIOLIB_ERR_PLL_RANGING_FAILED);
+    }
+    RADIOLIB_DEBUG_PRINTLN(F("PLL ranging failed, retrying with RFDIV"));
+    _rangingRfDiv = true;
+    setPll(_rangingFreq, true);
+    _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PLLRANGEA, RADIOLIB_AX5043_REG_PLLRANGEA_VCORANGE_RST | RADIOLIB_AX5043_REG_PLLRANGEA_RNG_START);
+    _rangingStart = _mod->millis();
+    return(RADIOLIB_PLL_RANGING_IN_PROGRESS);
   }
 
   RADIOLIB_DEBUG_PRINTLN(F("PLL ranging done"));
+  _ranging = false;
+
+  // remember the result, oldest entry is replaced when the cache is full
+  _vcoBand[_vcoNext] = _rangingFreq >> RADIOLIB_AX5043_VCO_CACHE_SHIFT;
+  _vcoRange[_vcoNext] = (range & RADIOLIB_AX5043_REG_PLLRANGEA_VCORANGE) | (_rangingRfDiv ? 0x80 : 0x00);
+  _vcoNext = (_vcoNext + 1) % RADIOLIB_AX5043_VCO_CACHE_SIZE;
+  if(_vcoCount < RADIOLIB_AX5043_VCO_CACHE_SIZE) {
+    _vcoCount++;
+  }
 
-  if (pll_range & 0x20) return RADIOLIB_ERR_RANGING_TIMEOUT;
+  return(RADIOLIB_ERR_NONE);
+}
 
-  return RADIOLIB_ERR_NONE;
+void AX5043::clearVcoCache() {
+  _vcoCount = 0;
+  _vcoNext = 0;
 }
 
 int16_t AX5043::beginAFSK(uint32_t freq, uint32_t txRate, uint32_t fskDev, uint16_t afskMark, uint16_t afskSpace) {
@@ -126,98 +297,200 @@ int16_t AX5043::beginAFSK(uint32_t freq, uint32_t txRate, uint32_t fskDev, uint1
   state =  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_TXRATE-1, (txRate>>8)&0xff);
   state =  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_TXRATE-2, (txRate>>16)&0xff);
 
-  // Mark and space at 2200Hz and 1200Hz
-  state =  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_AFSKMARK,     afskMark&0xFF);
-  state =  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_AFSKMARK-1,  (afskSpace>>8)&0xFF);
-  state =  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_AFSKSPACE,    afskSpace);
-  state =  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_AFSKSPACE-1, (afskSpace>>8)&0xFF);
+  // Mark and space at 2200Hz and 1200Hz, receiver uses the same registers so they are rewritten on every transmission
+  _afskTx[0] = (afskSpace >> 8) & 0xFF;
+  _afskTx[1] = afskSpace & 0xFF;
+  _afskTx[2] = (afskMark >> 8) & 0xFF;
+  _afskTx[3] = afskMark & 0xFF;
+  _mod->SPIwriteRegisterBurst(RADIOLIB_AX5043_REG_AFSKSPACE - 1, _afskTx, 4);
 
   // Set power to 15dB
   state =  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_TXPWRCOEFFB,   0xFF);
   state =  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_TXPWRCOEFFB-1, 0x0F);
 
-  // frequncy * 2^24 / 16MHz(xtal)
-  // freq = freq * 1.048576;
-  // // Round to nearest bit
-  // freq = freq + 0.5;
+  // bit rate is needed for timeouts
+  _br = (float)txRate / (RADIOLIB_AX5043_FREQUENCY_STEP_SIZE);
 
-  // From AND9347-D.PDF, It is strongly recommended to always set bit 0 to avoid spectral tones.
-  freq |= 1;
+  // demodulator has to match the transmitter settings
+  float freqDev = (float)fskDev / (0.858785 * RADIOLIB_AX5043_FREQUENCY_STEP_SIZE);
+  float mark = (float)afskMark * RADIOLIB_AX5043_XTAL_FREQ / 262144.0;
+  float space = (float)afskSpace * RADIOLIB_AX5043_XTAL_FREQ / 262144.0;
+  state = configReceiver(freqDev, mark, space);
+  RADIOLIB_ASSERT(state);
+
+  // carrier frequency is passed in Hz
+  state = configPll();
+  RADIOLIB_ASSERT(state);
+  return(setFrequency((float)freq / 1000000.0));
+}
 
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FREQA,    freq&0xFF);
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FREQA-1, (freq >> 8)&0xFF);
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FREQA-2, (freq >> 16)&0xFF);
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FREQA-3, (freq >> 24)&0xFF);
 
-  RADIOLIB_DEBUG_PRINTLN(fr, HEX);
 
-  return pllRanging();
+int16_t AX5043::transmit(uint8_t* data, size_t len, uint8_t addr) {
+  // calculate timeout (100 ms + 500 % of expected time-on-air)
+  uint32_t timeout = 100000 + (uint32_t)((((float)(len * 8)) / _br) * 5000000.0);
+
+  // start transmission
+  int16_t state = startTransmit(data, len, addr);
+  RADIOLIB_ASSERT(state);
+
+  // wait for transmission end or timeout, refill FIFO on the way if the frame does not fit
+  int remLen = len;
+  uint32_t start = _mod->micros();
+  do {
+    while(!_mod->digitalRead(_mod->getIrq())) {
+      _mod->yield();
+      if(_mod->micros() - start > timeout) {
+        finishTransmit();
+        return(RADIOLIB_ERR_TX_TIMEOUT);
+      }
+    }
+  } while(!fifoAdd(data, len, &remLen));
+
+  return(finishTransmit());
 }
 
+int16_t AX5043::transmitHdlc(uint8_t* data, size_t len, uint8_t preambleLen) {
+  // framing engine is only used for this frame, other transmissions stay raw
+  _hdlcTx = true;
+  _hdlcPreamble = preambleLen;
+  int16_t state = transmit(data, len);
+  _hdlcTx = false;
+  return(state);
+}
 
+void AX5043::setIrqAction(void (*func)(void)) {
+  _mod->attachInterrupt(RADIOLIB_DIGITAL_PIN_TO_INTERRUPT(_mod->getIrq()), func, RISING);
+}
 
-int16_t AX5043::transmit(uint8_t* data, size_t len, uint8_t addr) {
-  RADIOLIB_DEBUG_PRINTLN(F("transmit called"));
-  RADIOLIB_DEBUG_PRINTLN(len);
-  RADIOLIB_DEBUG_PRINTLN(addr, HEX);
-  
-  // Clear the FIFO and switch to TX mode
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FIFOSTAT, RADIOLIB_AX5043_FIFOSTAT_CMD_CLEAR_FIFO);
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_PWRMODE,  RADIOLIB_AX5043_PWRMODE_FULL_TX);
+void AX5043::clearIrqAction() {
+  _mod->detachInterrupt(RADIOLIB_DIGITAL_PIN_TO_INTERRUPT(_mod->getIrq()));
+}
 
+bool AX5043::fifoAdd(uint8_t* data, int totalLen, int* remLen) {
+  if(_txPos < (size_t)totalLen) {
+    writeFifo(data, totalLen);
+    *remLen = totalLen - _txPos;
 
-  while (!(_mod->SPIgetRegValue(RADIOLIB_AX5043_REG_PWRSTAT) & 0x08));
+    // whole frame is in FIFO, only transmission done is of interest now
+    if(_txPos == (size_t)totalLen) {
+      _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_IRQMASK0, RADIOLIB_AX5043_IRQ_RADIOCTRL);
+    }
+    return(false);
+  }
 
-  // Write data to FIFO
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FIFODATA, RADIOLIB_AX5043_REG_FIFODATA_TYPE_DATA);
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FIFODATA, len+1);  // Length + flag
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FIFODATA, 0x33);   // Raw+skip encoding | Packet start + packet end
+  // reading the event register also clears it
+  *remLen = 0;
+  return((_mod->SPIreadRegister(RADIOLIB_AX5043_REG_RADIOEVENTREQ0) & RADIOLIB_AX5043_RADIOEVENT_DONE) != 0);
+}
+
+int16_t AX5043::receive(uint8_t* data, size_t len) {
+  // calculate timeout (500 ms + 10 times the time-on-air of the longest frame)
+  uint32_t timeout = 500000 + (uint32_t)((((float)(RADIOLIB_AX5043_RX_MAX_LENGTH * 8)) / _br) * 10000000.0);
+
+  // start reception
+  int16_t state = startReceive();
+  RADIOLIB_ASSERT(state);
+
+  // wait for a complete frame or timeout
+  uint32_t start = _mod->micros();
+  while(_rxCount == 0) {
+    if(_mod->digitalRead(_mod->getIrq())) {
+      readFifo();
+    }
+    _mod->yield();
+    if(_mod->micros() - start > timeout) {
+      standby();
+      return(RADIOLIB_ERR_RX_TIMEOUT);
+    }
+  }
+
+  standby();
+  return(readData(data, len));
+}
+
+int16_t AX5043::startReceive() {
+  // disable interrupts
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_IRQMASK0, 0x00);
 
-  // Write packet
-  for (int i = 0; i < len; i++) {
-    // Our data is pre-inverted 
-    _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FIFODATA, Module::flipBits(data[i]));
+  // receiver AFSK tones are scaled differently
+  if(_modulation == RADIOLIB_AX5043_MODULATION_AFSK) {
+    _mod->SPIwriteRegisterBurst(RADIOLIB_AX5043_REG_AFSKSPACE - 1, _afskRx, 4);
   }
 
-  // Read Event reg to clear it
-  _mod->SPIgetRegValue(RADIOLIB_AX5043_REG_RADIOEVENTREQ0);
+  // clear the FIFO and switch to RX mode
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_FIFOSTAT, RADIOLIB_AX5043_FIFOSTAT_CMD_CLEAR_FIFO);
+  resetParser();
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PWRMODE, RADIOLIB_AX5043_PWRMODE_FULL_RX);
 
-  // Send the message!
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_FIFOSTAT, RADIOLIB_AX5043_FIFOSTAT_CMD_COMMIT);
+  // signal data in FIFO, or FIFO overflow
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_IRQMASK0, RADIOLIB_AX5043_IRQ_FIFONOTEMPTY | RADIOLIB_AX5043_IRQ_FIFOERROR);
 
-  // Set event mask to transmit done
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_RADIOEVENTMASK0, 0x01);
-  // Set IRQ mask to PLLUNLOCK + Radio controller interrupt
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_IRQMASK0, 0x40);
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t AX5043::readFifo() {
+  // chunk boundaries are lost on overflow, start over with the next frame
+  if(_mod->SPIreadRegister(RADIOLIB_AX5043_REG_FIFOSTAT) & RADIOLIB_AX5043_FIFOSTAT_OVER) {
+    _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_FIFOSTAT, RADIOLIB_AX5043_FIFOSTAT_CMD_CLEAR_FIFO);
+    resetParser();
+    _rxDropped++;
+    return(RADIOLIB_ERR_RX_FIFO_OVERFLOW);
+  }
 
-  // Wait until TX is finished
-  while(1)
-  {
-    // Transmit done?
-    if(_mod->SPIgetRegValue(RADIOLIB_AX5043_REG_RADIOEVENTREQ0) & 0x01)
+  // drain FIFO in bursts - new data may arrive in the meantime, so allow a few more reads than FIFO size
+  uint8_t buff[RADIOLIB_AX5043_FIFO_BURST_SIZE];
+  for(uint8_t i = 0; i < 2*RADIOLIB_AX5043_FIFO_SIZE/RADIOLIB_AX5043_FIFO_BURST_SIZE; i++) {
+    _mod->SPIreadRegisterBurst(RADIOLIB_AX5043_REG_FIFOCOUNT1, 2, buff);
+    size_t count = ((size_t)(buff[0] & 0x01) << 8) | buff[1];
+    if(count == 0) {
       break;
+    }
+    if(count > RADIOLIB_AX5043_FIFO_BURST_SIZE) {
+      count = RADIOLIB_AX5043_FIFO_BURST_SIZE;
+    }
+
+    _mod->SPIreadRegisterBurst(RADIOLIB_AX5043_REG_FIFODATA, count, buff);
+    for(size_t j = 0; j < count; j++) {
+      parseFifo(buff[j]);
+    }
   }
 
-  // Transmit is done power down
-  // TODO: Switch to RX?
-  _mod->SPIsetRegValue(RADIOLIB_AX5043_REG_PWRMODE, RADIOLIB_AX5043_PWRMODE_POWERDOWN);
+  return(RADIOLIB_ERR_NONE);
+}
 
-  return 0;
+uint8_t AX5043::available() {
+  return(_rxCount);
 }
 
+int16_t AX5043::readPacket(AX5043Packet_t* pkt) {
+  if(pkt == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(_rxCount == 0) {
+    return(RADIOLIB_ERR_QUEUE_EMPTY);
+  }
 
-int16_t AX5043::receive(uint8_t* data, size_t len) {
-  RADIOLIB_DEBUG_PRINTLN(F("receive called"));
-  return 0;
+  memcpy(pkt, &_rxQueue[_rxHead], sizeof(AX5043Packet_t));
+  _rxHead = (_rxHead + 1) % RADIOLIB_AX5043_RX_QUEUE_SIZE;
+  _rxCount--;
+  return(RADIOLIB_ERR_NONE);
 }
 
+uint16_t AX5043::getDropped() {
+  return(_rxDropped);
+}
 
 int16_t AX5043::standby() {
-  RADIOLIB_DEBUG_PRINTLN(F("standby called"));
-  return 0;
+  // disable interrupts, frame in progress is lost
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_IRQMASK0, 0x00);
+  resetParser();
+
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PWRMODE, RADIOLIB_AX5043_PWRMODE_STANDBY);
+  return(RADIOLIB_ERR_NONE);
 }
 
-int16_t AX5043::transmitDirect(uint32_t frf = 0) {
+int16_t AX5043::transmitDirect(uint32_t frf) {
   RADIOLIB_DEBUG_PRINTLN(F("transmitDirect called"));
   return 0;
 }
@@ -227,14 +500,80 @@ int16_t AX5043::receiveDirect() {
   return 0;
 }
 
-int16_t AX5043::startTransmit(uint8_t* data, size_t len, uint8_t addr = 0) {
-  RADIOLIB_DEBUG_PRINTLN(F("startTransmit called"));
-  return 0;
+int16_t AX5043::startTransmit(uint8_t* data, size_t len, uint8_t addr) {
+  (void)addr;
+
+  // disable interrupts and clear pending events
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_IRQMASK0, 0x00);
+  _mod->SPIreadRegister(RADIOLIB_AX5043_REG_RADIOEVENTREQ0);
+
+  // transmitter AFSK tones are scaled differently
+  if(_modulation == RADIOLIB_AX5043_MODULATION_AFSK) {
+    _mod->SPIwriteRegisterBurst(RADIOLIB_AX5043_REG_AFSKSPACE - 1, _afskTx, 4);
+  }
+
+  // clear the FIFO and switch to TX mode
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_FIFOSTAT, RADIOLIB_AX5043_FIFOSTAT_CMD_CLEAR_FIFO);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PWRMODE, RADIOLIB_AX5043_PWRMODE_FULL_TX);
+
+  // wait for modem supply
+  uint32_t start = _mod->millis();
+  while(!(_mod->SPIreadRegister(RADIOLIB_AX5043_REG_PWRSTAT) & RADIOLIB_AX5043_PWRSTAT_SVMODEM)) {
+    _mod->yield();
+    if(_mod->millis() - start > 10) {
+      _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PWRMODE, RADIOLIB_AX5043_PWRMODE_POWERDOWN);
+      return(RADIOLIB_ERR_SPI_CMD_TIMEOUT);
+    }
+  }
+
+  // HDLC preamble is a repeated flag, NRZI encoded but not stuffed
+  if(_hdlcTx && (_hdlcPreamble > 0)) {
+    uint8_t preamble[4] = { RADIOLIB_AX5043_REG_FIFODATA_TYPE_REPEAT_DATA, RADIOLIB_AX5043_FIFODATA_FLAG_RAW, _hdlcPreamble, RADIOLIB_AX5043_HDLC_FLAG };
+    _mod->SPIwriteRegisterBurst(RADIOLIB_AX5043_REG_FIFODATA, preamble, 4);
+  }
+
+  // write as much as fits, transmission starts with the first commit
+  _txPos = 0;
+  writeFifo(data, len);
+
+  // signal either free FIFO space for the rest of the frame, or transmission done
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_FIFOTHRESH1, (RADIOLIB_AX5043_FIFO_THRESH >> 8) & 0x01);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_FIFOTHRESH0, RADIOLIB_AX5043_FIFO_THRESH & 0xFF);
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_RADIOEVENTMASK0, RADIOLIB_AX5043_RADIOEVENT_DONE);
+  if(_txPos < len) {
+    _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_IRQMASK0, RADIOLIB_AX5043_IRQ_FIFOTHRFREE);
+  } else {
+    _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_IRQMASK0, RADIOLIB_AX5043_IRQ_RADIOCTRL);
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t AX5043::finishTransmit() {
+  // disable interrupts and clear pending events
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_IRQMASK0, 0x00);
+  _mod->SPIreadRegister(RADIOLIB_AX5043_REG_RADIOEVENTREQ0);
+
+  // transmit is done, power down
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_PWRMODE, RADIOLIB_AX5043_PWRMODE_POWERDOWN);
+  return(RADIOLIB_ERR_NONE);
 }
 
 int16_t AX5043::readData(uint8_t* data, size_t len) {
-  RADIOLIB_DEBUG_PRINTLN(F("readData called"));
-  return 0;
+  if(_rxCount == 0) {
+    return(RADIOLIB_ERR_QUEUE_EMPTY);
+  }
+
+  AX5043Packet_t* pkt = &_rxQueue[_rxHead];
+  size_t length = len;
+  if((len == 0) || (len > pkt->len)) {
+    length = pkt->len;
+  }
+  memcpy(data, pkt->data, length);
+
+  _rxHead = (_rxHead + 1) % RADIOLIB_AX5043_RX_QUEUE_SIZE;
+  _rxCount--;
+  return(RADIOLIB_ERR_NONE);
 }
 
 int16_t AX5043::setFrequencyDeviation(float freqDev) {
@@ -242,9 +581,12 @@ int16_t AX5043::setFrequencyDeviation(float freqDev) {
   return 0;
 }
 
-size_t AX5043::getPacketLength(bool update = true) { 
-  RADIOLIB_DEBUG_PRINTLN(F("getPacketLength called"));
-  return 0;
+size_t AX5043::getPacketLength(bool update) {
+  (void)update;
+  if(_rxCount == 0) {
+    return(0);
+  }
+  return(_rxQueue[_rxHead].len);
 }
 
 int16_t AX5043::setEncoding(uint8_t encoding) { 
@@ -272,6 +614,170 @@ void AX5043::setDirectAction(void (*func)(void)) {
   return;
 }
 
+void AX5043::writeFifo(uint8_t* data, size_t len) {
+  // free space in FIFO, each chunk needs 3 bytes of header
+  uint8_t buff[2];
+  _mod->SPIreadRegisterBurst(RADIOLIB_AX5043_REG_FIFOFREE1, 2, buff);
+  size_t fifoFree = ((size_t)(buff[0] & 0x01) << 8) | buff[1];
+  if(fifoFree <= 3) {
+    return;
+  }
+
+  // chunk length field also counts the flags byte
+  size_t chunkLen = len - _txPos;
+  if(chunkLen > fifoFree - 3) {
+    chunkLen = fifoFree - 3;
+  }
+  if(chunkLen > 254) {
+    chunkLen = 254;
+  }
+
+  // raw data, no framing or encoding, unless the framing engine is used
+  uint8_t flags = 0;
+  if(!_hdlcTx) {
+    flags = RADIOLIB_AX5043_FIFODATA_FLAG_RAW | RADIOLIB_AX5043_FIFODATA_FLAG_UNENC;
+  }
+  if(_txPos == 0) {
+    flags |= RADIOLIB_AX5043_FIFODATA_FLAG_PKTSTART;
+  }
+  if(_txPos + chunkLen == len) {
+    flags |= RADIOLIB_AX5043_FIFODATA_FLAG_PKTEND;
+  }
+
+  // stage header and data in bursts, raw data is pre-inverted
+  uint8_t burst[RADIOLIB_AX5043_FIFO_BURST_SIZE];
+  burst[0] = RADIOLIB_AX5043_REG_FIFODATA_TYPE_DATA;
+  burst[1] = chunkLen + 1;
+  burst[2] = flags;
+  size_t burstLen = 3;
+  for(size_t i = 0; i < chunkLen; i++) {
+    burst[burstLen++] = _hdlcTx ? data[_txPos + i] : Module::flipBits(data[_txPos + i]);
+    if(burstLen == RADIOLIB_AX5043_FIFO_BURST_SIZE) {
+      _mod->SPIwriteRegisterBurst(RADIOLIB_AX5043_REG_FIFODATA, burst, burstLen);
+      burstLen = 0;
+    }
+  }
+  if(burstLen > 0) {
+    _mod->SPIwriteRegisterBurst(RADIOLIB_AX5043_REG_FIFODATA, burst, burstLen);
+  }
+  _txPos += chunkLen;
+
+  // send it
+  _mod->SPIwriteRegister(RADIOLIB_AX5043_REG_FIFOSTAT, RADIOLIB_AX5043_FIFOSTAT_CMD_COMMIT);
+}
+
+void AX5043::resetParser() {
+  _chunkState = RADIOLIB_AX5043_CHUNK_STATE_HEADER;
+  _rxActive = false;
+  _rxRssi = 0;
+  _rxFreqOffset = 0;
+  _rxTimer = 0;
+}
+
+void AX5043::parseFifo(uint8_t b) {
+  switch(_chunkState) {
+    case RADIOLIB_AX5043_CHUNK_STATE_HEADER: {
+      // payload size is encoded in the header, except for variable length chunks
+      _chunkType = b;
+      _chunkPos = 0;
+      uint8_t size = (b & RADIOLIB_AX5043_REG_FIFODATA_HDR_SIZE) >> 5;
+      if(size == 7) {
+        _chunkState = RADIOLIB_AX5043_CHUNK_STATE_LENGTH;
+      } else if(size > 0) {
+        _chunkRem = size;
+        _chunkState = RADIOLIB_AX5043_CHUNK_STATE_PAYLOAD;
+      }
+    } break;
+
+    case RADIOLIB_AX5043_CHUNK_STATE_LENGTH:
+      _chunkRem = b;
+      _chunkState = (b > 0) ? RADIOLIB_AX5043_CHUNK_STATE_PAYLOAD : RADIOLIB_AX5043_CHUNK_STATE_HEADER;
+      break;
+
+    case RADIOLIB_AX5043_CHUNK_STATE_PAYLOAD:
+      if(_chunkType == RADIOLIB_AX5043_REG_FIFODATA_TYPE_DATA) {
+        if(_chunkPos == 0) {
+          // first byte of data chunk are flags, start of a new frame also discards unfinished previous one
+          _chunkFlags = b;
+          if(b & RADIOLIB_AX5043_FIFODATA_FLAG_PKTSTART) {
+            _rxActive = (_rxCount < RADIOLIB_AX5043_RX_QUEUE_SIZE);
+            if(_rxActive) {
+              _rxQueue[(_rxHead + _rxCount) % RADIOLIB_AX5043_RX_QUEUE_SIZE].len = 0;
+            } else {
+              _rxDropped++;
+            }
+          }
+
+        } else if(_rxActive) {
+          // received data go directly into the queue
+          AX5043Packet_t* pkt = &_rxQueue[(_rxHead + _rxCount) % RADIOLIB_AX5043_RX_QUEUE_SIZE];
+          if(pkt->len < RADIOLIB_AX5043_RX_MAX_LENGTH) {
+            pkt->data[pkt->len++] = b;
+          } else {
+            _rxActive = false;
+            _rxDropped++;
+          }
+        }
+
+      } else if(_chunkPos < sizeof(_chunkBuff)) {
+        _chunkBuff[_chunkPos] = b;
+      }
+
+      _chunkPos++;
+      if(--_chunkRem == 0) {
+        finishChunk();
+        _chunkState = RADIOLIB_AX5043_CHUNK_STATE_HEADER;
+      }
+      break;
+  }
+}
+
+void AX5043::finishChunk() {
+  switch(_chunkType) {
+    case RADIOLIB_AX5043_REG_FIFODATA_TYPE_DATA: {
+      if(!_rxActive || !(_chunkFlags & RADIOLIB_AX5043_FIFODATA_FLAG_PKTEND)) {
+        break;
+      }
+      _rxActive = false;
+
+      // the chip should only pass valid frames, but check anyway
+      if(_chunkFlags & (RADIOLIB_AX5043_FIFODATA_FLAG_CRCFAIL | RADIOLIB_AX5043_FIFODATA_FLAG_ADDRFAIL |
+                        RADIOLIB_AX5043_FIFODATA_FLAG_SIZEFAIL | RADIOLIB_AX5043_FIFODATA_FLAG_ABORT)) {
+        _rxDropped++;
+        break;
+      }
+
+      // metadata chunks are written before the data, attach them to the frame now that it is complete
+      AX5043Packet_t* pkt = &_rxQueue[(_rxHead + _rxCount) % RADIOLIB_AX5043_RX_QUEUE_SIZE];
+      pkt->rssi = _rxRssi;
+      pkt->freqOffset = _rxFreqOffset;
+      pkt->timer = _rxTimer;
+      _rxCount++;
+    } break;
+
+    case RADIOLIB_AX5043_REG_FIFODATA_TYPE_RSSI:
+      _rxRssi = (int16_t)((int8_t)_chunkBuff[0]) - RADIOLIB_AX5043_RSSI_OFFSET;
+      break;
+
+    case RADIOLIB_AX5043_REG_FIFODATA_TYPE_RF_FREQ_OFFSET: {
+      // 24-bit signed value, same scaling as carrier frequency
+      int32_t offset = ((int32_t)_chunkBuff[0] << 16) | ((int32_t)_chunkBuff[1] << 8) | _chunkBuff[2];
+      if(offset & 0x800000) {
+        offset -= 0x1000000;
+      }
+      _rxFreqOffset = (int32_t)((float)offset / (RADIOLIB_AX5043_FREQUENCY_STEP_SIZE));
+    } break;
+
+    case RADIOLIB_AX5043_REG_FIFODATA_TYPE_TIMER:
+      _rxTimer = ((uint32_t)_chunkBuff[0] << 16) | ((uint32_t)_chunkBuff[1] << 8) | _chunkBuff[2];
+      break;
+
+    default:
+      // other chunks are not requested in PKTSTOREFLAGS, their payload is skipped
+      break;
+  }
+}
+
 uint8_t AX5043::randomByte() {
   RADIOLIB_DEBUG_PRINTLN(F("randomByte called"));
   return 0xA7; // It's random I swear!
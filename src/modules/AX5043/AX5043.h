@@ -33,10 +33,56 @@
 //#include "../../protocols/PhysicalLayer/PhysicalLayer.h"
 #ifdef AX5043_XTAL_16368KHz
 #define RADIOLIB_AX5043_FREQUENCY_STEP_SIZE                    16777216.0/16.368e6
+#define RADIOLIB_AX5043_XTAL_FREQ                              16.368e6
 #else
 #define RADIOLIB_AX5043_FREQUENCY_STEP_SIZE                    16777216.0/16e6
+#define RADIOLIB_AX5043_XTAL_FREQ                              16e6
 #endif
 #define RADIOLIB_AX5043_MAX_PACKET_LENGTH                      255
+#define RADIOLIB_AX5043_FIFO_SIZE                              256
+#define RADIOLIB_AX5043_FIFO_THRESH                            128
+#define RADIOLIB_AX5043_FIFO_BURST_SIZE                        64
+
+// maximum length of received frame, enough for AX.25 frame with 8 repeaters and 256 bytes of information
+#if !defined(RADIOLIB_AX5043_RX_MAX_LENGTH)
+  #define RADIOLIB_AX5043_RX_MAX_LENGTH                        (330)
+#endif
+
+// number of received frames that can be queued
+#if !defined(RADIOLIB_AX5043_RX_QUEUE_SIZE)
+  #define RADIOLIB_AX5043_RX_QUEUE_SIZE                        (2)
+#endif
+
+// largest expected carrier frequency offset in Hz, e.g. Doppler shift of LEO satellite on 2 m band
+#if !defined(RADIOLIB_AX5043_RX_MAX_RF_OFFSET)
+  #define RADIOLIB_AX5043_RX_MAX_RF_OFFSET                     (4000)
+#endif
+
+// number of cached PLL ranging results
+#if !defined(RADIOLIB_AX5043_VCO_CACHE_SIZE)
+  #define RADIOLIB_AX5043_VCO_CACHE_SIZE                       (4)
+#endif
+
+// width of frequency band sharing one cached VCO range, as right shift of raw frequency (2^20 steps, about 1 MHz)
+#define RADIOLIB_AX5043_VCO_CACHE_SHIFT                        20
+
+// maximum duration of single PLL ranging attempt in ms
+#define RADIOLIB_AX5043_RANGING_TIMEOUT                        10
+
+// frequency limits in MHz
+#define RADIOLIB_AX5043_FREQUENCY_MIN                          27.0
+#define RADIOLIB_AX5043_FREQUENCY_MAX                          1050.0
+
+// offset of RSSI values reported by the chip
+#define RADIOLIB_AX5043_RSSI_OFFSET                            64
+
+// HDLC flag, sent as preamble
+#define RADIOLIB_AX5043_HDLC_FLAG                              0x7E
+
+// FIFO chunk parser states
+#define RADIOLIB_AX5043_CHUNK_STATE_HEADER                     0
+#define RADIOLIB_AX5043_CHUNK_STATE_LENGTH                     1
+#define RADIOLIB_AX5043_CHUNK_STATE_PAYLOAD                    2
 
 /*
   Register map
@@ -53,15 +99,23 @@
 #define RADIOLIB_AX5043_REG_SILICON_REVISION                   0x000
 #define RADIOLIB_AX5043_REG_PWRMODE                            0x002
 #define RADIOLIB_AX5043_REG_PWRSTAT                            0x003
+#define RADIOLIB_AX5043_REG_XTALSTATUS                         0x01D
+#define RADIOLIB_AX5043_REG_IRQMASK1                           0x006
 #define RADIOLIB_AX5043_REG_IRQMASK0                           0x007
+#define RADIOLIB_AX5043_REG_RADIOEVENTMASK1                    0x008
 #define RADIOLIB_AX5043_REG_RADIOEVENTMASK0                    0x009
+#define RADIOLIB_AX5043_REG_IRQREQUEST1                        0x00C
+#define RADIOLIB_AX5043_REG_IRQREQUEST0                        0x00D
+#define RADIOLIB_AX5043_REG_RADIOEVENTREQ1                     0x00E
 #define RADIOLIB_AX5043_REG_RADIOEVENTREQ0                     0x00F
 #define RADIOLIB_AX5043_REG_MODULATION                         0x010
 #define RADIOLIB_AX5043_REG_ENCODING                           0x011
+#define RADIOLIB_AX5043_REG_FRAMING                            0x012
 #define RADIOLIB_AX5043_REG_TXRATE                             0x167 // 0x167(LSB) - 0x165(MSB)
 #define RADIOLIB_AX5043_REG_FSKDEV                             0x163
-#define RADIOLIB_AX5043_REG_AFSKMARK                           0x113
-#define RADIOLIB_AX5043_REG_AFSKSPACE                          0x111
+#define RADIOLIB_AX5043_REG_AFSKMARK                           0x113 // 0x113(LSB) - 0x112(MSB)
+#define RADIOLIB_AX5043_REG_AFSKSPACE                          0x111 // 0x111(LSB) - 0x110(MSB)
+#define RADIOLIB_AX5043_REG_AFSKCTRL                           0x114
 #define RADIOLIB_AX5043_REG_FREQA                              0x037 // 0x037(LSB) - 0x034(MSB)
 #define RADIOLIB_AX5043_REG_TXPWRCOEFFB                        0x16B
 
@@ -70,20 +124,86 @@
 #define RADIOLIB_AX5043_REG_PLLRANGEA                          0x033
 #define RADIOLIB_AX5043_REG_PLLVCODIV                          0x032
 
+// receiver registers
+#define RADIOLIB_AX5043_REG_IFFREQ1                            0x100
+#define RADIOLIB_AX5043_REG_IFFREQ0                            0x101
+#define RADIOLIB_AX5043_REG_DECIMATION                         0x102
+#define RADIOLIB_AX5043_REG_RXDATARATE2                        0x103
+#define RADIOLIB_AX5043_REG_RXDATARATE1                        0x104
+#define RADIOLIB_AX5043_REG_RXDATARATE0                        0x105
+#define RADIOLIB_AX5043_REG_MAXDROFFSET2                       0x106
+#define RADIOLIB_AX5043_REG_MAXDROFFSET1                       0x107
+#define RADIOLIB_AX5043_REG_MAXDROFFSET0                       0x108
+#define RADIOLIB_AX5043_REG_MAXRFOFFSET2                       0x109
+#define RADIOLIB_AX5043_REG_MAXRFOFFSET1                       0x10A
+#define RADIOLIB_AX5043_REG_MAXRFOFFSET0                       0x10B
+#define RADIOLIB_AX5043_REG_RXPARAMSETS                        0x117
+#define RADIOLIB_AX5043_REG_TIMEGAIN0                          0x124
+#define RADIOLIB_AX5043_REG_DRGAIN0                            0x125
+
+// packet format registers
+#define RADIOLIB_AX5043_REG_PKTADDRCFG                         0x200
+#define RADIOLIB_AX5043_REG_PKTLENCFG                          0x201
+#define RADIOLIB_AX5043_REG_PKTLENOFFSET                       0x202
+#define RADIOLIB_AX5043_REG_PKTMAXLEN                          0x203
+#define RADIOLIB_AX5043_REG_PKTCHUNKSIZE                       0x230
+#define RADIOLIB_AX5043_REG_PKTMISCFLAGS                       0x231
+#define RADIOLIB_AX5043_REG_PKTSTOREFLAGS                      0x232
+#define RADIOLIB_AX5043_REG_PKTACCEPTFLAGS                     0x233
+
 // FIFO registers
 #define RADIOLIB_AX5043_REG_FIFOSTAT                           0x028
 #define RADIOLIB_AX5043_REG_FIFODATA                           0x029
+#define RADIOLIB_AX5043_REG_FIFOCOUNT1                         0x02A
+#define RADIOLIB_AX5043_REG_FIFOCOUNT0                         0x02B
+#define RADIOLIB_AX5043_REG_FIFOFREE1                          0x02C
+#define RADIOLIB_AX5043_REG_FIFOFREE0                          0x02D
+#define RADIOLIB_AX5043_REG_FIFOTHRESH1                        0x02E
+#define RADIOLIB_AX5043_REG_FIFOTHRESH0                        0x02F
 
 // Unnamed registers
 #define RADIOLIB_AX5043_REG_F34                                0xF34
 #define RADIOLIB_AX5043_REG_F35                                0xF35
 #define RADIOLIB_AX5043_REG_F10                                0xF10
 #define RADIOLIB_AX5043_REG_F11                                0xF11
+#define RADIOLIB_AX5043_REG_F00                                0xF00
+#define RADIOLIB_AX5043_REG_F0C                                0xF0C
+#define RADIOLIB_AX5043_REG_F0D                                0xF0D
+#define RADIOLIB_AX5043_REG_F18                                0xF18
+#define RADIOLIB_AX5043_REG_F1C                                0xF1C
+#define RADIOLIB_AX5043_REG_F21                                0xF21
+#define RADIOLIB_AX5043_REG_F22                                0xF22
+#define RADIOLIB_AX5043_REG_F23                                0xF23
+#define RADIOLIB_AX5043_REG_F26                                0xF26
+#define RADIOLIB_AX5043_REG_F44                                0xF44
+#define RADIOLIB_AX5043_REG_F72                                0xF72
 
 // RADIOLIB_AX5043_REG_PWRMODE                                                 MSB   LSB   DESCRIPTION
 #define RADIOLIB_AX5043_PWRMODE_FULL_TX                        0x0D  //  7     0     <description>
+#define RADIOLIB_AX5043_PWRMODE_FULL_RX                        0x09  //  7     0     receiver running
+#define RADIOLIB_AX5043_PWRMODE_STANDBY                        0x05  //  7     0     crystal oscillator running
 #define RADIOLIB_AX5043_PWRMODE_POWERDOWN                      0x00  //  7     0     <description>
 
+// RADIOLIB_AX5043_REG_PWRSTAT                                                 MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_PWRSTAT_SVMODEM                        0b00001000  //  3     3     modem supply voltage ready
+
+// RADIOLIB_AX5043_REG_IRQMASK0 + RADIOLIB_AX5043_REG_IRQREQUEST0              MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_IRQ_FIFONOTEMPTY                       0b00000001  //  0     0     FIFO not empty
+#define RADIOLIB_AX5043_IRQ_FIFONOTFULL                        0b00000010  //  1     1     FIFO not full
+#define RADIOLIB_AX5043_IRQ_FIFOTHRCNT                         0b00000100  //  2     2     FIFO count above threshold
+#define RADIOLIB_AX5043_IRQ_FIFOTHRFREE                        0b00001000  //  3     3     FIFO free space above threshold
+#define RADIOLIB_AX5043_IRQ_FIFOERROR                          0b00010000  //  4     4     FIFO overflow/underflow
+#define RADIOLIB_AX5043_IRQ_PLLUNLOCK                          0b00100000  //  5     5     PLL lost lock
+#define RADIOLIB_AX5043_IRQ_RADIOCTRL                          0b01000000  //  6     6     radio controller event, see RADIOEVENTREQ0
+#define RADIOLIB_AX5043_IRQ_POWER                              0b10000000  //  7     7     power event
+
+// RADIOLIB_AX5043_REG_RADIOEVENTMASK0 + RADIOLIB_AX5043_REG_RADIOEVENTREQ0    MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_RADIOEVENT_DONE                        0b00000001  //  0     0     transmission/reception done
+#define RADIOLIB_AX5043_RADIOEVENT_SETTLED                     0b00000010  //  1     1     synthesizer settled
+#define RADIOLIB_AX5043_RADIOEVENT_RADIOSTATECHG               0b00000100  //  2     2     radio state changed
+#define RADIOLIB_AX5043_RADIOEVENT_RXPARAMSETCHG               0b00001000  //  3     3     receiver parameter set changed
+#define RADIOLIB_AX5043_RADIOEVENT_FRAMECLK                    0b00010000  //  4     4     frame clock
+
 // RADIOLIB_AX5043_REG_MODULATION                                              MSB   LSB   DESCRIPTION
 #define RADIOLIB_AX5043_MODULATION_AFSK                        0b00001010  //  7     0     <description>
 #define RADIOLIB_AX5043_MODULATION_FSK                         0b00001000  //  7     0     <description>
@@ -92,6 +212,35 @@
 #define RADIOLIB_AX5043_ENCODING_DIFF                          0b00000010  //  7     0     <description>
 #define RADIOLIB_AX5043_ENCODING_INVERTED                      0b00000001  //  7     0     <description>
 #define RADIOLIB_AX5043_ENCODING_NRZ                           ( RADIOLIB_AX5043_ENCODING_DIFF | RADIOLIB_AX5043_ENCODING_INVERTED )
+#define RADIOLIB_AX5043_ENCODING_NRZI                          ( RADIOLIB_AX5043_ENCODING_DIFF | RADIOLIB_AX5043_ENCODING_INVERTED )
+
+// RADIOLIB_AX5043_REG_FRAMING                                                 MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_FRAMING_RAW                            0b00000000  //  3     1     framing: raw
+#define RADIOLIB_AX5043_FRAMING_HDLC                           0b00000100  //  3     1              HDLC (flags, bit stuffing)
+#define RADIOLIB_AX5043_FRAMING_CRC_OFF                        0b00000000  //  6     4     CRC: disabled
+#define RADIOLIB_AX5043_FRAMING_CRC_CCITT                      0b00010000  //  6     4          CRC-CCITT, as in AX.25
+
+// RADIOLIB_AX5043_REG_PKTCHUNKSIZE                                            MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_PKTCHUNKSIZE_240                       0x0D        //  3     0     largest receive chunk: 240 bytes
+
+// RADIOLIB_AX5043_REG_PKTSTOREFLAGS                                           MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_PKTSTOREFLAGS_TIMER                    0b00000001  //  0     0     store timer at packet start
+#define RADIOLIB_AX5043_PKTSTOREFLAGS_FOFFS                    0b00000010  //  1     1     store baseband frequency offset
+#define RADIOLIB_AX5043_PKTSTOREFLAGS_RFOFFS                   0b00000100  //  2     2     store RF frequency offset
+#define RADIOLIB_AX5043_PKTSTOREFLAGS_DR                       0b00001000  //  3     3     store data rate offset
+#define RADIOLIB_AX5043_PKTSTOREFLAGS_RSSI                     0b00010000  //  4     4     store RSSI
+#define RADIOLIB_AX5043_PKTSTOREFLAGS_CRCB                     0b00100000  //  5     5     store CRC bytes
+
+// RADIOLIB_AX5043_REG_PKTACCEPTFLAGS                                          MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_PKTACCEPTFLAGS_RESIDUE                 0b00000001  //  0     0     accept packets with incomplete last byte
+#define RADIOLIB_AX5043_PKTACCEPTFLAGS_ABRT                    0b00000010  //  1     1     accept aborted packets
+#define RADIOLIB_AX5043_PKTACCEPTFLAGS_CRCF                    0b00000100  //  2     2     accept packets with CRC error
+#define RADIOLIB_AX5043_PKTACCEPTFLAGS_ADDRF                   0b00001000  //  3     3     accept packets with address mismatch
+#define RADIOLIB_AX5043_PKTACCEPTFLAGS_SZF                     0b00010000  //  4     4     accept packets with size error
+#define RADIOLIB_AX5043_PKTACCEPTFLAGS_LRGP                    0b00100000  //  5     5     accept packets spanning multiple chunks
+
+// RADIOLIB_AX5043_REG_MAXRFOFFSET2                                            MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_MAXRFOFFSET_FREQOFFSCORR               0b10000000  //  7     7     correct frequency offset at the first LO
 
 // RADIOLIB_AX5043_REG_FIFOSTAT_CMD(AND9347-D.PDF Table 64)                    MSB   LSB   DESCRIPTION
 #define RADIOLIB_AX5043_FIFOSTAT_CMD_ASK_COHERENT              0b00000001  //  7     0     <description>
@@ -100,11 +249,32 @@
 #define RADIOLIB_AX5043_FIFOSTAT_CMD_COMMIT                    0b00000100  //  7     0     <description>
 #define RADIOLIB_AX5043_FIFOSTAT_CMD_ROLLBACK                  0b00000101  //  7     0     <description>
 
+// RADIOLIB_AX5043_REG_FIFOSTAT                                                MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_FIFOSTAT_EMPTY                         0b00000001  //  0     0     FIFO empty
+#define RADIOLIB_AX5043_FIFOSTAT_FULL                          0b00000010  //  1     1     FIFO full
+#define RADIOLIB_AX5043_FIFOSTAT_UNDER                         0b00000100  //  2     2     FIFO underflow
+#define RADIOLIB_AX5043_FIFOSTAT_OVER                          0b00001000  //  3     3     FIFO overflow
+
+// RADIOLIB_AX5043_REG_FIFODATA_TYPE_DATA flags (AND9347-D.PDF Table 5)       MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_FIFODATA_FLAG_PKTSTART                 0b00000001  //  0     0     first chunk of the packet
+#define RADIOLIB_AX5043_FIFODATA_FLAG_PKTEND                   0b00000010  //  1     1     last chunk of the packet
+#define RADIOLIB_AX5043_FIFODATA_FLAG_RESIDUE                  0b00000100  //  2     2     last byte is not complete
+#define RADIOLIB_AX5043_FIFODATA_FLAG_NOCRC                    0b00001000  //  3     3     do not append CRC
+#define RADIOLIB_AX5043_FIFODATA_FLAG_RAW                      0b00010000  //  4     4     skip framing
+#define RADIOLIB_AX5043_FIFODATA_FLAG_UNENC                    0b00100000  //  5     5     skip encoder
+
+// RADIOLIB_AX5043_REG_FIFODATA_TYPE_DATA flags, receive (AND9347-D.PDF Table 5) MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_FIFODATA_FLAG_CRCFAIL                  0b00001000  //  3     3     CRC check failed
+#define RADIOLIB_AX5043_FIFODATA_FLAG_ADDRFAIL                 0b00010000  //  4     4     address mismatch
+#define RADIOLIB_AX5043_FIFODATA_FLAG_SIZEFAIL                 0b00100000  //  5     5     packet size out of range
+#define RADIOLIB_AX5043_FIFODATA_FLAG_ABORT                    0b01000000  //  6     6     packet aborted
+
 // RADIOLIB_AX5043_REG_FIFODATA_HDR (AND9347-D.PDF Table 3)                    MSB   LSB   DESCRIPTION
 #define RADIOLIB_AX5043_REG_FIFODATA_HDR_SINGLE                0b00100000  //  7     0     <description>
 #define RADIOLIB_AX5043_REG_FIFODATA_HDR_DOUBLE                0b01000000  //  7     0     <description>
 #define RADIOLIB_AX5043_REG_FIFODATA_HDR_TRIPPLE               0b01100000  //  7     0     <description>
 #define RADIOLIB_AX5043_REG_FIFODATA_HDR_VARIABLE              0b11100000  //  7     0     <description>
+#define RADIOLIB_AX5043_REG_FIFODATA_HDR_SIZE                  0b11100000  //  7     5     payload size, 7 means length byte follows
 
 // RADIOLIB_AX5043_REG_FIFODATA_TYPE (AND9347-D.PDF Table 4)                   MSB   LSB   DESCRIPTION
 // Single byte header 
@@ -148,6 +318,14 @@
 #define RADIOLIB_AX5043_REG_PLLRANGEA_PLL_LOCK                 0b01000000  //  6     6    PLL is locked
 #define RADIOLIB_AX5043_REG_PLLRANGEA_STICK_LOCK               0b10000000  //  7     7    PLL lost lock after last read if 0
 
+// RADIOLIB_AX5043_REG_PLLVCODIV                                              MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_PLLVCODIV_RFDIV                        0b00000100  //  2     2    divide VCO output by 2
+#define RADIOLIB_AX5043_PLLVCODIV_VCOSEL                       0b00010000  //  4     4    VCO2 selected
+#define RADIOLIB_AX5043_PLLVCODIV_VCO2INT                      0b00100000  //  5     5    VCO2 internal loop filter
+
+// RADIOLIB_AX5043_REG_XTALSTATUS                                             MSB   LSB   DESCRIPTION
+#define RADIOLIB_AX5043_XTALSTATUS_XTALRUN                     0b00000001  //  0     0    crystal oscillator running
+
 // RADIOLIB_AX5043_REG_F34
 #define RADIOLIB_AX5043_F34_NO_RFDIV                           0x08  //  RFDIV is not used
 #define RADIOLIB_AX5043_F34_RFDIV                              0x28  //  RFDIV used
@@ -172,6 +350,37 @@
 #define RADIOLIB_AX5043_F11_TCXO                               0x00  // TCXO is used
 #define RADIOLIB_AX5043_F11_XTAL                               0x07  // XTAL is used
 
+/*!
+  \struct AX5043Packet_t
+
+  \brief Received frame, together with metadata stored by the chip at the start of the frame.
+*/
+struct AX5043Packet_t {
+  /*!
+    \brief Frame contents, without HDLC flags and CRC.
+  */
+  uint8_t data[RADIOLIB_AX5043_RX_MAX_LENGTH];
+
+  /*!
+    \brief Number of bytes in data.
+  */
+  uint16_t len;
+
+  /*!
+    \brief RSSI at the start of the frame in dBm.
+  */
+  int16_t rssi;
+
+  /*!
+    \brief Carrier frequency offset in Hz, as tracked by the receiver.
+  */
+  int32_t freqOffset;
+
+  /*!
+    \brief Value of the 24-bit free running chip timer at the start of the frame.
+  */
+  uint32_t timer;
+};
 
 /*
   Module class definition
@@ -203,30 +412,132 @@ class AX5043 : public PhysicalLayer {
     */
     // basic methods
     int16_t begin();
+
+    /*!
+      \brief Initialization method for AFSK (Bell 202) operation, used by AX.25 and APRS clients.
+      \param freq Carrier frequency in Hz, e.g. 144390000 for 144.39 MHz.
+      \param txRate Bit rate as TXRATE register value (see RADIOLIB_AX5043_REG_TXRATE).
+      \param fskDev Frequency deviation as FSKDEV register value (see RADIOLIB_AX5043_REG_FSKDEV).
+      \param afskMark Mark tone as AFSKMARK register value.
+      \param afskSpace Space tone as AFSKSPACE register value.
+      \returns \ref status_codes
+    */
     int16_t beginAFSK(uint32_t freq, uint32_t txRate = RADIOLIB_AX5043_TXRATE_AFSK, uint32_t fskDev = RADIOLIB_AX5043_FSKDEV_AFSK, uint16_t afskMark = RADIOLIB_AX5043_AFSKMARK, uint16_t afskSpace = RADIOLIB_AX5043_AFSKSPACE);
     int16_t getChipRevision();
+
+    /*!
+      \brief Sets carrier frequency. Blocks until PLL ranging is done, unless the VCO range for this band is already known.
+      \param freq Carrier frequency to be set in MHz, from 27 to 1050 MHz.
+      \returns \ref status_codes
+    */
+    int16_t setFrequency(float freq) override;
+
+    /*!
+      \brief Starts tuning to a new carrier frequency. When the VCO range of this band was found before,
+      frequency is set immediately and the method returns RADIOLIB_ERR_NONE. Otherwise, the module goes to standby,
+      PLL ranging is started and checkPllRanging has to be called until it stops returning RADIOLIB_PLL_RANGING_IN_PROGRESS.
+      \param freq Carrier frequency to be set in MHz, from 27 to 1050 MHz.
+      \returns \ref status_codes
+    */
+    int16_t startPllRanging(float freq);
+
+    /*!
+      \brief Checks PLL ranging started by startPllRanging. When ranging fails without RF divider, it is restarted with RF divider enabled.
+      \returns RADIOLIB_PLL_RANGING_IN_PROGRESS while ranging is running, otherwise \ref status_codes
+    */
+    int16_t checkPllRanging();
+
+    /*!
+      \brief Forgets all cached VCO ranges, e.g. after large temperature change. Next tuning to each band will do full PLL ranging.
+    */
+    void clearVcoCache();
     
 /*!
-      \brief Binary transmit method. Will transmit arbitrary binary data up to 255 bytes long using %LoRa or up to 63 bytes using FSK modem.
+      \brief Binary transmit method. Frames longer than FIFO are added in chunks as FIFO drains.
       For overloads to transmit Arduino String or C-string, see PhysicalLayer::transmit.
       \param data Binary data that will be transmitted.
       \param len Length of binary data to transmit (in bytes).
-      \param addr Node address to transmit the packet to. Only used in FSK mode.
+      \param addr Unused.
       \returns \ref status_codes
     */
     int16_t transmit(uint8_t* data, size_t len, uint8_t addr = 0) override;
 
     /*!
-      \brief Binary receive method. Will attempt to receive arbitrary binary data up to 255 bytes long using %LoRa or up to 63 bytes using FSK modem.
+      \brief Blocking transmit of a single HDLC frame. Flags, bit stuffing, CRC-CCITT and NRZI encoding are done by the framing engine,
+      the same way as received frames are decoded.
+      \param data Frame contents without flags and FCS, LSB of each byte is sent first.
+      \param len Number of bytes to transmit.
+      \param preambleLen Number of flags to send before the frame.
+      \returns \ref status_codes
+    */
+    int16_t transmitHdlc(uint8_t* data, size_t len, uint8_t preambleLen) override;
+
+    /*!
+      \brief Sets interrupt service routine to call when IRQ pin activates.
+      During transmission, this is either FIFO free space above threshold (more data can be added by fifoAdd),
+      or transmission done.
+      \param func ISR to call.
+    */
+    void setIrqAction(void (*func)(void));
+
+    /*!
+      \brief Clears interrupt service routine to call when IRQ pin activates.
+    */
+    void clearIrqAction();
+
+    /*!
+      \brief Adds the next chunk of the frame started by startTransmit into FIFO, sized to the free FIFO space.
+      Should be called every time the IRQ pin activates.
+      \param data Pointer to the transmission buffer, must be the same as passed to startTransmit.
+      \param totalLen Total number of bytes to transmit.
+      \param remLen Pointer to a counter that will be set to the number of bytes that have not been written to FIFO yet.
+      \returns True when a complete frame is sent, false if transmission is still in progress.
+    */
+    bool fifoAdd(uint8_t* data, int totalLen, int* remLen);
+
+    /*!
+      \brief Blocking binary receive method. Waits for one HDLC frame, deframed and checked by the chip.
       For overloads to receive Arduino String, see PhysicalLayer::receive.
       \param data Pointer to array to save the received binary data.
-      \param len Number of bytes that will be received. Must be known in advance for binary transmissions.
+      \param len Number of bytes that will be read, 0 to read the whole frame.
       \returns \ref status_codes
     */
     int16_t receive(uint8_t* data, size_t len) override;
 
     /*!
-      \brief Sets the %LoRa module to standby.
+      \brief Interrupt-driven receive method. Frames are deframed by the chip, HDLC flags, bit stuffing and CRC are handled in hardware.
+      IRQ pin is activated when there is data in FIFO, readFifo has to be called then to move it into the packet queue.
+      \returns \ref status_codes
+    */
+    int16_t startReceive();
+
+    /*!
+      \brief Moves everything in FIFO into the packet queue. Should be called every time the IRQ pin activates during reception.
+      \returns \ref status_codes
+    */
+    int16_t readFifo();
+
+    /*!
+      \brief Gets the number of complete frames in the packet queue.
+      \returns Number of frames ready to be read.
+    */
+    uint8_t available();
+
+    /*!
+      \brief Reads the oldest frame in the packet queue, together with its metadata.
+      \param pkt Pointer to structure to save the frame.
+      \returns \ref status_codes
+    */
+    int16_t readPacket(AX5043Packet_t* pkt);
+
+    /*!
+      \brief Gets the number of frames dropped because the packet queue was full, the frame was too long or FIFO overflowed.
+      \returns Number of dropped frames.
+    */
+    uint16_t getDropped();
+
+    /*!
+      \brief Sets the module to standby.
       \returns \ref status_codes
     */
     int16_t standby() override;
@@ -247,16 +558,23 @@ class AX5043 : public PhysicalLayer {
     int16_t receiveDirect() override;
 
     /*!
-      \brief Interrupt-driven binary transmit method. Will start transmitting arbitrary binary data up to 255 bytes long using %LoRa or up to 63 bytes using FSK modem.
-      \param data Binary data that will be transmitted.
+      \brief Interrupt-driven binary transmit method. Writes as much of the frame as fits into FIFO,
+      the rest has to be added by fifoAdd. IRQ pin is activated when more data can be added, or when transmission is done.
+      \param data Binary data that will be transmitted, must stay valid until the transmission is done.
       \param len Length of binary data to transmit (in bytes).
-      \param addr Node address to transmit the packet to. Only used in FSK mode.
+      \param addr Unused.
       \returns \ref status_codes
     */
     int16_t startTransmit(uint8_t* data, size_t len, uint8_t addr = 0) override;
 
     /*!
-      \brief Reads data that was received after calling startReceive method. This method reads len characters.
+      \brief Clean up after transmission is done.
+      \returns \ref status_codes
+    */
+    int16_t finishTransmit() override;
+
+    /*!
+      \brief Reads the oldest frame in the packet queue. This method reads len characters.
       \param data Pointer to array to save the received binary data.
       \param len Number of bytes that will be read. When set to 0, the packet length will be retreived automatically.
       When more bytes than received are requested, only the number of bytes requested will be returned.
@@ -272,9 +590,9 @@ class AX5043 : public PhysicalLayer {
     int16_t setFrequencyDeviation(float freqDev) override;
 
     /*!
-      \brief Query modem for the packet length of received payload.
-      \param update Update received packet length. Will return cached value when set to false.
-      \returns Length of last received packet in bytes.
+      \brief Gets the length of the oldest frame in the packet queue.
+      \param update Unused, the length is known as soon as the frame is in the queue.
+      \returns Length of the oldest received frame in bytes, 0 when the queue is empty.
     */
     size_t getPacketLength(bool update = true) override;
 
@@ -320,6 +638,48 @@ class AX5043 : public PhysicalLayer {
     */
     Module* _mod;
 
+    float _br = 1200.0;
+    size_t _txPos = 0;
+    bool _hdlcTx = false;
+    uint8_t _hdlcPreamble = 0;
+    uint8_t _modulation = RADIOLIB_AX5043_MODULATION_AFSK;
+
+    // VCO ranges found for recently used bands, RFDIV in bit 7
+    uint16_t _vcoBand[RADIOLIB_AX5043_VCO_CACHE_SIZE];
+    uint8_t _vcoRange[RADIOLIB_AX5043_VCO_CACHE_SIZE];
+    uint8_t _vcoCount = 0;
+    uint8_t _vcoNext = 0;
+
+    // PLL ranging in progress
+    bool _ranging = false;
+    bool _rangingRfDiv = false;
+    uint32_t _rangingFreq = 0;
+    uint32_t _rangingStart = 0;
+
+    // AFSK tone registers, transmitter and receiver use different scaling
+    uint8_t _afskTx[4] = { 0, 0, 0, 0 };
+    uint8_t _afskRx[4] = { 0, 0, 0, 0 };
+
+    // packet queue
+    AX5043Packet_t _rxQueue[RADIOLIB_AX5043_RX_QUEUE_SIZE];
+    uint8_t _rxHead = 0;
+    uint8_t _rxCount = 0;
+    uint16_t _rxDropped = 0;
+    bool _rxActive = false;
+
+    // metadata of the frame being received
+    int16_t _rxRssi = 0;
+    int32_t _rxFreqOffset = 0;
+    uint32_t _rxTimer = 0;
+
+    // FIFO chunk parser
+    uint8_t _chunkState = 0;
+    uint8_t _chunkType = 0;
+    uint8_t _chunkFlags = 0;
+    uint8_t _chunkRem = 0;
+    uint8_t _chunkPos = 0;
+    uint8_t _chunkBuff[3] = { 0, 0, 0 };
+
     /*
       The class MAY contain additional private variables and/or methods.
       Private member variables MUST have a name prefixed with "_" (underscore, ASCII 0x5F)
@@ -327,8 +687,14 @@ class AX5043 : public PhysicalLayer {
       Usually, these are variables for saving module configuration, or methods that do not have to be exposed to the end user.
     */
     int16_t configModulation(uint8_t modulation);
-    int16_t pllRanging();
-    uint16_t waitForXtal();
+    int16_t configPll();
+    int16_t waitForXtal();
+    void setPll(uint32_t freq, bool rfDiv);
+    void writeFifo(uint8_t* data, size_t len);
+    int16_t configReceiver(float freqDev, float mark, float space);
+    void resetParser();
+    void parseFifo(uint8_t b);
+    void finishChunk();
 };
 
 #endif
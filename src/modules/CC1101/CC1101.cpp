@@ -108,29 +108,8 @@ int16_t CC1101::transmit(uint8_t* data, size_t len, uint8_t addr) {
   int16_t state = startTransmit(data, len, addr);
   RADIOLIB_ASSERT(state);
 
-  // wait for transmission start or timeout
-  uint32_t start = _mod->micros();
-  while(!_mod->digitalRead(_mod->getGpio())) {
-    _mod->yield();
-
-    if(_mod->micros() - start > timeout) {
-      finishTransmit();
-      return(RADIOLIB_ERR_TX_TIMEOUT);
-    }
-  }
-
-  // wait for transmission end or timeout
-  start = _mod->micros();
-  while(_mod->digitalRead(_mod->getGpio())) {
-    _mod->yield();
-
-    if(_mod->micros() - start > timeout) {
-      finishTransmit();
-      return(RADIOLIB_ERR_TX_TIMEOUT);
-    }
-  }
-
-  return(finishTransmit());
+  // wait for transmission end
+  return(waitTransmit(timeout));
 }
 
 int16_t CC1101::receive(uint8_t* data, size_t len) {
@@ -163,6 +142,11 @@ int16_t CC1101::standby() {
 
   // set RF switch (if present)
   _mod->setRfSwitchState(LOW, LOW);
+
+  // wake-on-radio settings would apply to normal reception as well
+  if(_worActive) {
+    return(worRestore());
+  }
   return(RADIOLIB_ERR_NONE);
 }
 
@@ -253,6 +237,11 @@ int16_t CC1101::startTransmit(uint8_t* data, size_t len, uint8_t addr) {
     return(RADIOLIB_ERR_PACKET_TOO_LONG);
   }
 
+  // enforce variable len limit.
+  if((_packetLengthConfig == RADIOLIB_CC1101_LENGTH_CONFIG_VARIABLE) && (len > RADIOLIB_CC1101_MAX_PACKET_LENGTH - 1)) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
   // set mode to standby
   standby();
 
@@ -263,60 +252,8 @@ int16_t CC1101::startTransmit(uint8_t* data, size_t len, uint8_t addr) {
   int16_t state = SPIsetRegValue(RADIOLIB_CC1101_REG_IOCFG2, RADIOLIB_CC1101_GDOX_SYNC_WORD_SENT_OR_RECEIVED, 5, 0);
   RADIOLIB_ASSERT(state);
 
-  // data put on FIFO.
-  uint8_t dataSent = 0;
-
-  // optionally write packet length
-  if (_packetLengthConfig == RADIOLIB_CC1101_LENGTH_CONFIG_VARIABLE) {
-
-    // enforce variable len limit.
-    if (len > RADIOLIB_CC1101_MAX_PACKET_LENGTH - 1) {
-      return (RADIOLIB_ERR_PACKET_TOO_LONG);
-    }
-
-    SPIwriteRegister(RADIOLIB_CC1101_REG_FIFO, len);
-    dataSent += 1;
-  }
-
-  // check address filtering
-  uint8_t filter = SPIgetRegValue(RADIOLIB_CC1101_REG_PKTCTRL1, 1, 0);
-  if(filter != RADIOLIB_CC1101_ADR_CHK_NONE) {
-    SPIwriteRegister(RADIOLIB_CC1101_REG_FIFO, addr);
-    dataSent += 1;
-  }
-
-  // fill the FIFO.
-  uint8_t initialWrite = min((uint8_t)len, (uint8_t)(RADIOLIB_CC1101_FIFO_SIZE - dataSent));
-  SPIwriteRegisterBurst(RADIOLIB_CC1101_REG_FIFO, data, initialWrite);
-  dataSent += initialWrite;
-
-  // set RF switch (if present)
-  _mod->setRfSwitchState(LOW, HIGH);
-
-  // set mode to transmit
-  SPIsendCommand(RADIOLIB_CC1101_CMD_TX);
-
-  // keep feeding the FIFO until the packet is over.
-  while (dataSent < len) {
-    // get number of bytes in FIFO.
-    uint8_t bytesInFIFO = SPIgetRegValue(RADIOLIB_CC1101_REG_TXBYTES, 6, 0);
-
-    // if there's room then put other data.
-    if (bytesInFIFO < RADIOLIB_CC1101_FIFO_SIZE) {
-      uint8_t bytesToWrite = min((uint8_t)(RADIOLIB_CC1101_FIFO_SIZE - bytesInFIFO), (uint8_t)(len - dataSent));
-      SPIwriteRegisterBurst(RADIOLIB_CC1101_REG_FIFO, &data[dataSent], bytesToWrite);
-      dataSent += bytesToWrite;
-    } else {
-      // wait for radio to send some data.
-      /*
-        * Does this work for all rates? If 1 ms is longer than the 1ms delay
-        * then the entire FIFO will be transmitted during that delay.
-        *
-        * TODO: test this on real hardware
-      */
-     delayMicroseconds(250);
-    }
-  }
+  // fill the FIFO and start transmitting
+  writePacket(data, len, addr, false);
 
   return (state);
 }
@@ -353,72 +290,108 @@ int16_t CC1101::startReceive() {
 }
 
 int16_t CC1101::readData(uint8_t* data, size_t len) {
-  // get packet length
+  // get packet length, address byte is included in it
   size_t length = getPacketLength();
-  if((len != 0) && (len < length)) {
-    // user requested less data than we got, only return what was requested
-    length = len;
-  }
 
   // check address filtering
+  size_t start = 0;
   uint8_t filter = SPIgetRegValue(RADIOLIB_CC1101_REG_PKTCTRL1, 1, 0);
-  if(filter != RADIOLIB_CC1101_ADR_CHK_NONE) {
-    SPIreadRegister(RADIOLIB_CC1101_REG_FIFO);
+  if((filter != RADIOLIB_CC1101_ADR_CHK_NONE) && (length > 0)) {
+    start = 1;
   }
 
-  uint8_t bytesInFIFO = SPIgetRegValue(RADIOLIB_CC1101_REG_RXBYTES, 6, 0);
-  size_t readBytes = 0;
-  uint32_t lastPop = millis();
+  // user requested less data than we got, only return what was requested
+  size_t end = length;
+  if((len != 0) && (len < length - start)) {
+    end = start + len;
+  }
 
-  // keep reading from FIFO until we get all the packet.
-  while (readBytes < length) {
-    if (bytesInFIFO == 0) {
-      if (millis() - lastPop > 5) {
-        // readData was required to read a packet longer than the one received.
-        RADIOLIB_DEBUG_PRINTLN(F("No data for more than 5mS. Stop here."));
+  // check if status bytes are enabled (default: RADIOLIB_CC1101_APPEND_STATUS_ON)
+  uint8_t status[2];
+  uint8_t statusLen = 0;
+  if(SPIgetRegValue(RADIOLIB_CC1101_REG_PKTCTRL1, 2, 2) == RADIOLIB_CC1101_APPEND_STATUS_ON) {
+    statusLen = 2;
+  }
+
+  // the rest of the packet may still be arriving, wait at most a few byte periods for each new byte
+  uint32_t timeout = 1000 + (uint32_t)(32000.0 / _br);
+  uint32_t lastPop = _mod->micros();
+  size_t total = length + statusLen;
+  size_t pos = 0;
+  bool ended = false;
+  int16_t state = RADIOLIB_ERR_NONE;
+  while(pos < total) {
+    uint8_t rxBytes = getFifoBytes(RADIOLIB_CC1101_REG_RXBYTES);
+    if(rxBytes & RADIOLIB_CC1101_RXFIFO_OVERFLOW) {
+      state = RADIOLIB_ERR_RX_FIFO_OVERFLOW;
+      break;
+    }
+
+    // the last byte in FIFO must not be read until the whole packet including status bytes has arrived (CC1101 errata)
+    // next packet may already be in FIFO when the radio stays in Rx after the packet
+    uint8_t num = rxBytes & RADIOLIB_CC1101_NUM_RXBYTES;
+    if(num > total - pos) {
+      num = total - pos;
+    } else if((num > 0) && (num < total - pos)) {
+      num--;
+    }
+
+    if(num == 0) {
+      // nothing more will arrive once the radio went idle, but check FIFO once more in case it did so just now
+      bool idle = (SPIgetRegValue(RADIOLIB_CC1101_REG_MARCSTATE, 4, 0) == RADIOLIB_CC1101_MARC_STATE_IDLE);
+      if((idle && ended) || (_mod->micros() - lastPop > timeout)) {
+        RADIOLIB_DEBUG_PRINTLN(F("Packet was not received completely."));
+        state = RADIOLIB_ERR_RX_TIMEOUT;
         break;
-      } else {
-        delay(1);
-        bytesInFIFO = SPIgetRegValue(RADIOLIB_CC1101_REG_RXBYTES, 6, 0);
-        continue;
       }
+      ended = idle;
+      _mod->yield();
+      continue;
     }
 
-    // read the minimum between "remaining length" and bytesInFifo
-    uint8_t bytesToRead = min((uint8_t)(length - readBytes), bytesInFIFO);
-    SPIreadRegisterBurst(RADIOLIB_CC1101_REG_FIFO, bytesToRead, &(data[readBytes]));
-    readBytes += bytesToRead;
-    lastPop = millis();
-
-    // Get how many bytes are left in FIFO.
-    bytesInFIFO = SPIgetRegValue(RADIOLIB_CC1101_REG_RXBYTES, 6, 0);
+    // read the packet in bursts, skipping address byte and the part user did not request
+    while(num > 0) {
+      uint8_t chunk = num;
+      uint8_t dummy[RADIOLIB_CC1101_FIFO_SIZE];
+      uint8_t* ptr = dummy;
+      if(pos < start) {
+        chunk = 1;
+      } else if(pos < end) {
+        chunk = min((size_t)num, end - pos);
+        ptr = &data[pos - start];
+      } else if(pos < length) {
+        chunk = min((size_t)num, length - pos);
+      } else {
+        ptr = &status[pos - length];
+      }
+      SPIreadRegisterBurst(RADIOLIB_CC1101_REG_FIFO, chunk, ptr);
+      pos += chunk;
+      num -= chunk;
+    }
+    lastPop = _mod->micros();
   }
 
-  // check if status bytes are enabled (default: RADIOLIB_CC1101_APPEND_STATUS_ON)
-  bool isAppendStatus = SPIgetRegValue(RADIOLIB_CC1101_REG_PKTCTRL1, 2, 2) == RADIOLIB_CC1101_APPEND_STATUS_ON;
-
-  // for some reason, we need this delay here to get the correct status bytes
-  delay(3);
+  // clear internal flag so getPacketLength can return the new packet length
+  _packetLengthQueried = false;
 
-  // If status byte is enabled at least 2 bytes (2 status bytes + any following packet) will remain in FIFO.
-  if (isAppendStatus) {
-    // read RSSI byte
-    _rawRSSI = SPIgetRegValue(RADIOLIB_CC1101_REG_FIFO);
+  if(state != RADIOLIB_ERR_NONE) {
+    // rest of the packet is lost, Rx FIFO can only be flushed in idle or overflow state
+    standby();
+    SPIsendCommand(RADIOLIB_CC1101_CMD_FLUSH_RX);
+    return(state);
+  }
 
-    // read LQI and CRC byte
-    uint8_t val = SPIgetRegValue(RADIOLIB_CC1101_REG_FIFO);
-    _rawLQI = val & 0x7F;
+  if(statusLen > 0) {
+    // RSSI byte, LQI and CRC byte
+    _rawRSSI = status[0];
+    _rawLQI = status[1] & 0x7F;
 
     // check CRC
-    if (_crcOn && (val & RADIOLIB_CC1101_CRC_OK) == RADIOLIB_CC1101_CRC_ERROR) {
-      _packetLengthQueried = false;
-      return (RADIOLIB_ERR_CRC_MISMATCH);
+    if(_crcOn && (status[1] & RADIOLIB_CC1101_CRC_OK) == RADIOLIB_CC1101_CRC_ERROR) {
+      state = RADIOLIB_ERR_CRC_MISMATCH;
     }
   }
 
-  // clear internal flag so getPacketLength can return the new packet length
-  _packetLengthQueried = false;
-
   // Flush then standby according to RXOFF_MODE (default: RADIOLIB_CC1101_RXOFF_IDLE)
   if (SPIgetRegValue(RADIOLIB_CC1101_REG_MCSM1, 3, 2) == RADIOLIB_CC1101_RXOFF_IDLE) {
 
@@ -429,9 +402,367 @@ int16_t CC1101::readData(uint8_t* data, size_t len) {
     standby();
   }
 
+  return(state);
+}
+
+int16_t CC1101::startReceiveWOR(uint32_t period, float dutyCycle, bool rssiExit, uint8_t pqt) {
+  if(pqt > 7) {
+    return(RADIOLIB_ERR_INVALID_PREAMBLE_QUALITY);
+  }
+
+  // find the finest EVENT0 resolution that can cover the period
+  uint32_t event0 = 0;
+  uint8_t res = 0;
+  for(; res <= RADIOLIB_CC1101_WOR_RES_2_15; res++) {
+    event0 = (uint32_t)(((float)period * 1000.0) / (RADIOLIB_CC1101_WOR_EVENT0_STEP * (float)((uint32_t)1 << (5*res))) + 0.5);
+    if(event0 <= 0xFFFF) {
+      break;
+    }
+  }
+  if((res > RADIOLIB_CC1101_WOR_RES_2_15) || (event0 == 0)) {
+    return(RADIOLIB_ERR_INVALID_WOR_PERIOD);
+  }
+
+  // Rx window is a fraction of the period: (1 + 4*WOR_RES) / (8 * 2^(5*WOR_RES) * 2^RX_TIME), take the shortest one that is not below requested
+  uint8_t rxTime = 0;
+  for(uint8_t i = 1; i < RADIOLIB_CC1101_WOR_RX_TIME_NUM; i++) {
+    float duty = (100.0 * (float)(1 + 4*res)) / (8.0 * (float)((uint32_t)1 << (5*res + i)));
+    if(duty < dutyCycle) {
+      break;
+    }
+    rxTime = i;
+  }
+
+  // set mode to standby
+  int16_t state = standby();
+  RADIOLIB_ASSERT(state);
+
+  // flush Rx FIFO
+  SPIsendCommand(RADIOLIB_CC1101_CMD_FLUSH_RX);
+
+  // set GDO0 mapping, same as in continuous reception
+  state = SPIsetRegValue(RADIOLIB_CC1101_REG_IOCFG0, RADIOLIB_CC1101_GDOX_RX_FIFO_FULL_OR_PKT_END);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_FIFOTHR, RADIOLIB_CC1101_FIFO_THR_TX_61_RX_4, 3, 0);
+  RADIOLIB_ASSERT(state);
+
+  // wake-up period
+  state = SPIsetRegValue(RADIOLIB_CC1101_REG_WOREVT1, (uint8_t)(event0 >> 8));
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_WOREVT0, (uint8_t)(event0 & 0xFF));
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_WORCTRL, RADIOLIB_CC1101_RC_POWER_UP | RADIOLIB_CC1101_EVENT1_TIMEOUT_48 | RADIOLIB_CC1101_RC_CAL_ON | res);
+  RADIOLIB_ASSERT(state);
+
+  // Rx window, ended early on no carrier, or extended on preamble (or sync word when preamble quality is not checked)
+  state = SPIsetRegValue(RADIOLIB_CC1101_REG_MCSM2, (rssiExit ? RADIOLIB_CC1101_RX_TIMEOUT_RSSI_ON : RADIOLIB_CC1101_RX_TIMEOUT_RSSI_OFF) |
+                                                     ((pqt > 0) ? RADIOLIB_CC1101_RX_TIMEOUT_QUAL_ON : RADIOLIB_CC1101_RX_TIMEOUT_QUAL_OFF) | rxTime, 4, 0);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_PKTCTRL1, pqt << 5, 7, 5);
+
+  // calibrating on every wake-up would take longer than the Rx window itself, calibration from hop table is kept
+  if(_hopTable == NULL) {
+    state |= SPIsetRegValue(RADIOLIB_CC1101_REG_MCSM0, RADIOLIB_CC1101_FS_AUTOCAL_RXTX_TO_IDLE_4TH, 5, 4);
+    RADIOLIB_ASSERT(state);
+
+    // calibrate now
+    SPIsendCommand(RADIOLIB_CC1101_CMD_CAL);
+    state = waitCalibration();
+    if(state != RADIOLIB_ERR_NONE) {
+      worRestore();
+      return(state);
+    }
+  }
+  RADIOLIB_ASSERT(state);
+
+  // set RF switch (if present)
+  _mod->setRfSwitchState(HIGH, LOW);
+
+  // start the wake-on-radio timer
+  _worActive = true;
+  SPIsendCommand(RADIOLIB_CC1101_CMD_WOR_RESET);
+  SPIsendCommand(RADIOLIB_CC1101_CMD_WOR);
+  return(state);
+}
+
+int16_t CC1101::transmitLongPreamble(uint8_t* data, size_t len, uint32_t preambleTime, uint8_t addr) {
+  // check packet length
+  if((len > RADIOLIB_CC1101_MAX_PACKET_LENGTH) || ((_packetLengthConfig == RADIOLIB_CC1101_LENGTH_CONFIG_VARIABLE) && (len > RADIOLIB_CC1101_MAX_PACKET_LENGTH - 1))) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // set mode to standby
+  standby();
+
+  // flush Tx FIFO
+  SPIsendCommand(RADIOLIB_CC1101_CMD_FLUSH_TX);
+
+  // set GDO2 mapping
+  int16_t state = SPIsetRegValue(RADIOLIB_CC1101_REG_IOCFG2, RADIOLIB_CC1101_GDOX_SYNC_WORD_SENT_OR_RECEIVED, 5, 0);
+  RADIOLIB_ASSERT(state);
+
+  // preamble is repeated for as long as Tx FIFO is empty
+  _mod->setRfSwitchState(LOW, HIGH);
+  SPIsendCommand(RADIOLIB_CC1101_CMD_TX);
+  uint32_t start = _mod->millis();
+  while(_mod->millis() - start < preambleTime) {
+    _mod->yield();
+  }
+
+  // the packet follows as soon as it is in FIFO
+  writePacket(data, len, addr, true);
+
+  // calculate timeout (5ms + 500 % of expected time-on-air)
+  uint32_t timeout = 5000000 + (uint32_t)((((float)(len * 8)) / (_br * 1000.0)) * 5000000.0);
+  return(waitTransmit(timeout));
+}
+
+int16_t CC1101::setHopTable(CC1101HopChannel_t* table, float* freqs, uint8_t num) {
+  if((table == NULL) || (freqs == NULL)) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(num == 0) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  // power amplifier table is set for a single band
+  for(uint8_t i = 1; i < num; i++) {
+    if(((freqs[i] < 464.0) != (freqs[0] < 464.0)) || ((freqs[i] < 348.0) != (freqs[0] < 348.0))) {
+      return(RADIOLIB_ERR_INVALID_FREQUENCY);
+    }
+  }
+
+  // calibrations of the old table must not be used
+  int16_t state = clearHopTable();
+  RADIOLIB_ASSERT(state);
+
+  // calibrate each channel
+  for(uint8_t i = 0; i < num; i++) {
+    state = setFrequency(freqs[i]);
+    RADIOLIB_ASSERT(state);
+
+    SPIsendCommand(RADIOLIB_CC1101_CMD_CAL);
+    state = waitCalibration();
+    RADIOLIB_ASSERT(state);
+
+    SPIreadRegisterBurst(RADIOLIB_CC1101_REG_FREQ2, 3, table[i].freq);
+    SPIreadRegisterBurst(RADIOLIB_CC1101_REG_FSCAL3, 3, table[i].fscal);
+  }
+
+  // cached calibration is used from now on
+  state = SPIsetRegValue(RADIOLIB_CC1101_REG_MCSM0, RADIOLIB_CC1101_FS_AUTOCAL_NEVER, 5, 4);
+  RADIOLIB_ASSERT(state);
+  _hopTable = table;
+  _hopNum = num;
+  _hopIndex = num - 1;
+  return(state);
+}
+
+int16_t CC1101::hop(uint8_t index) {
+  if(_hopTable == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(index >= _hopNum) {
+    return(RADIOLIB_ERR_INVALID_FREQUENCY);
+  }
+
+  // frequency and calibration can only be changed in idle, the new setting applies on the next transition to Rx or Tx
+  standby();
+  SPIwriteRegisterBurst(RADIOLIB_CC1101_REG_FREQ2, _hopTable[index].freq, 3);
+  SPIwriteRegisterBurst(RADIOLIB_CC1101_REG_FSCAL3, _hopTable[index].fscal, 3);
+  _hopIndex = index;
+
+  // keep frequency in sync for methods that depend on it, e.g. setOutputPower
+  _freq = (float)(((uint32_t)_hopTable[index].freq[0] << 16) | ((uint32_t)_hopTable[index].freq[1] << 8) | _hopTable[index].freq[2]) * (RADIOLIB_CC1101_CRYSTAL_FREQ / 65536.0);
   return(RADIOLIB_ERR_NONE);
 }
 
+uint8_t CC1101::getHopChannel() {
+  return(_hopIndex);
+}
+
+int16_t CC1101::clearHopTable() {
+  if(_hopTable == NULL) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  _hopTable = NULL;
+  _hopNum = 0;
+  return(SPIsetRegValue(RADIOLIB_CC1101_REG_MCSM0, RADIOLIB_CC1101_FS_AUTOCAL_IDLE_TO_RXTX, 5, 4));
+}
+
+int16_t CC1101::startTransmitStream(uint8_t* data, size_t len) {
+  if(data == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  _streamData = data;
+  _streamFill = NULL;
+  return(streamStartTx(len));
+}
+
+int16_t CC1101::transmitStream(size_t len, size_t (*fill)(void*, uint8_t*, size_t), void* ctx) {
+  if(fill == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // the data are requested from the fill function every time the FIFO is refilled
+  _streamData = NULL;
+  _streamFill = fill;
+  _streamCtx = ctx;
+  int16_t state = streamStartTx(len);
+
+  // calculate timeout (5ms + 500 % of expected time-on-air)
+  uint32_t timeout = 5000 + (uint32_t)((((float)(len * 8)) / (_br * 1000.0)) * 5000000.0);
+  uint32_t start = _mod->micros();
+  while((state == RADIOLIB_ERR_NONE) && !_streamDone) {
+    _mod->yield();
+    if(_mod->micros() - start > timeout) {
+      stopStream();
+      state = RADIOLIB_ERR_TX_TIMEOUT;
+      break;
+    }
+    state = streamUpdate();
+  }
+
+  _streamFill = NULL;
+  return(state);
+}
+
+int16_t CC1101::streamStartTx(size_t len) {
+  if((len == 0) || (len > RADIOLIB_CC1101_STREAM_MAX_LENGTH)) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // set mode to standby
+  standby();
+
+  // flush Tx FIFO
+  SPIsendCommand(RADIOLIB_CC1101_CMD_FLUSH_TX);
+
+  // FIFO is bypassed in direct mode, switch to normal packet format until the stream ends
+  int16_t state = streamPacketMode();
+
+  // set GDO0 mapping: deasserted when Tx FIFO drops below 33 bytes
+  // set GDO2 mapping: deasserted at packet end
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_IOCFG0, RADIOLIB_CC1101_GDOX_TX_FIFO_ABOVE_THR, 5, 0);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_IOCFG2, RADIOLIB_CC1101_GDOX_SYNC_WORD_SENT_OR_RECEIVED, 5, 0);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_FIFOTHR, RADIOLIB_CC1101_FIFO_THR_TX_33_RX_32, 3, 0);
+  if(state != RADIOLIB_ERR_NONE) {
+    stopStream();
+    return(state);
+  }
+
+  _streamTx = true;
+  _streamLen = len;
+  _streamDone = false;
+  state = streamSetTotal(len);
+  if(state != RADIOLIB_ERR_NONE) {
+    stopStream();
+    return(state);
+  }
+
+  // length header goes first, the rest of the FIFO is filled with payload
+  uint8_t header[RADIOLIB_CC1101_STREAM_HEADER_LENGTH] = { (uint8_t)(len >> 8), (uint8_t)(len & 0xFF) };
+  SPIwriteRegisterBurst(RADIOLIB_CC1101_REG_FIFO, header, RADIOLIB_CC1101_STREAM_HEADER_LENGTH);
+  _streamPos = RADIOLIB_CC1101_STREAM_HEADER_LENGTH;
+  _streamActive = true;
+  state = streamRefill();
+  RADIOLIB_ASSERT(state);
+
+  // set RF switch (if present)
+  _mod->setRfSwitchState(LOW, HIGH);
+
+  // set mode to transmit
+  SPIsendCommand(RADIOLIB_CC1101_CMD_TX);
+
+  return(state);
+}
+
+int16_t CC1101::startReceiveStream(uint8_t* data, size_t maxLen) {
+  if(data == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // set mode to standby
+  standby();
+
+  // flush Rx FIFO
+  SPIsendCommand(RADIOLIB_CC1101_CMD_FLUSH_RX);
+
+  // FIFO is bypassed in direct mode, switch to normal packet format until the stream ends
+  int16_t state = streamPacketMode();
+
+  // set GDO0 mapping: asserted when Rx FIFO reaches 32 bytes or at packet end
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_IOCFG0, RADIOLIB_CC1101_GDOX_RX_FIFO_FULL_OR_PKT_END, 5, 0);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_FIFOTHR, RADIOLIB_CC1101_FIFO_THR_TX_33_RX_32, 3, 0);
+
+  // packet length is not known until the header arrives
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_PKTCTRL0, RADIOLIB_CC1101_LENGTH_CONFIG_INFINITE, 1, 0);
+  if(state != RADIOLIB_ERR_NONE) {
+    stopStream();
+    return(state);
+  }
+  _streamFixed = false;
+
+  _streamTx = false;
+  _streamData = data;
+  _streamMax = maxLen;
+  _streamLen = 0;
+  _streamTotal = 0;
+  _streamPos = 0;
+  _streamStatusLen = (SPIgetRegValue(RADIOLIB_CC1101_REG_PKTCTRL1, 2, 2) == RADIOLIB_CC1101_APPEND_STATUS_ON) ? 2 : 0;
+  _streamDone = false;
+  _streamActive = true;
+
+  // set RF switch (if present)
+  _mod->setRfSwitchState(HIGH, LOW);
+
+  // set mode to receive
+  SPIsendCommand(RADIOLIB_CC1101_CMD_RX);
+
+  return(state);
+}
+
+int16_t CC1101::streamUpdate() {
+  if(!_streamActive) {
+    return(RADIOLIB_ERR_STREAM_NOT_ACTIVE);
+  }
+
+  if(!_streamTx) {
+    return(streamDrain());
+  }
+
+  int16_t state = streamRefill();
+  RADIOLIB_ASSERT(state);
+  if((_streamPos < _streamTotal) || (getFifoBytes(RADIOLIB_CC1101_REG_TXBYTES) & RADIOLIB_CC1101_NUM_TXBYTES)) {
+    return(state);
+  }
+
+  // last byte left the FIFO, the packet is over once the radio leaves Tx (CRC is still being sent until then)
+  uint8_t marcState = SPIgetRegValue(RADIOLIB_CC1101_REG_MARCSTATE, 4, 0);
+  if((marcState != RADIOLIB_CC1101_MARC_STATE_IDLE) && (marcState != RADIOLIB_CC1101_MARC_STATE_RX) && (marcState != RADIOLIB_CC1101_MARC_STATE_FSTXON)) {
+    return(state);
+  }
+
+  standby();
+  _streamActive = false;
+  _streamDone = true;
+  return(streamRestore());
+}
+
+bool CC1101::isStreamFinished() {
+  return(_streamDone);
+}
+
+size_t CC1101::getStreamLength() {
+  return(_streamLen);
+}
+
+int16_t CC1101::stopStream() {
+  _streamActive = false;
+  standby();
+  SPIsendCommand(RADIOLIB_CC1101_CMD_FLUSH_TX);
+  SPIsendCommand(RADIOLIB_CC1101_CMD_FLUSH_RX);
+  return(streamRestore());
+}
+
 int16_t CC1101::setFrequency(float freq) {
   // check allowed frequency range
   if(!(((freq > 300.0) && (freq < 348.0)) ||
@@ -1032,6 +1363,311 @@ int16_t CC1101::setPacketMode(uint8_t mode, uint16_t len) {
   return(state);
 }
 
+void CC1101::writePacket(uint8_t* data, size_t len, uint8_t addr, bool txActive) {
+  // bytes put on FIFO before data.
+  uint8_t headerLen = 0;
+
+  // check address filtering
+  uint8_t filter = SPIgetRegValue(RADIOLIB_CC1101_REG_PKTCTRL1, 1, 0);
+
+  // optionally write packet length, address byte is included in it
+  if (_packetLengthConfig == RADIOLIB_CC1101_LENGTH_CONFIG_VARIABLE) {
+    SPIwriteRegister(RADIOLIB_CC1101_REG_FIFO, len + ((filter != RADIOLIB_CC1101_ADR_CHK_NONE) ? 1 : 0));
+    headerLen += 1;
+  }
+
+  // write address byte
+  if(filter != RADIOLIB_CC1101_ADR_CHK_NONE) {
+    SPIwriteRegister(RADIOLIB_CC1101_REG_FIFO, addr);
+    headerLen += 1;
+  }
+
+  // fill the FIFO.
+  size_t dataSent = min(len, (size_t)(RADIOLIB_CC1101_FIFO_SIZE - headerLen));
+  SPIwriteRegisterBurst(RADIOLIB_CC1101_REG_FIFO, data, dataSent);
+
+  if(!txActive) {
+    // set RF switch (if present)
+    _mod->setRfSwitchState(LOW, HIGH);
+
+    // set mode to transmit
+    SPIsendCommand(RADIOLIB_CC1101_CMD_TX);
+  }
+
+  // keep feeding the FIFO until the packet is over.
+  while (dataSent < len) {
+    // get number of bytes in FIFO.
+    uint8_t bytesInFIFO = SPIgetRegValue(RADIOLIB_CC1101_REG_TXBYTES, 6, 0);
+
+    // if there's room then put other data.
+    if (bytesInFIFO < RADIOLIB_CC1101_FIFO_SIZE) {
+      uint8_t bytesToWrite = min((size_t)(RADIOLIB_CC1101_FIFO_SIZE - bytesInFIFO), len - dataSent);
+      SPIwriteRegisterBurst(RADIOLIB_CC1101_REG_FIFO, &data[dataSent], bytesToWrite);
+      dataSent += bytesToWrite;
+    } else {
+      // wait for radio to send some data.
+      /*
+        * Does this work for all rates? If 1 ms is longer than the 1ms delay
+        * then the entire FIFO will be transmitted during that delay.
+        *
+        * TODO: test this on real hardware
+      */
+     delayMicroseconds(250);
+    }
+  }
+}
+
+int16_t CC1101::waitTransmit(uint32_t timeout) {
+  // wait for transmission start or timeout
+  uint32_t start = _mod->micros();
+  while(!_mod->digitalRead(_mod->getGpio())) {
+    _mod->yield();
+
+    if(_mod->micros() - start > timeout) {
+      finishTransmit();
+      return(RADIOLIB_ERR_TX_TIMEOUT);
+    }
+  }
+
+  // wait for transmission end or timeout
+  start = _mod->micros();
+  while(_mod->digitalRead(_mod->getGpio())) {
+    _mod->yield();
+
+    if(_mod->micros() - start > timeout) {
+      finishTransmit();
+      return(RADIOLIB_ERR_TX_TIMEOUT);
+    }
+  }
+
+  return(finishTransmit());
+}
+
+int16_t CC1101::worRestore() {
+  _worActive = false;
+
+  // the radio may be asleep, then the first access only wakes it up
+  uint32_t start = _mod->micros();
+  while(SPIgetRegValue(RADIOLIB_CC1101_REG_MARCSTATE, 4, 0) != RADIOLIB_CC1101_MARC_STATE_IDLE) {
+    SPIsendCommand(RADIOLIB_CC1101_CMD_IDLE);
+    _mod->yield();
+    if(_mod->micros() - start > RADIOLIB_CC1101_CAL_TIMEOUT) {
+      return(RADIOLIB_ERR_SPI_CMD_TIMEOUT);
+    }
+  }
+
+  int16_t state = SPIsetRegValue(RADIOLIB_CC1101_REG_MCSM2, RADIOLIB_CC1101_RX_TIMEOUT_RSSI_OFF | RADIOLIB_CC1101_RX_TIMEOUT_QUAL_OFF | RADIOLIB_CC1101_RX_TIMEOUT_OFF, 4, 0);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_PKTCTRL1, RADIOLIB_CC1101_PQT, 7, 5);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_MCSM0, (_hopTable == NULL) ? RADIOLIB_CC1101_FS_AUTOCAL_IDLE_TO_RXTX : RADIOLIB_CC1101_FS_AUTOCAL_NEVER, 5, 4);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_WORCTRL, RADIOLIB_CC1101_RC_POWER_DOWN, 7, 7);
+  return(state);
+}
+
+int16_t CC1101::waitCalibration() {
+  // calibration is over once the radio returns to idle
+  uint32_t start = _mod->micros();
+  while(SPIgetRegValue(RADIOLIB_CC1101_REG_MARCSTATE, 4, 0) != RADIOLIB_CC1101_MARC_STATE_IDLE) {
+    _mod->yield();
+    if(_mod->micros() - start > RADIOLIB_CC1101_CAL_TIMEOUT) {
+      return(RADIOLIB_ERR_SPI_CMD_TIMEOUT);
+    }
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+uint8_t CC1101::getFifoBytes(uint8_t reg) {
+  // FIFO byte count may be read incorrectly while it is being updated, read until two consecutive values match (CC1101 errata)
+  uint8_t prev = SPIreadRegister(reg);
+  for(uint8_t i = 0; i < 8; i++) {
+    uint8_t val = SPIreadRegister(reg);
+    if(val == prev) {
+      break;
+    }
+    prev = val;
+  }
+  return(prev);
+}
+
+int16_t CC1101::streamSetTotal(size_t len) {
+  // fixed length mode can not end the packet at PKTLEN = 0, pad one byte in that case
+  _streamTotal = len + RADIOLIB_CC1101_STREAM_HEADER_LENGTH;
+  if(_streamTotal < RADIOLIB_CC1101_STREAM_MIN_LENGTH) {
+    _streamTotal = RADIOLIB_CC1101_STREAM_MIN_LENGTH;
+  }
+  if((_streamTotal & 0xFF) == 0) {
+    _streamTotal++;
+  }
+
+  // the packet starts in infinite length mode, PKTLEN is only used after the switch to fixed length mode
+  _streamFixed = false;
+  int16_t state = SPIsetRegValue(RADIOLIB_CC1101_REG_PKTLEN, _streamTotal & 0xFF);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_PKTCTRL0, RADIOLIB_CC1101_LENGTH_CONFIG_INFINITE, 1, 0);
+  return(state);
+}
+
+int16_t CC1101::streamRefill() {
+  uint8_t txBytes = getFifoBytes(RADIOLIB_CC1101_REG_TXBYTES);
+  if(txBytes & RADIOLIB_CC1101_TXFIFO_UNDERFLOW) {
+    // radio ran out of data, the packet on air is broken and the state machine is stuck until the FIFO is flushed
+    stopStream();
+    return(RADIOLIB_ERR_TX_FIFO_UNDERFLOW);
+  }
+  uint8_t inFifo = txBytes & RADIOLIB_CC1101_NUM_TXBYTES;
+
+  // packet byte counter is 8-bit, switch to fixed length mode once the rest of the packet fits in it
+  int16_t state = RADIOLIB_ERR_NONE;
+  if(!_streamFixed && (_streamTotal - _streamPos + inFifo < 256)) {
+    state = SPIsetRegValue(RADIOLIB_CC1101_REG_PKTCTRL0, RADIOLIB_CC1101_LENGTH_CONFIG_FIXED, 1, 0);
+    if(state != RADIOLIB_ERR_NONE) {
+      stopStream();
+      return(state);
+    }
+    _streamFixed = true;
+  }
+
+  // fill all free space in one burst
+  uint8_t space = RADIOLIB_CC1101_FIFO_SIZE - inFifo;
+  size_t end = _streamLen + RADIOLIB_CC1101_STREAM_HEADER_LENGTH;
+  if((_streamPos < end) && (space > 0)) {
+    uint8_t num = (end - _streamPos < space) ? (end - _streamPos) : space;
+    if(_streamFill != NULL) {
+      uint8_t chunk[RADIOLIB_CC1101_FIFO_SIZE];
+      size_t filled = _streamFill(_streamCtx, chunk, num);
+      if(filled < num) {
+        memset(&chunk[filled], 0x00, num - filled);
+      }
+      SPIwriteRegisterBurst(RADIOLIB_CC1101_REG_FIFO, chunk, num);
+    } else {
+      SPIwriteRegisterBurst(RADIOLIB_CC1101_REG_FIFO, &_streamData[_streamPos - RADIOLIB_CC1101_STREAM_HEADER_LENGTH], num);
+    }
+    _streamPos += num;
+    space -= num;
+  }
+
+  // padding
+  while((_streamPos >= end) && (_streamPos < _streamTotal) && (space > 0)) {
+    SPIwriteRegister(RADIOLIB_CC1101_REG_FIFO, 0x00);
+    _streamPos++;
+    space--;
+  }
+
+  return(state);
+}
+
+int16_t CC1101::streamDrain() {
+  uint8_t rxBytes = getFifoBytes(RADIOLIB_CC1101_REG_RXBYTES);
+  if(rxBytes & RADIOLIB_CC1101_RXFIFO_OVERFLOW) {
+    // the packet is lost, flush the FIFO and listen for the next one
+    startReceiveStream(_streamData, _streamMax);
+    return(RADIOLIB_ERR_RX_FIFO_OVERFLOW);
+  }
+  uint8_t avail = rxBytes & RADIOLIB_CC1101_NUM_RXBYTES;
+
+  // length header
+  int16_t state = RADIOLIB_ERR_NONE;
+  if(_streamTotal == 0) {
+    // the last byte in FIFO can not be read while receiving, there is always at least one more byte after the header
+    if(avail <= RADIOLIB_CC1101_STREAM_HEADER_LENGTH) {
+      return(state);
+    }
+
+    uint8_t header[RADIOLIB_CC1101_STREAM_HEADER_LENGTH];
+    SPIreadRegisterBurst(RADIOLIB_CC1101_REG_FIFO, RADIOLIB_CC1101_STREAM_HEADER_LENGTH, header);
+    avail -= RADIOLIB_CC1101_STREAM_HEADER_LENGTH;
+    _streamPos = RADIOLIB_CC1101_STREAM_HEADER_LENGTH;
+    _streamLen = ((size_t)header[0] << 8) | header[1];
+    if((_streamLen == 0) || (_streamLen > _streamMax)) {
+      startReceiveStream(_streamData, _streamMax);
+      return(RADIOLIB_ERR_PACKET_TOO_LONG);
+    }
+
+    state = streamSetTotal(_streamLen);
+    if(state != RADIOLIB_ERR_NONE) {
+      stopStream();
+      return(state);
+    }
+  }
+
+  // packet byte counter is 8-bit, switch to fixed length mode once the rest of the packet fits in it
+  if(!_streamFixed && (_streamTotal < _streamPos + avail + 256)) {
+    state = SPIsetRegValue(RADIOLIB_CC1101_REG_PKTCTRL0, RADIOLIB_CC1101_LENGTH_CONFIG_FIXED, 1, 0);
+    if(state != RADIOLIB_ERR_NONE) {
+      stopStream();
+      return(state);
+    }
+    _streamFixed = true;
+  }
+
+  // the last byte in FIFO must not be read until the whole packet including status bytes has arrived (CC1101 errata)
+  size_t left = _streamTotal - _streamPos;
+  uint8_t num = avail;
+  if((avail > 0) && (avail < left + _streamStatusLen)) {
+    num = avail - 1;
+  }
+  if(num > left) {
+    num = left;
+  }
+
+  // payload
+  size_t end = _streamLen + RADIOLIB_CC1101_STREAM_HEADER_LENGTH;
+  if((_streamPos < end) && (num > 0)) {
+    uint8_t payload = (end - _streamPos < num) ? (end - _streamPos) : num;
+    SPIreadRegisterBurst(RADIOLIB_CC1101_REG_FIFO, payload, &_streamData[_streamPos - RADIOLIB_CC1101_STREAM_HEADER_LENGTH]);
+    _streamPos += payload;
+    num -= payload;
+    avail -= payload;
+  }
+
+  // padding
+  if(num > 0) {
+    uint8_t dummy[RADIOLIB_CC1101_FIFO_SIZE];
+    SPIreadRegisterBurst(RADIOLIB_CC1101_REG_FIFO, num, dummy);
+    _streamPos += num;
+    avail -= num;
+  }
+
+  if((_streamPos < _streamTotal) || (avail < _streamStatusLen)) {
+    return(state);
+  }
+
+  // whole packet was received
+  _streamActive = false;
+  _streamDone = true;
+  bool crcError = false;
+  if(_streamStatusLen > 0) {
+    _rawRSSI = SPIreadRegister(RADIOLIB_CC1101_REG_FIFO);
+    uint8_t val = SPIreadRegister(RADIOLIB_CC1101_REG_FIFO);
+    _rawLQI = val & 0x7F;
+    crcError = _crcOn && ((val & RADIOLIB_CC1101_CRC_OK) == RADIOLIB_CC1101_CRC_ERROR);
+  }
+
+  standby();
+  SPIsendCommand(RADIOLIB_CC1101_CMD_FLUSH_RX);
+  state = streamRestore();
+  if(crcError) {
+    return(RADIOLIB_ERR_CRC_MISMATCH);
+  }
+  return(state);
+}
+
+int16_t CC1101::streamPacketMode() {
+  // save the packet format only when no stream is running, received stream is restarted after errors
+  if(!_streamActive) {
+    _streamPktFormat = SPIgetRegValue(RADIOLIB_CC1101_REG_PKTCTRL0, 5, 4);
+  }
+  return(SPIsetRegValue(RADIOLIB_CC1101_REG_PKTCTRL0, RADIOLIB_CC1101_PKT_FORMAT_NORMAL, 5, 4));
+}
+
+int16_t CC1101::streamRestore() {
+  // go back to the packet format used before the stream, and to the packet length mode configured by user
+  int16_t state = SPIsetRegValue(RADIOLIB_CC1101_REG_PKTCTRL0, _streamPktFormat, 5, 4);
+  _streamPktFormat = RADIOLIB_CC1101_PKT_FORMAT_NORMAL;
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_PKTCTRL0, _packetLengthConfig, 1, 0);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_PKTLEN, _packetLength);
+  state |= SPIsetRegValue(RADIOLIB_CC1101_REG_FIFOTHR, RADIOLIB_CC1101_FIFO_THR_TX_61_RX_4, 3, 0);
+  return(state);
+}
+
 int16_t CC1101::SPIgetRegValue(uint8_t reg, uint8_t msb, uint8_t lsb) {
   // status registers require special command
   if(reg > RADIOLIB_CC1101_REG_TEST0) {
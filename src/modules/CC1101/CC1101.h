@@ -13,6 +13,13 @@
 #define RADIOLIB_CC1101_DIV_EXPONENT                           16
 #define RADIOLIB_CC1101_FIFO_SIZE                              64
 
+// streaming mode - 2-byte length header is sent ahead of the payload
+#define RADIOLIB_CC1101_STREAM_HEADER_LENGTH                   2
+#define RADIOLIB_CC1101_STREAM_MAX_LENGTH                      0xFFFF
+
+// streaming mode - shorter packets are padded, so that the receiver has time to read the header and switch to fixed length mode
+#define RADIOLIB_CC1101_STREAM_MIN_LENGTH                      64
+
 // CC1101 SPI commands
 #define RADIOLIB_CC1101_CMD_READ                               0b10000000
 #define RADIOLIB_CC1101_CMD_WRITE                              0b00000000
@@ -170,6 +177,7 @@
 #define RADIOLIB_CC1101_RX_ATTEN_12_DB                         0b00100000  //  5     4                     12 dB
 #define RADIOLIB_CC1101_RX_ATTEN_18_DB                         0b00110000  //  5     4                     18 dB
 #define RADIOLIB_CC1101_FIFO_THR_TX_61_RX_4                    0b00000000  //  3     0     TX fifo threshold: 61, RX fifo threshold: 4
+#define RADIOLIB_CC1101_FIFO_THR_TX_33_RX_32                   0b00000111  //  3     0     TX fifo threshold: 33, RX fifo threshold: 32
 
 // CC1101_REG_SYNC1
 #define RADIOLIB_CC1101_SYNC_WORD_MSB                          0xD3        //  7     0     sync word MSB
@@ -394,6 +402,11 @@
 #define RADIOLIB_CC1101_EVENT0_TIMEOUT_MSB                     0x87        //  7     0     EVENT0 timeout: t_event0 = (750 / f(XOSC)) * EVENT0_TIMEOUT * 2^(5 * WOR_RES) [s]
 #define RADIOLIB_CC1101_EVENT0_TIMEOUT_LSB                     0x6B        //  7     0         default value for 26 MHz crystal: 1.0 s
 
+// wake-on-radio EVENT0 step at WOR_RES_1 in us, number of Rx window settings and timeout of calibration or wake-up from sleep in us
+#define RADIOLIB_CC1101_WOR_EVENT0_STEP                        (750.0 / RADIOLIB_CC1101_CRYSTAL_FREQ)
+#define RADIOLIB_CC1101_WOR_RX_TIME_NUM                        7
+#define RADIOLIB_CC1101_CAL_TIMEOUT                            2000
+
 // CC1101_REG_WORCTRL
 #define RADIOLIB_CC1101_RC_POWER_UP                            0b00000000  //  7     7     power up RC oscillator
 #define RADIOLIB_CC1101_RC_POWER_DOWN                          0b10000000  //  7     7     power down RC oscillator
@@ -499,6 +512,14 @@
 #define RADIOLIB_CC1101_GDO2_ACTIVE                            0b00000100  //  2     2     GDO2 is active/asserted
 #define RADIOLIB_CC1101_GDO0_ACTIVE                            0b00000001  //  0     0     GDO0 is active/asserted
 
+// CC1101_REG_TXBYTES
+#define RADIOLIB_CC1101_TXFIFO_UNDERFLOW                       0b10000000  //  7     7     Tx FIFO underflowed
+#define RADIOLIB_CC1101_NUM_TXBYTES                            0b01111111  //  6     0     number of bytes in Tx FIFO
+
+// CC1101_REG_RXBYTES
+#define RADIOLIB_CC1101_RXFIFO_OVERFLOW                        0b10000000  //  7     7     Rx FIFO overflowed
+#define RADIOLIB_CC1101_NUM_RXBYTES                            0b01111111  //  6     0     number of bytes in Rx FIFO
+
 //Defaults
 #define RADIOLIB_CC1101_DEFAULT_FREQ                           434.0
 #define RADIOLIB_CC1101_DEFAULT_BR                             4.8
@@ -509,6 +530,23 @@
 #define RADIOLIB_CC1101_DEFAULT_SW                             {0x12, 0xAD}
 #define RADIOLIB_CC1101_DEFAULT_SW_LEN                         2
 
+/*!
+  \struct CC1101HopChannel_t
+
+  \brief Cached frequency and synthesizer calibration of a single hop channel.
+*/
+struct CC1101HopChannel_t {
+  /*!
+    \brief Frequency control word (FREQ2, FREQ1, FREQ0).
+  */
+  uint8_t freq[3];
+
+  /*!
+    \brief Synthesizer calibration result (FSCAL3, FSCAL2, FSCAL1).
+  */
+  uint8_t fscal[3];
+};
+
 /*!
   \class CC1101
 
@@ -572,6 +610,20 @@ class CC1101: public PhysicalLayer {
     */
     int16_t transmit(uint8_t* data, size_t len, uint8_t addr = 0) override;
 
+    /*!
+      \brief Blocking transmit of data produced in chunks as the FIFO is refilled. Uses the same packet format as startTransmitStream,
+      i.e. the data are preceded by 2-byte length header.
+
+      \param len Total number of bytes to transmit, up to 65535 bytes.
+
+      \param fill Function that writes the next chunk of data, see PhysicalLayer::transmitStream.
+
+      \param ctx Arbitrary pointer passed to the fill function.
+
+      \returns \ref status_codes
+    */
+    int16_t transmitStream(size_t len, size_t (*fill)(void*, uint8_t*, size_t), void* ctx) override;
+
     /*!
       \brief Blocking binary receive method.
       Overloads for string-based transmissions are implemented in PhysicalLayer.
@@ -680,14 +732,16 @@ class CC1101: public PhysicalLayer {
     int16_t finishTransmit() override;
 
     /*!
-      \brief Interrupt-driven receive method. GDO0 will be activated when full packet is received.
+      \brief Interrupt-driven receive method. GDO0 will be activated when Rx FIFO fills above threshold or the packet ends,
+      readData will then wait for the rest of the packet.
 
       \returns \ref status_codes
     */
     int16_t startReceive();
 
     /*!
-      \brief Reads data received after calling startReceive method.
+      \brief Reads data received after calling startReceive method. Packet is read from FIFO as it arrives,
+      the method returns as soon as status bytes of the packet are available.
 
       \param data Pointer to array to save the received binary data.
 
@@ -698,6 +752,138 @@ class CC1101: public PhysicalLayer {
     */
     int16_t readData(uint8_t* data, size_t len) override;
 
+    /*!
+      \brief Starts transmission of a packet of any length. The packet is sent in infinite length mode,
+      which is switched to fixed length mode for its last part, and the FIFO is refilled in bursts.
+      GDO0 is deactivated when Tx FIFO drops below threshold, streamUpdate must be called then (or periodically).
+      The receiver must use startReceiveStream, address filtering is not supported.
+
+      \param data Binary data to be sent. Must stay valid until the transmission is finished.
+
+      \param len Number of bytes to send, up to 65535 bytes.
+
+      \returns \ref status_codes
+    */
+    int16_t startTransmitStream(uint8_t* data, size_t len);
+
+    /*!
+      \brief Starts reception of a packet of any length sent by startTransmitStream.
+      GDO0 is activated when Rx FIFO is above threshold or the packet ended, streamUpdate must be called then (or periodically).
+
+      \param data Array to save the received data. Must stay valid until the reception is finished.
+
+      \param maxLen Size of the data array, longer packets are dropped.
+
+      \returns \ref status_codes
+    */
+    int16_t startReceiveStream(uint8_t* data, size_t maxLen);
+
+    /*!
+      \brief Refills Tx FIFO or drains Rx FIFO of the active stream. When Tx FIFO underflows or Rx FIFO overflows,
+      the FIFO is flushed and the stream is aborted (transmission) or restarted (reception) and error is returned.
+
+      \returns \ref status_codes
+    */
+    int16_t streamUpdate();
+
+    /*!
+      \brief Checks whether the stream was finished, i.e. the whole packet was sent or received.
+
+      \returns True when the stream was finished, false otherwise.
+    */
+    bool isStreamFinished();
+
+    /*!
+      \brief Gets length of the streamed packet. During reception, it is known once the length header was received.
+
+      \returns Packet length in bytes, 0 when not known yet.
+    */
+    size_t getStreamLength();
+
+    /*!
+      \brief Aborts the active stream, flushes FIFOs and restores packet length mode.
+
+      \returns \ref status_codes
+    */
+    int16_t stopStream();
+
+    /*!
+      \brief Starts wake-on-radio reception. The radio sleeps and periodically wakes up to listen for a short Rx window,
+      which is ended early when there is no carrier, or extended when preamble is detected. GDO0 is activated
+      the same way as in startReceive, readData should then be called. Any SPI access (including readData)
+      ends wake-on-radio mode, it must be started again after each packet. PA table is only retained for power level 0 (FSK).
+
+      \param period Wake-up period in ms, up to about 17 hours. Transmitters must use preamble longer than this,
+      see transmitLongPreamble.
+
+      \param dutyCycle Requested Rx window as percentage of the period. The shortest available window
+      that is not shorter than requested is used, available windows are 12.5 % to 0.2 % for period up to 1.89 s
+      and 1.95 % to 0.03 % for period up to 60 s.
+
+      \param rssiExit Whether to end Rx window as soon as no carrier is detected (carrier sense threshold). Defaults to true.
+
+      \param pqt Preamble quality threshold (0 - 7). When set, Rx window is extended after preamble is detected,
+      otherwise only after sync word is received. Defaults to 4.
+
+      \returns \ref status_codes
+    */
+    int16_t startReceiveWOR(uint32_t period, float dutyCycle, bool rssiExit = true, uint8_t pqt = 4);
+
+    /*!
+      \brief Blocking transmit with preamble long enough to be heard by wake-on-radio receivers.
+
+      \param data Binary data to be sent.
+
+      \param len Number of bytes to send.
+
+      \param preambleTime Preamble duration in ms, should be longer than wake-up period of the receiver.
+
+      \param addr Address to send the data to. Will only be added if address filtering was enabled.
+
+      \returns \ref status_codes
+    */
+    int16_t transmitLongPreamble(uint8_t* data, size_t len, uint32_t preambleTime, uint8_t addr = 0);
+
+    /*!
+      \brief Sets up frequency hopping. Each channel is calibrated once and the result is cached in the table,
+      automatic calibration is then disabled, so that hopping does not have to wait for the synthesizer to calibrate.
+      Calibration depends on temperature and supply voltage, this method should be called again when they change significantly.
+      setFrequency must not be used while the hop table is active.
+
+      \param table Array to save the cached channels, must have at least num entries and stay valid until clearHopTable is called.
+
+      \param freqs Channel frequencies in MHz, all of them must be in the same band.
+
+      \param num Number of channels.
+
+      \returns \ref status_codes
+    */
+    int16_t setHopTable(CC1101HopChannel_t* table, float* freqs, uint8_t num);
+
+    /*!
+      \brief Hops to a channel from the hop table by writing its cached frequency and calibration in SPI bursts.
+      The radio is left in standby, startReceive or startTransmit should be called next.
+
+      \param index Index of the channel in the hop table.
+
+      \returns \ref status_codes
+    */
+    int16_t hop(uint8_t index);
+
+    /*!
+      \brief Gets index of the hop table channel currently in use.
+
+      \returns Channel index.
+    */
+    uint8_t getHopChannel();
+
+    /*!
+      \brief Stops using the hop table and enables automatic calibration again.
+
+      \returns \ref status_codes
+    */
+    int16_t clearHopTable();
+
     // configuration methods
 
     /*!
@@ -1014,6 +1200,27 @@ class CC1101: public PhysicalLayer {
 
     int8_t _power = RADIOLIB_CC1101_DEFAULT_POWER;
 
+    // streaming - position counts all bytes after sync word, including length header and padding
+    bool _streamActive = false;
+    bool _streamDone = false;
+    bool _streamTx = false;
+    bool _streamFixed = false;
+    uint8_t* _streamData = NULL;
+    size_t (*_streamFill)(void*, uint8_t*, size_t) = NULL;
+    void* _streamCtx = NULL;
+    size_t _streamLen = 0;
+    size_t _streamMax = 0;
+    size_t _streamTotal = 0;
+    size_t _streamPos = 0;
+    uint8_t _streamStatusLen = 0;
+    uint8_t _streamPktFormat = RADIOLIB_CC1101_PKT_FORMAT_NORMAL;
+
+    bool _worActive = false;
+
+    CC1101HopChannel_t* _hopTable = NULL;
+    uint8_t _hopNum = 0;
+    uint8_t _hopIndex = 0;
+
 
     int16_t config();
     int16_t transmitDirect(bool sync, uint32_t frf);
@@ -1021,6 +1228,17 @@ class CC1101: public PhysicalLayer {
     int16_t directMode(bool sync);
     static void getExpMant(float target, uint16_t mantOffset, uint8_t divExp, uint8_t expMax, uint8_t& exp, uint8_t& mant);
     int16_t setPacketMode(uint8_t mode, uint16_t len);
+    void writePacket(uint8_t* data, size_t len, uint8_t addr, bool txActive);
+    int16_t waitTransmit(uint32_t timeout);
+    int16_t worRestore();
+    int16_t waitCalibration();
+    uint8_t getFifoBytes(uint8_t reg);
+    int16_t streamSetTotal(size_t len);
+    int16_t streamStartTx(size_t len);
+    int16_t streamRefill();
+    int16_t streamDrain();
+    int16_t streamPacketMode();
+    int16_t streamRestore();
 };
 
 #endif
@@ -133,6 +133,103 @@ int16_t RF69::transmit(uint8_t* data, size_t len, uint8_t addr) {
   return(finishTransmit());
 }
 
+int16_t RF69::transmitStream(size_t len, size_t (*fill)(void*, uint8_t*, size_t), void* ctx) {
+  if(fill == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(len == 0) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // set mode to standby
+  int16_t state = setMode(RADIOLIB_RF69_STANDBY);
+  RADIOLIB_ASSERT(state);
+  clearIRQFlags();
+
+  // save packet length configuration, payload length of 0 means unlimited length
+  // data mode is saved as well, FIFO is bypassed if the module was left in continuous mode by receiveDirect
+  uint8_t dataModul = _mod->SPIreadRegister(RADIOLIB_RF69_REG_DATA_MODUL);
+  uint8_t packetConfig1 = _mod->SPIreadRegister(RADIOLIB_RF69_REG_PACKET_CONFIG_1);
+  uint8_t payloadLen = _mod->SPIreadRegister(RADIOLIB_RF69_REG_PAYLOAD_LENGTH);
+  uint8_t fifoThresh = _mod->SPIreadRegister(RADIOLIB_RF69_REG_FIFO_THRESH);
+  bool unlimited = (len > RADIOLIB_RF69_MAX_PACKET_LENGTH_FIXED);
+  state = packetMode();
+  state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_PACKET_CONFIG_1, RADIOLIB_RF69_PACKET_FORMAT_FIXED, 7, 7);
+  state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_PAYLOAD_LENGTH, unlimited ? 0 : (uint8_t)len);
+  state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_FIFO_THRESH, RADIOLIB_RF69_TX_START_CONDITION_FIFO_NOT_EMPTY | RADIOLIB_RF69_FIFO_THRESH, 7, 0);
+
+  uint8_t chunk[RADIOLIB_RF69_MAX_PACKET_LENGTH];
+  size_t pos = 0;
+  size_t num = 0;
+  size_t filled = 0;
+  if(state == RADIOLIB_ERR_NONE) {
+    // fill the whole FIFO, then refill it every time it drops below threshold
+    num = (len < RADIOLIB_RF69_MAX_PACKET_LENGTH) ? len : RADIOLIB_RF69_MAX_PACKET_LENGTH;
+    filled = fill(ctx, chunk, num);
+    if(filled < num) {
+      memset(&chunk[filled], 0x00, num - filled);
+    }
+    _mod->SPIwriteRegisterBurst(RADIOLIB_RF69_REG_FIFO, chunk, num);
+    pos += num;
+
+    // enable +20 dBm operation
+    if(_power > 17) {
+      state = _mod->SPIsetRegValue(RADIOLIB_RF69_REG_OCP, RADIOLIB_RF69_OCP_OFF | 0x0F);
+      state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_TEST_PA1, RADIOLIB_RF69_PA1_20_DBM);
+      state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_TEST_PA2, RADIOLIB_RF69_PA2_20_DBM);
+    }
+  }
+
+  if(state == RADIOLIB_ERR_NONE) {
+    // set RF switch (if present)
+    _mod->setRfSwitchState(LOW, HIGH);
+
+    // set mode to transmit
+    state = setMode(RADIOLIB_RF69_TX);
+  }
+
+  // calculate timeout (5ms + 500 % of expected time-on-air)
+  uint32_t timeout = 5000 + (uint32_t)((((float)(len * 8)) / (_br * 1000.0)) * 5000000.0);
+  uint32_t start = _mod->micros();
+  while(state == RADIOLIB_ERR_NONE) {
+    uint8_t flags = _mod->SPIreadRegister(RADIOLIB_RF69_REG_IRQ_FLAGS_2);
+    if(pos < len) {
+      if(!(flags & RADIOLIB_RF69_IRQ_FIFO_LEVEL)) {
+        // at most FIFO_THRESH bytes are left, so the rest of the FIFO can be written in one burst
+        num = len - pos;
+        if(num > RADIOLIB_RF69_MAX_PACKET_LENGTH - RADIOLIB_RF69_FIFO_THRESH - 1) {
+          num = RADIOLIB_RF69_MAX_PACKET_LENGTH - RADIOLIB_RF69_FIFO_THRESH - 1;
+        }
+        filled = fill(ctx, chunk, num);
+        if(filled < num) {
+          memset(&chunk[filled], 0x00, num - filled);
+        }
+        _mod->SPIwriteRegisterBurst(RADIOLIB_RF69_REG_FIFO, chunk, num);
+        pos += num;
+      }
+    } else if(!unlimited && (flags & RADIOLIB_RF69_IRQ_PACKET_SENT)) {
+      break;
+    } else if(unlimited && !(flags & RADIOLIB_RF69_IRQ_FIFO_NOT_EMPTY)) {
+      // packet sent is not signalled in unlimited length mode, wait for the last byte to leave the shift register
+      _mod->delayMicroseconds((uint32_t)(8000.0 / _br) + 1);
+      break;
+    }
+
+    _mod->yield();
+    if(_mod->micros() - start > timeout) {
+      state = RADIOLIB_ERR_TX_TIMEOUT;
+    }
+  }
+
+  // restore packet length configuration and data mode, also when the stream failed
+  finishTransmit();
+  _mod->SPIwriteRegister(RADIOLIB_RF69_REG_DATA_MODUL, dataModul);
+  _mod->SPIwriteRegister(RADIOLIB_RF69_REG_PACKET_CONFIG_1, packetConfig1);
+  _mod->SPIwriteRegister(RADIOLIB_RF69_REG_PAYLOAD_LENGTH, payloadLen);
+  _mod->SPIwriteRegister(RADIOLIB_RF69_REG_FIFO_THRESH, fifoThresh);
+  return(state);
+}
+
 int16_t RF69::receive(uint8_t* data, size_t len) {
   // calculate timeout (500 ms + 400 full 64-byte packets at current bit rate)
   uint32_t timeout = 500000 + (1.0/(_br*1000.0))*(RADIOLIB_RF69_MAX_PACKET_LENGTH*400.0);
@@ -467,6 +564,110 @@ int16_t RF69::readData(uint8_t* data, size_t len) {
   return(RADIOLIB_ERR_NONE);
 }
 
+int16_t RF69::startListen(uint32_t rxPeriod, uint32_t idlePeriod, bool syncMatch) {
+  // get phase durations
+  uint8_t resRx = 0;
+  uint8_t coefRx = 0;
+  int16_t state = getListenCoef(rxPeriod, &resRx, &coefRx);
+  if(state != RADIOLIB_ERR_NONE) {
+    return(RADIOLIB_ERR_INVALID_RX_PERIOD);
+  }
+  uint8_t resIdle = 0;
+  uint8_t coefIdle = 0;
+  state = getListenCoef(idlePeriod, &resIdle, &coefIdle);
+  if(state != RADIOLIB_ERR_NONE) {
+    return(RADIOLIB_ERR_INVALID_SLEEP_PERIOD);
+  }
+
+  // set mode to standby, this also ends previous Listen mode
+  state = setMode(RADIOLIB_RF69_STANDBY);
+  RADIOLIB_ASSERT(state);
+
+  // set RX timeouts and DIO pin mapping, RSSI timeout sends the radio back to idle when no packet follows
+  state = _mod->SPIsetRegValue(RADIOLIB_RF69_REG_DIO_MAPPING_1, RADIOLIB_RF69_DIO0_PACK_PAYLOAD_READY, 7, 6);
+  state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_RX_TIMEOUT_1, RADIOLIB_RF69_TIMEOUT_RX_START_OFF);
+  state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_RX_TIMEOUT_2, RADIOLIB_RF69_TIMEOUT_RSSI_THRESH);
+  RADIOLIB_ASSERT(state);
+
+  // Listen mode resumes after packet or timeout, so that the radio never gets stuck in receive mode
+  uint8_t criteria = syncMatch ? RADIOLIB_RF69_LISTEN_ACCEPT_MATCH_SYNC_ADDRESS : RADIOLIB_RF69_LISTEN_ACCEPT_ABOVE_RSSI_THRESH;
+  state = _mod->SPIsetRegValue(RADIOLIB_RF69_REG_LISTEN_1, (resIdle << 6) | (resRx << 4) | criteria | RADIOLIB_RF69_LISTEN_END_KEEP_RX_TIMEOUT_RESUME, 7, 1);
+  state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_LISTEN_2, coefIdle);
+  state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_LISTEN_3, coefRx);
+  RADIOLIB_ASSERT(state);
+
+  // clear interrupt flags
+  clearIRQFlags();
+
+  // set RF switch (if present)
+  _mod->setRfSwitchState(HIGH, LOW);
+
+  // disable +20 dBm operation
+  state = _mod->SPIsetRegValue(RADIOLIB_RF69_REG_OCP, RADIOLIB_RF69_OCP_ON | RADIOLIB_RF69_OCP_TRIM);
+  state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_TEST_PA1, RADIOLIB_RF69_PA1_NORMAL);
+  state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_TEST_PA2, RADIOLIB_RF69_PA2_NORMAL);
+  RADIOLIB_ASSERT(state);
+
+  // enter Listen mode from standby, mode bits then select the mode entered after Listen mode is aborted
+  // operating mode changes on its own from now on, so it can't be verified
+  uint8_t opMode = _mod->SPIreadRegister(RADIOLIB_RF69_REG_OP_MODE) & RADIOLIB_RF69_SEQUENCER_ON;
+  _mod->SPIwriteRegister(RADIOLIB_RF69_REG_OP_MODE, opMode | RADIOLIB_RF69_LISTEN_ON | RADIOLIB_RF69_STANDBY);
+  _listenActive = true;
+
+  return(state);
+}
+
+int16_t RF69::transmitBurst(uint8_t* data, size_t len, uint32_t duration, uint8_t addr) {
+  // check packet length
+  if(len > RADIOLIB_RF69_MAX_PACKET_LENGTH) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // timeout for a single packet (5ms + 500 % of expected time-on-air)
+  uint32_t timeout = 5000 + (uint32_t)((((float)(len * 8)) / (_br * 1000.0)) * 5000000.0);
+
+  // first copy, transmission is started as soon as FIFO is not empty
+  int16_t state = _mod->SPIsetRegValue(RADIOLIB_RF69_REG_FIFO_THRESH, RADIOLIB_RF69_TX_START_CONDITION_FIFO_NOT_EMPTY, 7, 7);
+  RADIOLIB_ASSERT(state);
+  state = startTransmit(data, len, addr);
+  RADIOLIB_ASSERT(state);
+
+  // check address filtering
+  uint8_t filter = _mod->SPIgetRegValue(RADIOLIB_RF69_REG_PACKET_CONFIG_1, 2, 1);
+  bool addrByte = (filter == RADIOLIB_RF69_ADDRESS_FILTERING_NODE) || (filter == RADIOLIB_RF69_ADDRESS_FILTERING_NODE_BROADCAST);
+
+  uint32_t start = _mod->micros();
+  uint32_t last = start;
+  while(true) {
+    // wait until the previous copy has left FIFO, PacketSent flag stays set until transmit mode is left
+    while(_mod->SPIreadRegister(RADIOLIB_RF69_REG_IRQ_FLAGS_2) & RADIOLIB_RF69_IRQ_FIFO_NOT_EMPTY) {
+      _mod->yield();
+      if(_mod->micros() - last > timeout) {
+        finishTransmit();
+        return(RADIOLIB_ERR_TX_TIMEOUT);
+      }
+    }
+    last = _mod->micros();
+    if(last - start >= duration) {
+      break;
+    }
+
+    // queue the next copy right behind the one being sent, the packet handler starts it as soon as the current one ends
+    if(_packetLengthConfig == RADIOLIB_RF69_PACKET_FORMAT_VARIABLE) {
+      _mod->SPIwriteRegister(RADIOLIB_RF69_REG_FIFO, len);
+    }
+    if(addrByte) {
+      _mod->SPIwriteRegister(RADIOLIB_RF69_REG_FIFO, addr);
+    }
+    _mod->SPIwriteRegisterBurst(RADIOLIB_RF69_REG_FIFO, data, len);
+  }
+
+  // FIFO is empty, but the last byte and CRC are still being shifted out
+  _mod->delayMicroseconds((uint32_t)(24000.0 / _br) + 100);
+
+  return(finishTransmit());
+}
+
 int16_t RF69::setOOK(bool enableOOK) {
   // set OOK and if successful, save the new setting
   int16_t state = RADIOLIB_ERR_NONE;
@@ -1037,6 +1238,10 @@ int16_t RF69::setPacketMode(uint8_t mode, uint8_t len) {
 }
 
 int16_t RF69::setMode(uint8_t mode) {
+  // Listen mode has to be aborted first, mode bits alone do not end it
+  if(_listenActive) {
+    listenExit();
+  }
   return(_mod->SPIsetRegValue(RADIOLIB_RF69_REG_OP_MODE, mode, 4, 2));
 }
 
@@ -1052,4 +1257,26 @@ void RF69::clearFIFO(size_t count) {
   }
 }
 
+void RF69::listenExit() {
+  // abort has to be written together with ListenOn cleared, then cleared in a second access
+  uint8_t opMode = _mod->SPIreadRegister(RADIOLIB_RF69_REG_OP_MODE) & RADIOLIB_RF69_SEQUENCER_ON;
+  _mod->SPIwriteRegister(RADIOLIB_RF69_REG_OP_MODE, opMode | RADIOLIB_RF69_LISTEN_OFF | RADIOLIB_RF69_LISTEN_ABORT | RADIOLIB_RF69_STANDBY);
+  _mod->SPIwriteRegister(RADIOLIB_RF69_REG_OP_MODE, opMode | RADIOLIB_RF69_LISTEN_OFF | RADIOLIB_RF69_STANDBY);
+  _listenActive = false;
+}
+
+int16_t RF69::getListenCoef(uint32_t period, uint8_t* res, uint8_t* coef) {
+  // use the finest resolution that can express the period
+  const uint32_t steps[3] = { 64, 4100, 262000 };
+  for(uint8_t i = 0; i < 3; i++) {
+    uint32_t c = (period + steps[i]/2) / steps[i];
+    if(c <= 0xFF) {
+      *res = i + 1;
+      *coef = (c == 0) ? 1 : c;
+      return(RADIOLIB_ERR_NONE);
+    }
+  }
+  return(RADIOLIB_ERR_INVALID_RX_PERIOD);
+}
+
 #endif
@@ -12,6 +12,7 @@
 // RF69 physical layer properties
 #define RADIOLIB_RF69_FREQUENCY_STEP_SIZE                      61.03515625
 #define RADIOLIB_RF69_MAX_PACKET_LENGTH                        64
+#define RADIOLIB_RF69_MAX_PACKET_LENGTH_FIXED                  255
 #define RADIOLIB_RF69_CRYSTAL_FREQ                             32.0
 #define RADIOLIB_RF69_DIV_EXPONENT                             19
 
@@ -539,6 +540,20 @@ class RF69: public PhysicalLayer {
     */
     int16_t transmit(uint8_t* data, size_t len, uint8_t addr = 0) override;
 
+    /*!
+      \brief Blocking transmit of data produced in chunks as the FIFO is refilled. The packet is sent without length byte or address,
+      in fixed length mode when it is up to 255 bytes long, or in unlimited length mode otherwise. Packet length configuration is restored afterwards.
+
+      \param len Total number of bytes to transmit.
+
+      \param fill Function that writes the next chunk of data, see PhysicalLayer::transmitStream.
+
+      \param ctx Arbitrary pointer passed to the fill function.
+
+      \returns \ref status_codes
+    */
+    int16_t transmitStream(size_t len, size_t (*fill)(void*, uint8_t*, size_t), void* ctx) override;
+
     /*!
       \brief Blocking binary receive method.
       Overloads for string-based transmissions are implemented in PhysicalLayer.
@@ -725,6 +740,38 @@ class RF69: public PhysicalLayer {
     */
     int16_t readData(uint8_t* data, size_t len) override;
 
+    /*!
+      \brief Starts Listen mode. The radio cycles between idle and receive phases on its own and stays in receive mode
+      once a packet matching the criteria starts. DIO0 will be activated when full packet is received, it has to be read
+      using readData before the next receive phase starts. Listen mode ends when any other mode is entered.
+
+      \param rxPeriod Duration of receive phase in us. Must cover RSSI sampling, preamble and sync word.
+
+      \param idlePeriod Duration of idle phase in us, up to 66.8 seconds.
+
+      \param syncMatch Whether sync word and address have to match, otherwise RSSI above threshold is enough.
+      The threshold is set using setRSSIThreshold.
+
+      \returns \ref status_codes
+    */
+    int16_t startListen(uint32_t rxPeriod, uint32_t idlePeriod, bool syncMatch = true);
+
+    /*!
+      \brief Blocking method that repeats the same packet back-to-back without leaving transmit mode,
+      so that a receiver in Listen mode catches at least one copy.
+
+      \param data Binary data to be sent, up to 64 bytes.
+
+      \param len Number of bytes to send.
+
+      \param duration Duration of the burst in us. Should be longer than idle and receive period of the receiver.
+
+      \param addr Address to send the data to. Will only be added if address filtering was enabled.
+
+      \returns \ref status_codes
+    */
+    int16_t transmitBurst(uint8_t* data, size_t len, uint32_t duration, uint8_t addr = 0);
+
     // configuration methods
 
     /*!
@@ -1087,6 +1134,8 @@ class RF69: public PhysicalLayer {
 
     bool _bitSync = true;
 
+    bool _listenActive = false;
+
     int16_t config();
     int16_t directMode();
     int16_t setPacketMode(uint8_t mode, uint8_t len);
@@ -1097,6 +1146,11 @@ class RF69: public PhysicalLayer {
     int16_t setMode(uint8_t mode);
     void clearIRQFlags();
     void clearFIFO(size_t count);
+    void listenExit();
+    int16_t getListenCoef(uint32_t period, uint8_t* res, uint8_t* coef);
+
+    // allow secured link client to stream long frames through FIFO
+    friend class SecureLinkClient;
 };
 
 #endif
@@ -1049,6 +1049,9 @@ class SX126x: public PhysicalLayer {
 
     int16_t config(uint8_t modem);
     int16_t checkCommandResult();
+
+    // allow channel monitor to retune without image calibration
+    friend class ChannelMonitor;
 };
 
 #endif
@@ -193,6 +193,93 @@ int16_t SX127x::transmit(uint8_t* data, size_t len, uint8_t addr) {
   return(finishTransmit());
 }
 
+int16_t SX127x::transmitStream(size_t len, size_t (*fill)(void*, uint8_t*, size_t), void* ctx) {
+  if(fill == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(getActiveModem() != RADIOLIB_SX127X_FSK_OOK) {
+    return(RADIOLIB_ERR_WRONG_MODEM);
+  }
+  if((len == 0) || (len > RADIOLIB_SX127X_MAX_PACKET_LENGTH_FSK_STREAM)) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // set mode to standby
+  int16_t state = setMode(RADIOLIB_SX127X_STANDBY);
+  RADIOLIB_ASSERT(state);
+  clearIRQFlags();
+
+  // save packet length configuration, the stream is sent in fixed length mode with 11-bit length
+  // data mode is saved as well, FIFO is bypassed if the module was left in continuous mode by receiveDirect
+  uint8_t packetConfig1 = _mod->SPIreadRegister(RADIOLIB_SX127X_REG_PACKET_CONFIG_1);
+  uint8_t packetConfig2 = _mod->SPIreadRegister(RADIOLIB_SX127X_REG_PACKET_CONFIG_2);
+  uint8_t payloadLen = _mod->SPIreadRegister(RADIOLIB_SX127X_REG_PAYLOAD_LENGTH_FSK);
+  uint8_t fifoThresh = _mod->SPIreadRegister(RADIOLIB_SX127X_REG_FIFO_THRESH);
+  state = packetMode();
+  state |= _mod->SPIsetRegValue(RADIOLIB_SX127X_REG_PACKET_CONFIG_1, RADIOLIB_SX127X_PACKET_FIXED, 7, 7);
+  state |= _mod->SPIsetRegValue(RADIOLIB_SX127X_REG_PACKET_CONFIG_2, (uint8_t)(len >> 8), 2, 0);
+  state |= _mod->SPIsetRegValue(RADIOLIB_SX127X_REG_PAYLOAD_LENGTH_FSK, (uint8_t)(len & 0xFF));
+  state |= _mod->SPIsetRegValue(RADIOLIB_SX127X_REG_FIFO_THRESH, RADIOLIB_SX127X_TX_START_FIFO_NOT_EMPTY | RADIOLIB_SX127X_FIFO_THRESH, 7, 0);
+
+  uint8_t chunk[RADIOLIB_SX127X_MAX_PACKET_LENGTH_FSK];
+  size_t pos = 0;
+  size_t num = 0;
+  size_t filled = 0;
+  if(state == RADIOLIB_ERR_NONE) {
+    // fill the whole FIFO, then refill it every time it drops below threshold
+    num = (len < RADIOLIB_SX127X_MAX_PACKET_LENGTH_FSK) ? len : RADIOLIB_SX127X_MAX_PACKET_LENGTH_FSK;
+    filled = fill(ctx, chunk, num);
+    if(filled < num) {
+      memset(&chunk[filled], 0x00, num - filled);
+    }
+    _mod->SPIwriteRegisterBurst(RADIOLIB_SX127X_REG_FIFO, chunk, num);
+    pos += num;
+
+    // set RF switch (if present)
+    _mod->setRfSwitchState(LOW, HIGH);
+
+    // start transmission
+    state = setMode(RADIOLIB_SX127X_TX);
+  }
+
+  // calculate timeout (5ms + 500 % of expected time-on-air)
+  uint32_t timeout = 5000 + (uint32_t)((((float)(len * 8)) / (_br * 1000.0)) * 5000000.0);
+  uint32_t start = _mod->micros();
+  while(state == RADIOLIB_ERR_NONE) {
+    uint8_t flags = _mod->SPIreadRegister(RADIOLIB_SX127X_REG_IRQ_FLAGS_2);
+    if(pos < len) {
+      if(!(flags & RADIOLIB_SX127X_FLAG_FIFO_LEVEL)) {
+        // at most FIFO_THRESH bytes are left, so the rest of the FIFO can be written in one burst
+        num = len - pos;
+        if(num > RADIOLIB_SX127X_MAX_PACKET_LENGTH_FSK - RADIOLIB_SX127X_FIFO_THRESH - 1) {
+          num = RADIOLIB_SX127X_MAX_PACKET_LENGTH_FSK - RADIOLIB_SX127X_FIFO_THRESH - 1;
+        }
+        filled = fill(ctx, chunk, num);
+        if(filled < num) {
+          memset(&chunk[filled], 0x00, num - filled);
+        }
+        _mod->SPIwriteRegisterBurst(RADIOLIB_SX127X_REG_FIFO, chunk, num);
+        pos += num;
+      }
+    } else if(flags & RADIOLIB_SX127X_FLAG_PACKET_SENT) {
+      break;
+    }
+
+    _mod->yield();
+    if(_mod->micros() - start > timeout) {
+      state = RADIOLIB_ERR_TX_TIMEOUT;
+    }
+  }
+
+  // restore packet length configuration and data mode, also when the stream failed
+  finishTransmit();
+  _mod->SPIwriteRegister(RADIOLIB_SX127X_REG_PACKET_CONFIG_1, packetConfig1);
+  _mod->SPIwriteRegister(RADIOLIB_SX127X_REG_PACKET_CONFIG_2, packetConfig2);
+  _mod->SPIwriteRegister(RADIOLIB_SX127X_REG_PAYLOAD_LENGTH_FSK, payloadLen);
+  _mod->SPIwriteRegister(RADIOLIB_SX127X_REG_FIFO_THRESH, fifoThresh);
+  return(state);
+}
+
 int16_t SX127x::receive(uint8_t* data, size_t len) {
   // set mode to standby
   int16_t state = setMode(RADIOLIB_SX127X_STANDBY);
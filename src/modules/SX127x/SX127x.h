@@ -13,6 +13,7 @@
 #define RADIOLIB_SX127X_FREQUENCY_STEP_SIZE                    61.03515625
 #define RADIOLIB_SX127X_MAX_PACKET_LENGTH                      255
 #define RADIOLIB_SX127X_MAX_PACKET_LENGTH_FSK                  64
+#define RADIOLIB_SX127X_MAX_PACKET_LENGTH_FSK_STREAM           2047
 #define RADIOLIB_SX127X_CRYSTAL_FREQ                           32.0
 #define RADIOLIB_SX127X_DIV_EXPONENT                           19
 
@@ -652,6 +653,20 @@ class SX127x: public PhysicalLayer {
     */
     int16_t transmit(uint8_t* data, size_t len, uint8_t addr = 0) override;
 
+    /*!
+      \brief Blocking transmit of data produced in chunks as the FIFO is refilled, up to 2047 bytes long. Only available in FSK mode.
+      The packet is sent in fixed length mode without length byte or address, packet length configuration is restored afterwards.
+
+      \param len Total number of bytes to transmit.
+
+      \param fill Function that writes the next chunk of data, see PhysicalLayer::transmitStream.
+
+      \param ctx Arbitrary pointer passed to the fill function.
+
+      \returns \ref status_codes
+    */
+    int16_t transmitStream(size_t len, size_t (*fill)(void*, uint8_t*, size_t), void* ctx) override;
+
     /*!
       \brief Binary receive method. Will attempt to receive arbitrary binary data up to 255 bytes long using %LoRa or up to 63 bytes using FSK modem.
       For overloads to receive Arduino String, see PhysicalLayer::receive.
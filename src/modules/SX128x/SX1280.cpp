@@ -21,12 +21,20 @@ int16_t SX1280::range(bool master, uint32_t addr, uint16_t calTable[3][6]) {
     }
   }
 
+  // check whether the exchange timed out
+  uint16_t irq = getIrqStatus();
+
   // clear interrupt flags
   state = clearIrqStatus();
   RADIOLIB_ASSERT(state);
 
   // set mode to standby
   state = standby();
+  RADIOLIB_ASSERT(state);
+
+  if(irq & RADIOLIB_SX128X_IRQ_RANGING_MASTER_TIMEOUT) {
+    return(RADIOLIB_ERR_RANGING_TIMEOUT);
+  }
 
   return(state);
 }
@@ -74,7 +82,7 @@ int16_t SX1280::startRanging(bool master, uint32_t addr, uint16_t calTable[3][6]
   if(master) {
     addrReg = RADIOLIB_SX128X_REG_MASTER_RANGING_ADDRESS_BYTE_3;
     irqMask = RADIOLIB_SX128X_IRQ_RANGING_MASTER_RES_VALID | RADIOLIB_SX128X_IRQ_RANGING_MASTER_TIMEOUT;
-    irqDio1 = RADIOLIB_SX128X_IRQ_RANGING_MASTER_RES_VALID;
+    irqDio1 = RADIOLIB_SX128X_IRQ_RANGING_MASTER_RES_VALID | RADIOLIB_SX128X_IRQ_RANGING_MASTER_TIMEOUT;
   }
 
   // set ranging address
@@ -37,7 +37,8 @@ class SX1280: public SX1281 {
     int16_t range(bool master, uint32_t addr, uint16_t calTable[3][6] = NULL);
 
     /*!
-      \brief Interrupt-driven ranging method.
+      \brief Interrupt-driven ranging method. In master mode, DIO1 is activated both when the result is valid and when the exchange times out,
+      use getIrqStatus to tell the two apart.
 
       \param master Whether to execute ranging in master mode (true) or slave mode (false).
 
@@ -60,6 +61,8 @@ class SX1280: public SX1281 {
   private:
 #endif
 
+    // allow ranging client access to IRQ handling
+    friend class RangingClient;
 };
 
 #endif
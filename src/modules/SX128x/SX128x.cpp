@@ -1103,6 +1103,12 @@ float SX128x::getRSSI() {
   }
 }
 
+float SX128x::getRSSIInst() {
+  uint8_t rssiInst = 0;
+  SPIreadCommand(RADIOLIB_SX128X_CMD_GET_RSSI_INST, &rssiInst, 1);
+  return(-1.0 * rssiInst/2.0);
+}
+
 float SX128x::getSNR() {
   // check active modem
   uint8_t modem = getPacketType();
@@ -1293,8 +1299,8 @@ int16_t SX128x::writeBuffer(uint8_t* data, uint8_t numBytes, uint8_t offset) {
   return(SPIwriteCommand(cmd, 2, data, numBytes));
 }
 
-int16_t SX128x::readBuffer(uint8_t* data, uint8_t numBytes) {
-  uint8_t cmd[] = { RADIOLIB_SX128X_CMD_READ_BUFFER, RADIOLIB_SX128X_CMD_NOP };
+int16_t SX128x::readBuffer(uint8_t* data, uint8_t numBytes, uint8_t offset) {
+  uint8_t cmd[] = { RADIOLIB_SX128X_CMD_READ_BUFFER, offset };
   return(SPIreadCommand(cmd, 2, data, numBytes));
 }
 
@@ -752,6 +752,13 @@ class SX128x: public PhysicalLayer {
     */
     float getRSSI();
 
+    /*!
+      \brief Gets instantaneous RSSI value. The radio must be in receive mode.
+
+      \returns Instantaneous RSSI value in dBm, in steps of 0.5 dBm.
+    */
+    float getRSSIInst();
+
     /*!
       \brief Gets SNR (Signal to Noise Ratio) of the last received packet. Only available for LoRa or ranging modem.
 
@@ -868,7 +875,7 @@ class SX128x: public PhysicalLayer {
     int16_t writeRegister(uint16_t addr, uint8_t* data, uint8_t numBytes);
     int16_t readRegister(uint16_t addr, uint8_t* data, uint8_t numBytes);
     int16_t writeBuffer(uint8_t* data, uint8_t numBytes, uint8_t offset = 0x00);
-    int16_t readBuffer(uint8_t* data, uint8_t numBytes);
+    int16_t readBuffer(uint8_t* data, uint8_t numBytes, uint8_t offset = 0x00);
     int16_t setTx(uint16_t periodBaseCount = RADIOLIB_SX128X_TX_TIMEOUT_NONE, uint8_t periodBase = RADIOLIB_SX128X_PERIOD_BASE_15_625_US);
     int16_t setRx(uint16_t periodBaseCount, uint8_t periodBase = RADIOLIB_SX128X_PERIOD_BASE_15_625_US);
     int16_t setCad();
@@ -920,6 +927,12 @@ class SX128x: public PhysicalLayer {
 
     int16_t config(uint8_t modem);
     int16_t checkCommandResult();
+
+    // allow BLE advertising client access to raw packet buffer and BLE parameters
+    friend class BLEAdvClient;
+
+    // allow bulk transfer client to stage frames in radio buffer directly
+    friend class BulkTransferClient;
 };
 
 #endif
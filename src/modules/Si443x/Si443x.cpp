@@ -82,15 +82,18 @@ int16_t Si443x::transmit(uint8_t* data, size_t len, uint8_t addr) {
   int16_t state = startTransmit(data, len, addr);
   RADIOLIB_ASSERT(state);
 
-  // wait for transmission end or timeout
+  // wait for transmission end or timeout, refill FIFO on the way if the packet does not fit
+  int remLen = len;
   uint32_t start = _mod->micros();
-  while(_mod->digitalRead(_mod->getIrq())) {
-    _mod->yield();
-    if(_mod->micros() - start > timeout) {
-      finishTransmit();
-      return(RADIOLIB_ERR_TX_TIMEOUT);
+  do {
+    while(_mod->digitalRead(_mod->getIrq())) {
+      _mod->yield();
+      if(_mod->micros() - start > timeout) {
+        finishTransmit();
+        return(RADIOLIB_ERR_TX_TIMEOUT);
+      }
     }
-  }
+  } while(!fifoAdd(data, len, &remLen));
 
   return(finishTransmit());
 }
@@ -210,9 +213,103 @@ void Si443x::clearIrqAction() {
   _mod->detachInterrupt(RADIOLIB_DIGITAL_PIN_TO_INTERRUPT(_mod->getIrq()));
 }
 
+void Si443x::setFifoEmptyAction(void (*func)(void)) {
+  // Tx FIFO almost empty interrupt is enabled by startTransmit for packets longer than FIFO
+  setIrqAction(func);
+}
+
+void Si443x::clearFifoEmptyAction() {
+  clearIrqAction();
+}
+
+void Si443x::setFifoFullAction(void (*func)(void)) {
+  // Rx FIFO almost full interrupt is only enabled on request, otherwise it would fire before readData for every long packet
+  _streamRx = true;
+  setIrqAction(func);
+}
+
+void Si443x::clearFifoFullAction() {
+  _streamRx = false;
+  clearIrqAction();
+}
+
+bool Si443x::fifoAdd(uint8_t* data, int totalLen, int* remLen) {
+  // read interrupt status, this also releases nIRQ so that it can signal the next event
+  uint8_t status[2];
+  _mod->SPIreadRegisterBurst(RADIOLIB_SI443X_REG_INTERRUPT_STATUS_1, 2, status);
+
+  // the first FIFO load was already written in startTransmit
+  if(*remLen == totalLen) {
+    *remLen -= RADIOLIB_SI443X_MAX_PACKET_LENGTH;
+  }
+
+  // check if there is still something left to send
+  if(*remLen <= 0) {
+    // the packet is done once the last byte left the transmitter
+    return((status[0] & RADIOLIB_SI443X_PACKET_SENT_INTERRUPT) != 0);
+  }
+
+  if(!(status[0] & RADIOLIB_SI443X_TX_FIFO_ALMOST_EMPTY_INTERRUPT)) {
+    return(false);
+  }
+
+  // at most threshold bytes are left in FIFO, fill up the rest
+  int len = *remLen;
+  if(len > RADIOLIB_SI443X_MAX_PACKET_LENGTH - RADIOLIB_SI443X_FIFO_THRESH) {
+    len = RADIOLIB_SI443X_MAX_PACKET_LENGTH - RADIOLIB_SI443X_FIFO_THRESH;
+  }
+  _mod->SPIwriteRegisterBurst(RADIOLIB_SI443X_REG_FIFO_ACCESS, &data[totalLen - *remLen], len);
+  *remLen -= len;
+
+  // we're not done yet
+  return(false);
+}
+
+bool Si443x::fifoGet(volatile uint8_t* data, int totalLen, volatile int* rcvLen) {
+  // read interrupt status, this also releases nIRQ so that it can signal the next event
+  uint8_t status[2];
+  _mod->SPIreadRegisterBurst(RADIOLIB_SI443X_REG_INTERRUPT_STATUS_1, 2, status);
+
+  if(status[0] & RADIOLIB_SI443X_CRC_ERROR_INTERRUPT) {
+    // drop the packet and keep listening for the next one
+    _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_OP_FUNC_CONTROL_2, RADIOLIB_SI443X_RX_FIFO_RESET, 1, 1);
+    _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_OP_FUNC_CONTROL_2, RADIOLIB_SI443X_RX_FIFO_CLEAR, 1, 1);
+    _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_OP_FUNC_CONTROL_1, RADIOLIB_SI443X_RX_ON | RADIOLIB_SI443X_XTAL_ON);
+    *rcvLen = 0;
+    return(false);
+  }
+
+  // get the number of bytes waiting in FIFO
+  int len = 0;
+  bool done = status[0] & RADIOLIB_SI443X_VALID_PACKET_RECEIVED_INTERRUPT;
+  if(done) {
+    // the rest of the packet
+    len = _mod->SPIreadRegister(RADIOLIB_SI443X_REG_RECEIVED_PACKET_LENGTH) - *rcvLen;
+  } else if(status[0] & RADIOLIB_SI443X_RX_FIFO_ALMOST_FULL_INTERRUPT) {
+    // more than threshold bytes are in FIFO
+    len = RADIOLIB_SI443X_FIFO_THRESH;
+  }
+  if(len <= 0) {
+    return(done);
+  }
+
+  // read what fits into the buffer and discard the rest
+  int readLen = totalLen - *rcvLen;
+  if(readLen > len) {
+    readLen = len;
+  } else if(readLen < 0) {
+    readLen = 0;
+  }
+  _mod->SPIreadRegisterBurst(RADIOLIB_SI443X_REG_FIFO_ACCESS, readLen, (uint8_t*)&data[*rcvLen]);
+  (*rcvLen) += readLen;
+  clearFIFO(len - readLen);
+
+  return(done);
+}
+
 int16_t Si443x::startTransmit(uint8_t* data, size_t len, uint8_t addr) {
-  // check packet length
-  if(len > RADIOLIB_SI443X_MAX_PACKET_LENGTH) {
+  // check packet length, packets longer than FIFO can only be streamed in variable length mode
+  if((len > RADIOLIB_SI443X_MAX_STREAM_LENGTH) || ((len > RADIOLIB_SI443X_MAX_PACKET_LENGTH) && (_packetLengthConfig == RADIOLIB_SI443X_FIXED_PACKET_LENGTH_ON))) {
     return(RADIOLIB_ERR_PACKET_TOO_LONG);
   }
 
@@ -235,14 +332,20 @@ int16_t Si443x::startTransmit(uint8_t* data, size_t len, uint8_t addr) {
   /// \todo use header as address field?
   (void)addr;
 
-  // write packet to FIFO
-  _mod->SPIwriteRegisterBurst(RADIOLIB_SI443X_REG_FIFO_ACCESS, data, len);
+  // write packet to FIFO, the rest of a long packet is added by fifoAdd when FIFO is almost empty
+  uint8_t irqEnable = RADIOLIB_SI443X_PACKET_SENT_ENABLED;
+  size_t fifoLen = len;
+  if(len > RADIOLIB_SI443X_MAX_PACKET_LENGTH) {
+    fifoLen = RADIOLIB_SI443X_MAX_PACKET_LENGTH;
+    irqEnable |= RADIOLIB_SI443X_TX_FIFO_ALMOST_EMPTY_ENABLED;
+  }
+  _mod->SPIwriteRegisterBurst(RADIOLIB_SI443X_REG_FIFO_ACCESS, data, fifoLen);
 
   // set RF switch (if present)
   _mod->setRfSwitchState(LOW, HIGH);
 
   // set interrupt mapping
-  _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_INTERRUPT_ENABLE_1, RADIOLIB_SI443X_PACKET_SENT_ENABLED);
+  _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_INTERRUPT_ENABLE_1, irqEnable);
   _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_INTERRUPT_ENABLE_2, 0x00);
 
   // set mode to transmit
@@ -275,7 +378,11 @@ int16_t Si443x::startReceive() {
   _mod->setRfSwitchState(HIGH, LOW);
 
   // set interrupt mapping
-  _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_INTERRUPT_ENABLE_1, RADIOLIB_SI443X_VALID_PACKET_RECEIVED_ENABLED | RADIOLIB_SI443X_CRC_ERROR_ENABLED);
+  uint8_t irqEnable = RADIOLIB_SI443X_VALID_PACKET_RECEIVED_ENABLED | RADIOLIB_SI443X_CRC_ERROR_ENABLED;
+  if(_streamRx) {
+    irqEnable |= RADIOLIB_SI443X_RX_FIFO_ALMOST_FULL_ENABLED;
+  }
+  _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_INTERRUPT_ENABLE_1, irqEnable);
   _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_INTERRUPT_ENABLE_2, 0x00);
 
   // set mode to receive
@@ -319,164 +426,66 @@ int16_t Si443x::readData(uint8_t* data, size_t len) {
 }
 
 int16_t Si443x::setBitRate(float br) {
-  RADIOLIB_CHECK_RANGE(br, 0.123, 256.0, RADIOLIB_ERR_INVALID_BIT_RATE);
-
-  // check high data rate
-  uint8_t dataRateMode = RADIOLIB_SI443X_LOW_DATA_RATE_MODE;
-  uint8_t exp = 21;
-  if(br >= 30.0) {
-    // bit rate above 30 kbps
-    dataRateMode = RADIOLIB_SI443X_HIGH_DATA_RATE_MODE;
-    exp = 16;
-  }
-
-  // calculate raw data rate value
-  uint16_t txDr = (br * ((uint32_t)1 << exp)) / 1000.0;
-
-  // update registers
-  int16_t state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_MODULATION_MODE_CONTROL_1, dataRateMode, 5, 5);
-  _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_TX_DATA_RATE_1, (uint8_t)((txDr & 0xFF00) >> 8));
-  _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_TX_DATA_RATE_0, (uint8_t)(txDr & 0xFF));
-
-  if(state == RADIOLIB_ERR_NONE) {
-    _br = br;
-  }
+  Si443xModemConfig_t cfg;
+  readModemConfig(&cfg);
+  int16_t state = modemBitRate(&cfg, br);
   RADIOLIB_ASSERT(state);
 
   // update clock recovery
-  state = updateClockRecovery();
-
-  return(state);
+  modemClockRecovery(&cfg);
+  return(setModemConfig(&cfg));
 }
 
 int16_t Si443x::setFrequencyDeviation(float freqDev) {
-  // set frequency deviation to lowest available setting (required for digimodes)
-  float newFreqDev = freqDev;
-  if(freqDev < 0.0) {
-    newFreqDev = 0.625;
-  }
+  Si443xModemConfig_t cfg;
+  readModemConfig(&cfg);
+  int16_t state = modemFrequencyDeviation(&cfg, freqDev);
+  RADIOLIB_ASSERT(state);
 
-  RADIOLIB_CHECK_RANGE(newFreqDev, 0.625, 320.0, RADIOLIB_ERR_INVALID_FREQUENCY_DEVIATION);
+  // update clock recovery, loop gain depends on frequency deviation
+  modemClockRecovery(&cfg);
+  return(setModemConfig(&cfg));
+}
 
-  // calculate raw frequency deviation value
-  uint16_t fdev = (uint16_t)(newFreqDev / 0.625);
+int16_t Si443x::setRxBandwidth(float rxBw) {
+  Si443xModemConfig_t cfg;
+  readModemConfig(&cfg);
+  int16_t state = modemRxBandwidth(&cfg, rxBw);
+  RADIOLIB_ASSERT(state);
 
-  // update registers
-  int16_t state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_MODULATION_MODE_CONTROL_2, (uint8_t)((fdev & 0x0100) >> 6), 2, 2);
-  _mod->SPIwriteRegister(RADIOLIB_SI443X_REG_FREQUENCY_DEVIATION, (uint8_t)(fdev & 0xFF));
+  // update clock recovery
+  modemClockRecovery(&cfg);
+  return(setModemConfig(&cfg));
+}
 
-  if(state == RADIOLIB_ERR_NONE) {
-    _freqDev = newFreqDev;
+int16_t Si443x::getModemConfig(Si443xModemConfig_t* cfg, float br, float freqDev, float rxBw) {
+  if(cfg == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
   }
 
+  // start from the current configuration, so that only the calculated fields change
+  readModemConfig(cfg);
+  int16_t state = modemBitRate(cfg, br);
+  RADIOLIB_ASSERT(state);
+  state = modemFrequencyDeviation(cfg, freqDev);
+  RADIOLIB_ASSERT(state);
+  state = modemRxBandwidth(cfg, rxBw);
+  RADIOLIB_ASSERT(state);
+  modemClockRecovery(cfg);
   return(state);
 }
 
-int16_t Si443x::setRxBandwidth(float rxBw) {
-  RADIOLIB_CHECK_RANGE(rxBw, 2.6, 620.7, RADIOLIB_ERR_INVALID_RX_BANDWIDTH);
-
-  // decide which approximation to use for decimation rate and filter tap calculation
-  uint8_t bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_OFF;
-  uint8_t decRate = RADIOLIB_SI443X_IF_FILTER_DEC_RATE;
-  uint8_t filterSet = RADIOLIB_SI443X_IF_FILTER_COEFF_SET;
-
-  // this is the "well-behaved" section - can be linearly approximated
-  if((rxBw >= 2.6) && (rxBw <= 4.5)) {
-    decRate = 5;
-    filterSet = ((rxBw - 2.1429)/0.3250 + 0.5);
-  } else if((rxBw > 4.5) && (rxBw <= 8.8)) {
-    decRate = 4;
-    filterSet = ((rxBw - 3.9857)/0.6643 + 0.5);
-  } else if((rxBw > 8.8) && (rxBw <= 17.5)) {
-    decRate = 3;
-    filterSet = ((rxBw - 7.6714)/1.3536 + 0.5);
-  } else if((rxBw > 17.5) && (rxBw <= 34.7)) {
-    decRate = 2;
-    filterSet = ((rxBw - 15.2000)/2.6893 + 0.5);
-  } else if((rxBw > 34.7) && (rxBw <= 69.2)) {
-    decRate = 1;
-    filterSet = ((rxBw - 30.2430)/5.3679 + 0.5);
-  } else if((rxBw > 69.2) && (rxBw <= 137.9)) {
-    decRate = 0;
-    filterSet = ((rxBw - 60.286)/10.7000 + 0.5);
-
-  // this is the "Lord help thee who tread 'ere" section - no way to approximate this mess
-  /// \todo float tolerance equality as macro?
-  } else if(fabs(rxBw - 142.8) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 1;
-    filterSet = 4;
-  } else if(fabs(rxBw - 167.8) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 1;
-    filterSet = 5;
-  } else if(fabs(rxBw - 181.1) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 1;
-    filterSet = 6;
-  } else if(fabs(rxBw - 191.5) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 15;
-  } else if(fabs(rxBw - 225.1) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 1;
-  } else if(fabs(rxBw - 248.8) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 2;
-  } else if(fabs(rxBw - 269.3) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 3;
-  } else if(fabs(rxBw - 284.8) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 4;
-  } else if(fabs(rxBw -335.5) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 8;
-  } else if(fabs(rxBw - 391.8) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 9;
-  } else if(fabs(rxBw - 420.2) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 10;
-  } else if(fabs(rxBw - 468.4) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 11;
-  } else if(fabs(rxBw - 518.8) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 12;
-  } else if(fabs(rxBw - 577.0) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 13;
-  } else if(fabs(rxBw - 620.7) <= 0.001) {
-    bypass = RADIOLIB_SI443X_BYPASS_DEC_BY_3_ON;
-    decRate = 0;
-    filterSet = 14;
-  } else {
-    return(RADIOLIB_ERR_INVALID_RX_BANDWIDTH);
+int16_t Si443x::setModemConfig(Si443xModemConfig_t* cfg) {
+  if(cfg == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
   }
 
-  // shift decimation rate bits
-  decRate <<= 4;
-
-  // update register
-  int16_t state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_IF_FILTER_BANDWIDTH, bypass | decRate | filterSet);
-  RADIOLIB_ASSERT(state);
-
-  // update clock recovery
-  state = updateClockRecovery();
-
-  return(state);
+  // both register blocks are contiguous, address is auto-incremented in burst mode
+  _mod->SPIwriteRegisterBurst(RADIOLIB_SI443X_REG_IF_FILTER_BANDWIDTH, cfg->rx, RADIOLIB_SI443X_MODEM_RX_REGS);
+  _mod->SPIwriteRegisterBurst(RADIOLIB_SI443X_REG_TX_DATA_RATE_1, cfg->tx, RADIOLIB_SI443X_MODEM_TX_REGS);
+  _br = cfg->br;
+  _freqDev = cfg->freqDev;
+  return(RADIOLIB_ERR_NONE);
 }
 
 int16_t Si443x::setSyncWord(uint8_t* syncWord, size_t len) {
@@ -723,14 +732,74 @@ int16_t Si443x::config() {
   state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_HEADER_CONTROL_1, RADIOLIB_SI443X_BROADCAST_ADDR_CHECK_NONE | RADIOLIB_SI443X_RECEIVED_HEADER_CHECK_NONE);
   RADIOLIB_ASSERT(state);
 
+  // set FIFO thresholds for streaming packets longer than FIFO
+  state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_TX_FIFO_CONTROL_2, RADIOLIB_SI443X_FIFO_THRESH, 5, 0);
+  RADIOLIB_ASSERT(state);
+  state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_RX_FIFO_CONTROL, RADIOLIB_SI443X_FIFO_THRESH, 5, 0);
+  RADIOLIB_ASSERT(state);
+
   return(state);
 }
 
-int16_t Si443x::updateClockRecovery() {
+void Si443x::readModemConfig(Si443xModemConfig_t* cfg) {
+  _mod->SPIreadRegisterBurst(RADIOLIB_SI443X_REG_IF_FILTER_BANDWIDTH, RADIOLIB_SI443X_MODEM_RX_REGS, cfg->rx);
+  _mod->SPIreadRegisterBurst(RADIOLIB_SI443X_REG_TX_DATA_RATE_1, RADIOLIB_SI443X_MODEM_TX_REGS, cfg->tx);
+  cfg->br = _br;
+  cfg->freqDev = _freqDev;
+}
+
+int16_t Si443x::modemBitRate(Si443xModemConfig_t* cfg, float br) {
+  RADIOLIB_CHECK_RANGE(br, 0.123, 256.0, RADIOLIB_ERR_INVALID_BIT_RATE);
+
+  // check high data rate
+  uint8_t dataRateMode = RADIOLIB_SI443X_LOW_DATA_RATE_MODE;
+  uint8_t exp = 21;
+  if(br >= 30.0) {
+    // bit rate above 30 kbps
+    dataRateMode = RADIOLIB_SI443X_HIGH_DATA_RATE_MODE;
+    exp = 16;
+  }
+
+  // calculate raw data rate value
+  uint16_t txDr = (br * ((uint32_t)1 << exp)) / 1000.0;
+
+  // data rate (0x6E, 0x6F) and data rate mode in modulation mode control 1 (0x70)
+  cfg->tx[0] = (uint8_t)((txDr & 0xFF00) >> 8);
+  cfg->tx[1] = (uint8_t)(txDr & 0xFF);
+  cfg->tx[2] = (cfg->tx[2] & ~RADIOLIB_SI443X_LOW_DATA_RATE_MODE) | dataRateMode;
+  cfg->br = br;
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t Si443x::modemFrequencyDeviation(Si443xModemConfig_t* cfg, float freqDev) {
+  // set frequency deviation to lowest available setting (required for digimodes)
+  float newFreqDev = freqDev;
+  if(freqDev < 0.0) {
+    newFreqDev = 0.625;
+  }
+
+  RADIOLIB_CHECK_RANGE(newFreqDev, 0.625, 320.0, RADIOLIB_ERR_INVALID_FREQUENCY_DEVIATION);
+
+  // calculate raw frequency deviation value
+  uint16_t fdev = (uint16_t)(newFreqDev / 0.625);
+
+  // deviation MSB in modulation mode control 2 (0x71) and LSB (0x72)
+  cfg->tx[3] = (cfg->tx[3] & 0xFB) | (uint8_t)((fdev & 0x0100) >> 6);
+  cfg->tx[4] = (uint8_t)(fdev & 0xFF);
+  cfg->freqDev = newFreqDev;
+  return(RADIOLIB_ERR_NONE);
+}
+
+void Si443x::modemClockRecovery(Si443xModemConfig_t* cfg) {
+  // loop gain is undefined until both bit rate and frequency deviation are known
+  if((cfg->br == 0) || (cfg->freqDev == 0)) {
+    return;
+  }
+
   // get the parameters
-  uint8_t bypass = _mod->SPIgetRegValue(RADIOLIB_SI443X_REG_IF_FILTER_BANDWIDTH, 7, 7) >> 7;
-  uint8_t decRate = _mod->SPIgetRegValue(RADIOLIB_SI443X_REG_IF_FILTER_BANDWIDTH, 6, 4) >> 4;
-  uint8_t manch = _mod->SPIgetRegValue(RADIOLIB_SI443X_REG_MODULATION_MODE_CONTROL_1, 1, 1) >> 1;
+  uint8_t bypass = (cfg->rx[0] & 0x80) >> 7;
+  uint8_t decRate = (cfg->rx[0] & 0x70) >> 4;
+  uint8_t manch = (cfg->tx[2] & 0x02) >> 1;
 
   // calculate oversampling ratio, NCO offset and clock recovery gain
   int8_t ndecExp = (int8_t)decRate - 3;
@@ -741,9 +810,9 @@ int16_t Si443x::updateClockRecovery() {
     ndecExp *= -1;
     ndec = 1.0/(float)((uint16_t)1 << ndecExp);
   }
-  float rxOsr = ((float)(500 * (1 + 2*bypass))) / (ndec * _br * ((float)(1 + manch)));
-  uint32_t ncoOff = (_br * (1 + manch) * ((uint32_t)(1) << (20 + decRate))) / (500 * (1 + 2*bypass));
-  uint16_t crGain = 2 + (((float)(65536.0 * (1 + manch)) * _br) / (rxOsr * (_freqDev / 0.625)));
+  float rxOsr = ((float)(500 * (1 + 2*bypass))) / (ndec * cfg->br * ((float)(1 + manch)));
+  uint32_t ncoOff = (cfg->br * (1 + manch) * ((uint32_t)(1) << (20 + decRate))) / (500 * (1 + 2*bypass));
+  uint16_t crGain = 2 + (((float)(65536.0 * (1 + manch)) * cfg->br) / (rxOsr * (cfg->freqDev / 0.625)));
   uint16_t rxOsr_fixed = (uint16_t)rxOsr;
 
   // print that whole mess
@@ -762,27 +831,13 @@ int16_t Si443x::updateClockRecovery() {
   RADIOLIB_DEBUG_PRINT('\t');
   RADIOLIB_DEBUG_PRINTLN(crGain, HEX);
 
-  // update oversampling ratio
-  int16_t state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_CLOCK_REC_OFFSET_2, (uint8_t)((rxOsr_fixed & 0x0700) >> 3), 7, 5);
-  RADIOLIB_ASSERT(state);
-  state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_CLOCK_REC_OVERSAMP_RATIO, (uint8_t)(rxOsr_fixed & 0x00FF));
-  RADIOLIB_ASSERT(state);
-
-  // update NCO offset
-  state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_CLOCK_REC_OFFSET_2, (uint8_t)((ncoOff & 0x0F0000) >> 16), 3, 0);
-  RADIOLIB_ASSERT(state);
-  state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_CLOCK_REC_OFFSET_1, (uint8_t)((ncoOff & 0x00FF00) >> 8));
-  RADIOLIB_ASSERT(state);
-  state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_CLOCK_REC_OFFSET_0, (uint8_t)(ncoOff & 0x0000FF));
-  RADIOLIB_ASSERT(state);
-
-  // update clock recovery loop gain
-  state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_CLOCK_REC_TIMING_LOOP_GAIN_1, (uint8_t)((crGain & 0x0700) >> 8), 2, 0);
-  RADIOLIB_ASSERT(state);
-  state = _mod->SPIsetRegValue(RADIOLIB_SI443X_REG_CLOCK_REC_TIMING_LOOP_GAIN_0, (uint8_t)(crGain & 0x00FF));
-  RADIOLIB_ASSERT(state);
-
-  return(state);
+  // oversampling ratio (0x20, 0x21 bits 7 - 5), NCO offset (0x21 bits 3 - 0, 0x22, 0x23) and loop gain (0x24 bits 2 - 0, 0x25)
+  cfg->rx[4] = (uint8_t)(rxOsr_fixed & 0x00FF);
+  cfg->rx[5] = (cfg->rx[5] & 0x10) | (uint8_t)((rxOsr_fixed & 0x0700) >> 3) | (uint8_t)((ncoOff & 0x0F0000) >> 16);
+  cfg->rx[6] = (uint8_t)((ncoOff & 0x00FF00) >> 8);
+  cfg->rx[7] = (uint8_t)(ncoOff & 0x0000FF);
+  cfg->rx[8] = (cfg->rx[8] & 0xF8) | (uint8_t)((crGain & 0x0700) >> 8);
+  cfg->rx[9] = (uint8_t)(crGain & 0x00FF);
 }
 
 int16_t Si443x::directMode() {
@@ -12,6 +12,8 @@
 // Si443x physical layer properties
 #define RADIOLIB_SI443X_FREQUENCY_STEP_SIZE                    156.25
 #define RADIOLIB_SI443X_MAX_PACKET_LENGTH                      64
+#define RADIOLIB_SI443X_MAX_STREAM_LENGTH                      255
+#define RADIOLIB_SI443X_FIFO_THRESH                            32
 
 // Si443x series common registers
 #define RADIOLIB_SI443X_REG_DEVICE_TYPE                        0x00
@@ -545,6 +547,37 @@
 // RADIOLIB_SI443X_REG_RX_FIFO_CONTROL
 #define RADIOLIB_SI443X_RX_FIFO_ALMOST_FULL_THRESHOLD          0x37        //  5     0    Rx FIFO almost full threshold
 
+// modem register image, IF filter bandwidth to clock recovery loop gain (0x1C - 0x25) and data rate to frequency deviation (0x6E - 0x72)
+#define RADIOLIB_SI443X_MODEM_RX_REGS                          10
+#define RADIOLIB_SI443X_MODEM_TX_REGS                          5
+
+/*!
+  \struct Si443xModemConfig_t
+
+  \brief Precomputed modem register image, applied by Si443x::setModemConfig without any further calculation.
+*/
+struct Si443xModemConfig_t {
+  /*!
+    \brief IF filter bandwidth, AFC and clock recovery registers (0x1C - 0x25).
+  */
+  uint8_t rx[RADIOLIB_SI443X_MODEM_RX_REGS];
+
+  /*!
+    \brief Data rate, modulation mode control and frequency deviation registers (0x6E - 0x72).
+  */
+  uint8_t tx[RADIOLIB_SI443X_MODEM_TX_REGS];
+
+  /*!
+    \brief Bit rate in kbps.
+  */
+  float br;
+
+  /*!
+    \brief Frequency deviation in kHz.
+  */
+  float freqDev;
+};
+
 /*!
   \class Si443x
 
@@ -593,7 +626,8 @@ class Si443x: public PhysicalLayer {
     void reset();
 
     /*!
-      \brief Binary transmit method. Will transmit arbitrary binary data up to 64 bytes long.
+      \brief Binary transmit method. Will transmit arbitrary binary data up to 64 bytes long,
+      or up to 255 bytes long in variable packet length mode, refilling FIFO as it empties.
       For overloads to transmit Arduino String or C-string, see PhysicalLayer::transmit.
 
       \param data Binary data that will be transmitted.
@@ -670,8 +704,63 @@ class Si443x: public PhysicalLayer {
     */
     void clearIrqAction();
 
+    /*!
+      \brief Set interrupt service routine function to call when Tx FIFO is almost empty during streamed transmission.
+
+      \param func Pointer to interrupt service routine.
+    */
+    void setFifoEmptyAction(void (*func)(void));
+
+    /*!
+      \brief Clears interrupt service routine to call when Tx FIFO is almost empty.
+    */
+    void clearFifoEmptyAction();
+
+    /*!
+      \brief Set interrupt service routine function to call when Rx FIFO is almost full.
+      Also enables Rx FIFO almost full interrupt in startReceive, so that packets longer than FIFO can be received.
+
+      \param func Pointer to interrupt service routine.
+    */
+    void setFifoFullAction(void (*func)(void));
+
+    /*!
+      \brief Clears interrupt service routine to call when Rx FIFO is almost full, and disables Rx FIFO almost full interrupt.
+    */
+    void clearFifoFullAction();
+
+    /*!
+      \brief Refills Tx FIFO during streamed transmission, should be called after Tx FIFO almost empty interrupt.
+      The first 64 bytes are written by startTransmit.
+
+      \param data Pointer to the transmission buffer.
+
+      \param totalLen Total number of bytes to transmit.
+
+      \param remLen Pointer to a counter holding the number of bytes that have not been written to FIFO yet.
+      Has to be set to totalLen before the transmission starts.
+
+      \returns True when a complete packet is sent, false if more data is needed.
+    */
+    bool fifoAdd(uint8_t* data, int totalLen, int* remLen);
+
+    /*!
+      \brief Reads Rx FIFO during streamed reception, should be called after Rx FIFO almost full or packet received interrupt.
+      Packets with CRC error are dropped, the counter is reset and reception continues.
+
+      \param data Pointer to a buffer that stores the receive data.
+
+      \param totalLen Size of the buffer. Bytes that do not fit are discarded.
+
+      \param rcvLen Pointer to a counter holding the number of bytes that have been received so far.
+
+      \returns True when a complete packet is received, false if more data is needed.
+    */
+    bool fifoGet(volatile uint8_t* data, int totalLen, volatile int* rcvLen);
+
     /*!
       \brief Interrupt-driven binary transmit method. Will start transmitting arbitrary binary data up to 64 bytes long.
+      Packets up to 255 bytes long can be sent in variable packet length mode, the rest has to be added by fifoAdd.
 
       \param data Binary data that will be transmitted.
 
@@ -738,6 +827,32 @@ class Si443x: public PhysicalLayer {
     */
     int16_t setRxBandwidth(float rxBw);
 
+    /*!
+      \brief Calculates complete modem register image for the given bit rate, frequency deviation and receiver bandwidth.
+      Nothing is written to the module, so this can be done once (e.g. in setup) for every configuration that will be needed.
+      Settings that are not covered by the arguments (AFC, modulation, Manchester coding etc.) are taken from the current configuration.
+
+      \param cfg Pointer to structure to save the register image.
+
+      \param br Bit rate in kbps. Allowed values range from 0.123 to 256.0 kbps.
+
+      \param freqDev Frequency deviation in kHz. Allowed values range from 0.625 to 320.0 kHz.
+
+      \param rxBw Receiver bandwidth in kHz. Allowed values range from 2.6 to 620.7 kHz.
+
+      \returns \ref status_codes
+    */
+    int16_t getModemConfig(Si443xModemConfig_t* cfg, float br, float freqDev, float rxBw);
+
+    /*!
+      \brief Applies modem register image calculated by getModemConfig. Takes just two SPI burst writes.
+
+      \param cfg Pointer to the register image.
+
+      \returns \ref status_codes
+    */
+    int16_t setModemConfig(Si443xModemConfig_t* cfg);
+
     /*!
       \brief Sets sync word. Up to 4 bytes can be set as sync word.
 
@@ -859,6 +974,7 @@ class Si443x: public PhysicalLayer {
     size_t _packetLength = 0;
     bool _packetLengthQueried = false;
     uint8_t _packetLengthConfig = RADIOLIB_SI443X_FIXED_PACKET_LENGTH_ON;
+    bool _streamRx = false;
 
     int16_t setFrequencyRaw(float newFreq);
     int16_t setPacketMode(uint8_t mode, uint8_t len);
@@ -870,7 +986,11 @@ class Si443x: public PhysicalLayer {
     void clearIRQFlags();
     void clearFIFO(size_t count);
     int16_t config();
-    int16_t updateClockRecovery();
+    void readModemConfig(Si443xModemConfig_t* cfg);
+    int16_t modemBitRate(Si443xModemConfig_t* cfg, float br);
+    int16_t modemFrequencyDeviation(Si443xModemConfig_t* cfg, float freqDev);
+    int16_t modemRxBandwidth(Si443xModemConfig_t* cfg, float rxBw);
+    void modemClockRecovery(Si443xModemConfig_t* cfg);
     int16_t directMode();
 };
 
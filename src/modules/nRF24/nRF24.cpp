@@ -186,9 +186,9 @@ int16_t nRF24::startTransmit(uint8_t* data, size_t len, uint8_t addr) {
   memcpy(buff, data, len);
   SPIwriteTxPayload(data, len);
 
-  // CE high to start transmitting
+  // CE pulse to start transmitting
   _mod->digitalWrite(_mod->getRst(), HIGH);
-  _mod->delay(1);
+  _mod->delayMicroseconds(RADIOLIB_NRF24_CE_PULSE_LENGTH);
   _mod->digitalWrite(_mod->getRst(), LOW);
 
   return(state);
@@ -249,6 +249,249 @@ int16_t nRF24::readData(uint8_t* data, size_t len) {
   return(RADIOLIB_ERR_NONE);
 }
 
+#if !defined(RADIOLIB_EXCLUDE_NRF24_STREAM)
+int16_t nRF24::startStream() {
+  // set mode to standby
+  int16_t state = standby();
+  RADIOLIB_ASSERT(state);
+
+  // enable primary Tx mode
+  state = _mod->SPIsetRegValue(RADIOLIB_NRF24_REG_CONFIG, RADIOLIB_NRF24_PTX, 0, 0);
+  RADIOLIB_ASSERT(state);
+
+  // enable payloads without ACK
+  state = _mod->SPIsetRegValue(RADIOLIB_NRF24_REG_FEATURE, RADIOLIB_NRF24_DYN_ACK_ON, 0, 0);
+  RADIOLIB_ASSERT(state);
+
+  // enable Tx_DataSent and MaxRetransmits interrupts
+  clearIRQ();
+  state = _mod->SPIsetRegValue(RADIOLIB_NRF24_REG_CONFIG, RADIOLIB_NRF24_MASK_TX_DS_IRQ_ON | RADIOLIB_NRF24_MASK_MAX_RT_IRQ_ON, 5, 4);
+  RADIOLIB_ASSERT(state);
+
+  // flush Tx FIFO
+  SPItransfer(RADIOLIB_NRF24_CMD_FLUSH_TX);
+
+  // reset streaming state
+  _txHead = 0;
+  _txCount = 0;
+  _txNextId = 0;
+  _txResultHead = 0;
+  _txResultCount = 0;
+  _txResultsDropped = 0;
+  _streaming = true;
+
+  // keep CE high, packets are sent as soon as they are written to FIFO
+  _mod->digitalWrite(_mod->getRst(), HIGH);
+
+  return(state);
+}
+
+int16_t nRF24::streamWrite(uint8_t* data, size_t len, bool noAck) {
+  if(!_streaming) {
+    return(RADIOLIB_ERR_STREAM_NOT_ACTIVE);
+  }
+
+  // check packet length
+  if(len > RADIOLIB_NRF24_MAX_PACKET_LENGTH) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // try to free up some space first
+  if(_txCount >= RADIOLIB_NRF24_TX_FIFO_DEPTH) {
+    int16_t state = streamUpdate();
+    RADIOLIB_ASSERT(state);
+    if(_txCount >= RADIOLIB_NRF24_TX_FIFO_DEPTH) {
+      return(RADIOLIB_ERR_TX_FIFO_FULL);
+    }
+  }
+
+  // save a copy in case another packet in FIFO fails
+  uint8_t slot = (_txHead + _txCount) % RADIOLIB_NRF24_TX_FIFO_DEPTH;
+  memcpy(_txShadow[slot], data, len);
+  _txShadowLen[slot] = len;
+  _txShadowNoAck[slot] = noAck;
+  _txShadowId[slot] = _txNextId++;
+  _txCount++;
+
+  // write to FIFO
+  SPItransfer(noAck ? RADIOLIB_NRF24_CMD_WRITE_TX_PAYLOAD_NOACK : RADIOLIB_NRF24_CMD_WRITE_TX_PAYLOAD, true, data, NULL, len);
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t nRF24::streamUpdate() {
+  if(!_streaming) {
+    return(RADIOLIB_ERR_STREAM_NOT_ACTIVE);
+  }
+
+  uint8_t status = _mod->SPIreadRegister(RADIOLIB_NRF24_REG_STATUS);
+  if(!(status & (RADIOLIB_NRF24_TX_DS | RADIOLIB_NRF24_MAX_RT))) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // clear the flag before FIFO status is read, so that a packet sent in the meantime raises it again
+  if(status & RADIOLIB_NRF24_TX_DS) {
+    _mod->SPIwriteRegister(RADIOLIB_NRF24_REG_STATUS, RADIOLIB_NRF24_TX_DS);
+  }
+
+  // FIFO status only reports empty and full, so when it is partially filled, there may be 1 or 2 packets left
+  // only the packets that provably left the FIFO are reported, the rest is reported on one of the following calls
+  uint8_t fifo = _mod->SPIreadRegister(RADIOLIB_NRF24_REG_FIFO_STATUS);
+  uint8_t left = _txCount;
+  if(fifo & RADIOLIB_NRF24_TX_FIFO_EMPTY_FLAG) {
+    left = 0;
+  } else if(!(fifo & RADIOLIB_NRF24_TX_FIFO_FULL_FLAG) && (left >= RADIOLIB_NRF24_TX_FIFO_DEPTH)) {
+    left = RADIOLIB_NRF24_TX_FIFO_DEPTH - 1;
+  }
+
+  if((status & RADIOLIB_NRF24_MAX_RT) && (left == RADIOLIB_NRF24_TX_FIFO_DEPTH - 1)) {
+    // transmission is stalled until MAX_RT is cleared, so the exact number can be found by writing a dummy packet
+    // FIFO is flushed below, so the dummy is never sent
+    uint8_t dummy = 0;
+    SPItransfer(RADIOLIB_NRF24_CMD_WRITE_TX_PAYLOAD, true, &dummy, NULL, 1);
+    if(!(_mod->SPIreadRegister(RADIOLIB_NRF24_REG_FIFO_STATUS) & RADIOLIB_NRF24_TX_FIFO_FULL_FLAG)) {
+      left--;
+    }
+  }
+
+  // failed packet is still in FIFO, so it can not be counted as sent
+  if((status & RADIOLIB_NRF24_MAX_RT) && (left == 0)) {
+    left = 1;
+  }
+
+  // retransmit counter is reset when the next packet starts, so it only belongs to the failed packet,
+  // or to the last packet sent when FIFO is empty
+  uint8_t retransmits = _mod->SPIreadRegister(RADIOLIB_NRF24_REG_OBSERVE_TX) & 0x0F;
+  while(_txCount > left) {
+    bool last = (_txCount == 1) && !(status & RADIOLIB_NRF24_MAX_RT);
+    completeTx(RADIOLIB_ERR_NONE, last ? retransmits : RADIOLIB_NRF24_RETRANSMITS_UNKNOWN);
+  }
+
+  if(status & RADIOLIB_NRF24_MAX_RT) {
+    // report the packet at the head of FIFO as failed
+    completeTx(RADIOLIB_ERR_ACK_NOT_RECEIVED, retransmits);
+
+    // failed packet can not be removed on its own, so flush everything and upload the packets that were behind it again
+    SPItransfer(RADIOLIB_NRF24_CMD_FLUSH_TX);
+    for(uint8_t i = 0; i < _txCount; i++) {
+      uint8_t slot = (_txHead + i) % RADIOLIB_NRF24_TX_FIFO_DEPTH;
+      SPItransfer(_txShadowNoAck[slot] ? RADIOLIB_NRF24_CMD_WRITE_TX_PAYLOAD_NOACK : RADIOLIB_NRF24_CMD_WRITE_TX_PAYLOAD, true, _txShadow[slot], NULL, _txShadowLen[slot]);
+    }
+
+    // clearing the flag resumes transmission
+    _mod->SPIwriteRegister(RADIOLIB_NRF24_REG_STATUS, RADIOLIB_NRF24_MAX_RT);
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+uint8_t nRF24::getStreamFree() {
+  return(RADIOLIB_NRF24_TX_FIFO_DEPTH - _txCount);
+}
+
+int16_t nRF24::getTxResult(nRF24TxResult_t* result) {
+  if(result == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(_txResultCount == 0) {
+    return(RADIOLIB_ERR_QUEUE_EMPTY);
+  }
+
+  memcpy(result, &_txResults[_txResultHead], sizeof(nRF24TxResult_t));
+  _txResultHead = (_txResultHead + 1) % RADIOLIB_NRF24_TX_RESULT_QUEUE_SIZE;
+  _txResultCount--;
+  return(RADIOLIB_ERR_NONE);
+}
+
+uint16_t nRF24::getTxResultsDropped() {
+  return(_txResultsDropped);
+}
+
+int16_t nRF24::stopStream() {
+  _streaming = false;
+  _txCount = 0;
+
+  // CE low and discard anything that was not sent
+  _mod->digitalWrite(_mod->getRst(), LOW);
+  SPItransfer(RADIOLIB_NRF24_CMD_FLUSH_TX);
+  clearIRQ();
+  return(standby());
+}
+
+#endif
+
+int16_t nRF24::scanChannels(uint16_t* hits, uint16_t passes, uint8_t start, uint8_t num) {
+  int16_t state = startChannelScan(hits, start, num);
+  RADIOLIB_ASSERT(state);
+
+  // timing is known, so just wait the settling time instead of polling
+  for(uint16_t pass = 0; pass < passes; pass++) {
+    for(uint8_t i = 0; i < num; i++) {
+      scanTune(start + i);
+      _mod->delayMicroseconds(RADIOLIB_NRF24_RPD_SETTLE_TIME);
+      if(_mod->SPIreadRegister(RADIOLIB_NRF24_REG_RPD) & RADIOLIB_NRF24_RP_ABOVE_64_DBM) {
+        hits[i]++;
+      }
+    }
+  }
+
+  return(stopChannelScan());
+}
+
+int16_t nRF24::startChannelScan(uint16_t* hits, uint8_t start, uint8_t num) {
+  if(hits == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if((num == 0) || ((uint16_t)start + num > RADIOLIB_NRF24_NUM_CHANNELS)) {
+    return(RADIOLIB_ERR_INVALID_FREQUENCY);
+  }
+
+  // set mode to standby
+  int16_t state = standby();
+  RADIOLIB_ASSERT(state);
+
+  // received power detector only works in primary Rx mode
+  state = _mod->SPIsetRegValue(RADIOLIB_NRF24_REG_CONFIG, RADIOLIB_NRF24_PRX, 0, 0);
+  RADIOLIB_ASSERT(state);
+
+  memset(hits, 0x00, num * sizeof(uint16_t));
+  _scanHits = hits;
+  _scanStart = start;
+  _scanNum = num;
+  _scanIndex = 0;
+  _scanPasses = 0;
+  _scanning = true;
+
+  scanTune(start);
+  return(state);
+}
+
+uint16_t nRF24::updateChannelScan() {
+  if(!_scanning || (_mod->micros() - _scanTuned < RADIOLIB_NRF24_RPD_SETTLE_TIME)) {
+    return(_scanPasses);
+  }
+
+  if(_mod->SPIreadRegister(RADIOLIB_NRF24_REG_RPD) & RADIOLIB_NRF24_RP_ABOVE_64_DBM) {
+    _scanHits[_scanIndex]++;
+  }
+
+  _scanIndex++;
+  if(_scanIndex >= _scanNum) {
+    _scanIndex = 0;
+    _scanPasses++;
+  }
+  scanTune(_scanStart + _scanIndex);
+  return(_scanPasses);
+}
+
+int16_t nRF24::stopChannelScan() {
+  _scanning = false;
+
+  // restore the original channel
+  _mod->digitalWrite(_mod->getRst(), LOW);
+  _mod->SPIwriteRegister(RADIOLIB_NRF24_REG_RF_CH, (uint8_t)(_freq - 2400));
+  return(standby());
+}
+
 int16_t nRF24::setFrequency(float freq) {
   RADIOLIB_CHECK_RANGE((uint16_t)freq, 2400, 2525, RADIOLIB_ERR_INVALID_FREQUENCY);
 
@@ -519,6 +762,24 @@ int16_t nRF24::setAutoAck(uint8_t pipeNum, bool autoAckOn){
   }
 }
 
+int16_t nRF24::setAutoRetransmit(uint16_t delay, uint8_t count) {
+  if((delay < 250) || (delay > 4000) || (delay % 250 != 0) || (count > 15)) {
+    return(RADIOLIB_ERR_INVALID_AUTO_RETRANSMIT);
+  }
+
+  // delay is set in 250 us steps, starting at 250 us
+  uint8_t ard = (delay / 250) - 1;
+  return(_mod->SPIsetRegValue(RADIOLIB_NRF24_REG_SETUP_RETR, (ard << 4) | count));
+}
+
+uint8_t nRF24::getRetransmitCount() {
+  return(_mod->SPIgetRegValue(RADIOLIB_NRF24_REG_OBSERVE_TX, 3, 0));
+}
+
+uint8_t nRF24::getLostPacketCount() {
+  return(_mod->SPIgetRegValue(RADIOLIB_NRF24_REG_OBSERVE_TX, 7, 4) >> 4);
+}
+
 int16_t nRF24::setDataShaping(uint8_t sh) {
   // nRF24 is unable to set data shaping
   // this method is implemented only for PhysicalLayer compatibility
@@ -561,6 +822,37 @@ void nRF24::clearIRQ() {
   _mod->SPIsetRegValue(RADIOLIB_NRF24_REG_CONFIG, RADIOLIB_NRF24_MASK_RX_DR_IRQ_OFF | RADIOLIB_NRF24_MASK_TX_DS_IRQ_OFF | RADIOLIB_NRF24_MASK_MAX_RT_IRQ_OFF, 6, 4);
 }
 
+#if !defined(RADIOLIB_EXCLUDE_NRF24_STREAM)
+void nRF24::completeTx(int16_t state, uint8_t retransmits) {
+  if(_txCount == 0) {
+    return;
+  }
+
+  // move the packet at the head of FIFO to result queue
+  if(_txResultCount < RADIOLIB_NRF24_TX_RESULT_QUEUE_SIZE) {
+    nRF24TxResult_t* res = &_txResults[(_txResultHead + _txResultCount) % RADIOLIB_NRF24_TX_RESULT_QUEUE_SIZE];
+    res->id = _txShadowId[_txHead];
+    res->state = state;
+    res->noAck = _txShadowNoAck[_txHead];
+    res->retransmits = res->noAck ? 0 : retransmits;
+    _txResultCount++;
+  } else {
+    _txResultsDropped++;
+  }
+
+  _txHead = (_txHead + 1) % RADIOLIB_NRF24_TX_FIFO_DEPTH;
+  _txCount--;
+}
+#endif
+
+void nRF24::scanTune(uint8_t channel) {
+  // PLL has to relock, so leave Rx mode while the channel is written directly, bypassing setFrequency
+  _mod->digitalWrite(_mod->getRst(), LOW);
+  _mod->SPIwriteRegister(RADIOLIB_NRF24_REG_RF_CH, channel);
+  _mod->digitalWrite(_mod->getRst(), HIGH);
+  _scanTuned = _mod->micros();
+}
+
 int16_t nRF24::config() {
   // enable 16-bit CRC
   int16_t state = _mod->SPIsetRegValue(RADIOLIB_NRF24_REG_CONFIG, RADIOLIB_NRF24_CRC_ON | RADIOLIB_NRF24_CRC_16, 3, 2);
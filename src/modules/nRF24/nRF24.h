@@ -130,6 +130,7 @@
 #define RADIOLIB_NRF24_MAX_RT                                  0b00010000  //  4     4     maximum number of retransmits reached (must be cleared to continue)
 #define RADIOLIB_NRF24_RX_FIFO_EMPTY                           0b00001110  //  3     1     Rx FIFO is empty
 #define RADIOLIB_NRF24_RX_P_NO                                 0b00000000  //  3     1     number of data pipe that received data
+#define RADIOLIB_NRF24_RX_P_NO_MASK                            0b00001110  //  3     1     data pipe number mask
 #define RADIOLIB_NRF24_TX_FIFO_FULL                            0b00000001  //  0     0     Tx FIFO is full
 
 // NRF24_REG_OBSERVE_TX
@@ -171,6 +172,27 @@
 #define RADIOLIB_NRF24_DYN_ACK_OFF                             0b00000000  //  0     0     payloads without ACK: disabled (default)
 #define RADIOLIB_NRF24_DYN_ACK_ON                              0b00000001  //  0     0                           enabled
 
+// CE pulse length in us to start transmission of a single packet, minimum is 10 us
+#define RADIOLIB_NRF24_CE_PULSE_LENGTH                         15
+
+// time in us from CE high in receive mode until received power detector (RPD) is valid (Tstby2a + Tdelay_AGC)
+#define RADIOLIB_NRF24_RPD_SETTLE_TIME                         170
+
+// number of RF channels, 2400 MHz to 2525 MHz in 1 MHz steps
+#define RADIOLIB_NRF24_NUM_CHANNELS                            126
+
+// FIFO depths
+#define RADIOLIB_NRF24_TX_FIFO_DEPTH                           3
+#define RADIOLIB_NRF24_RX_FIFO_DEPTH                           3
+
+// number of transmit results buffered in streaming mode
+#if !defined(RADIOLIB_NRF24_TX_RESULT_QUEUE_SIZE)
+  #define RADIOLIB_NRF24_TX_RESULT_QUEUE_SIZE                  8
+#endif
+
+// retransmit count of packets sent in streaming mode that could not be attributed to a single packet
+#define RADIOLIB_NRF24_RETRANSMITS_UNKNOWN                     0xFF
+
 // Defaults
 #define RADIOLIB_NRF24_DEFAULT_FREQ                            2400
 #define RADIOLIB_NRF24_DEFAULT_DR                              1000
@@ -178,6 +200,36 @@
 #define RADIOLIB_NRF24_DEFAULT_ADDRWIDTH                       5
 
 
+#if !defined(RADIOLIB_EXCLUDE_NRF24_STREAM)
+/*!
+  \struct nRF24TxResult_t
+
+  \brief Outcome of a single packet sent in streaming mode.
+*/
+struct nRF24TxResult_t {
+  /*!
+    \brief Sequential number of the packet, counted from the start of streaming mode.
+  */
+  uint16_t id;
+
+  /*!
+    \brief Result of the transmission, either RADIOLIB_ERR_NONE or RADIOLIB_ERR_ACK_NOT_RECEIVED.
+  */
+  int16_t state;
+
+  /*!
+    \brief Number of retransmissions reported by the radio. Only known for failed packets and for the last packet
+    sent before TX FIFO emptied, RADIOLIB_NRF24_RETRANSMITS_UNKNOWN otherwise.
+  */
+  uint8_t retransmits;
+
+  /*!
+    \brief Whether the packet was sent without requesting ACK.
+  */
+  bool noAck;
+};
+#endif
+
 /*!
   \class nRF24
 
@@ -325,6 +377,116 @@ class nRF24: public PhysicalLayer {
     */
     int16_t readData(uint8_t* data, size_t len) override;
 
+    #if !defined(RADIOLIB_EXCLUDE_NRF24_STREAM)
+    // streaming methods
+
+    /*!
+      \brief Starts streaming transmission mode. CE is kept high, so every packet written to TX FIFO is sent immediately.
+      TX_DS and MAX_RT interrupts are reflected on IRQ pin, streamUpdate should be called when it activates.
+
+      \returns \ref status_codes
+    */
+    int16_t startStream();
+
+    /*!
+      \brief Queues a packet for transmission in streaming mode. Does not block, up to 3 packets can be waiting in TX FIFO.
+
+      \param data Binary data to be sent.
+
+      \param len Number of bytes to send, up to 32.
+
+      \param noAck Set to true to send the packet without requesting ACK (W_TX_PAYLOAD_NOACK).
+
+      \returns \ref status_codes, RADIOLIB_ERR_TX_FIFO_FULL when the packet has to be written again later.
+    */
+    int16_t streamWrite(uint8_t* data, size_t len, bool noAck = false);
+
+    /*!
+      \brief Processes streaming transmission. Completed packets are moved from TX FIFO to transmit result queue.
+      When maximum number of retransmits is reached, only the failed packet is dropped and the rest of the FIFO is sent.
+      Should be called every time IRQ activates. Since FIFO status only reports empty and full, packets that can not be proven to have left
+      the partially filled FIFO are reported on one of the following calls, at the latest when FIFO empties or the next packet fails.
+
+      \returns \ref status_codes
+    */
+    int16_t streamUpdate();
+
+    /*!
+      \brief Gets number of free slots in TX FIFO in streaming mode.
+
+      \returns Number of packets that can be written without blocking.
+    */
+    uint8_t getStreamFree();
+
+    /*!
+      \brief Gets the oldest transmit result in streaming mode. Results are reported in the same order packets were written.
+
+      \param result Pointer to structure to save the result.
+
+      \returns \ref status_codes, RADIOLIB_ERR_QUEUE_EMPTY if there is no result waiting.
+    */
+    int16_t getTxResult(nRF24TxResult_t* result);
+
+    /*!
+      \brief Gets number of transmit results that were dropped because the result queue was full.
+
+      \returns Number of dropped results.
+    */
+    uint16_t getTxResultsDropped();
+
+    /*!
+      \brief Stops streaming mode, discards packets that were not sent yet and sets the module to standby.
+
+      \returns \ref status_codes
+    */
+    int16_t stopStream();
+    #endif
+
+    /*!
+      \brief Blocking sweep of received power detector (RPD) across a range of channels.
+      Each channel is sampled once per pass, samples above -64 dBm are counted as hits.
+      Takes approximately 180 us per channel and pass. The radio is set to standby on the original channel afterwards.
+
+      \param hits Array to save the number of hits, one entry per channel. Must be at least num entries long.
+
+      \param passes Number of passes through the channel range.
+
+      \param start First channel to sample (0 - 125, channel frequency is 2400 MHz + channel).
+
+      \param num Number of channels to sample. Defaults to all 126 channels.
+
+      \returns \ref status_codes
+    */
+    int16_t scanChannels(uint16_t* hits, uint16_t passes, uint8_t start = 0, uint8_t num = RADIOLIB_NRF24_NUM_CHANNELS);
+
+    /*!
+      \brief Starts background sweep of received power detector across a range of channels.
+      Progress is driven by calling updateChannelScan, hits are accumulated until stopChannelScan is called.
+
+      \param hits Array to save the number of hits, one entry per channel. Must be at least num entries long, it is cleared here.
+
+      \param start First channel to sample (0 - 125, channel frequency is 2400 MHz + channel).
+
+      \param num Number of channels to sample. Defaults to all 126 channels.
+
+      \returns \ref status_codes
+    */
+    int16_t startChannelScan(uint16_t* hits, uint8_t start = 0, uint8_t num = RADIOLIB_NRF24_NUM_CHANNELS);
+
+    /*!
+      \brief Samples the current channel once its detector has settled and moves to the next one. Should be called as often as possible, e.g. from loop.
+
+      \returns Number of completed passes through the channel range.
+    */
+    uint16_t updateChannelScan();
+
+    /*!
+      \brief Stops background sweep and sets the radio to standby on the original channel. Collected hits are kept.
+
+      \returns \ref status_codes
+    */
+    int16_t stopChannelScan();
+
     // configuration methods
 
     /*!
@@ -466,6 +628,32 @@ class nRF24: public PhysicalLayer {
    */
     int16_t setAutoAck(uint8_t pipeNum, bool autoAckOn);
 
+    /*!
+      \brief Sets automatic retransmission delay and count.
+
+      \param delay Delay between retransmissions in us. Allowed values range from 250 us to 4000 us in 250 us steps.
+
+      \param count Maximum number of retransmissions. Allowed values range from 0 to 15, 0 disables automatic retransmission.
+
+      \returns \ref status_codes
+    */
+    int16_t setAutoRetransmit(uint16_t delay, uint8_t count);
+
+    /*!
+      \brief Gets number of retransmissions of the last transmitted packet (ARC_CNT).
+      When the packet was not acknowledged, this equals the maximum number of retransmissions.
+
+      \returns Number of retransmissions.
+    */
+    uint8_t getRetransmitCount();
+
+    /*!
+      \brief Gets number of packets lost since the last frequency change (PLOS_CNT). Saturates at 15.
+
+      \returns Number of lost packets.
+    */
+    uint8_t getLostPacketCount();
+
     /*!
       \brief Dummy data shaping configuration method, to ensure PhysicalLayer compatibility.
 
@@ -526,8 +714,45 @@ class nRF24: public PhysicalLayer {
     uint8_t _addrWidth = RADIOLIB_NRF24_DEFAULT_ADDRWIDTH;
 
 
+    #if !defined(RADIOLIB_EXCLUDE_NRF24_STREAM)
+    // streaming transmission - copy of TX FIFO contents, so that only the failed packet can be dropped
+    bool _streaming = false;
+    uint8_t _txShadow[RADIOLIB_NRF24_TX_FIFO_DEPTH][RADIOLIB_NRF24_MAX_PACKET_LENGTH];
+    uint8_t _txShadowLen[RADIOLIB_NRF24_TX_FIFO_DEPTH];
+    bool _txShadowNoAck[RADIOLIB_NRF24_TX_FIFO_DEPTH];
+    uint16_t _txShadowId[RADIOLIB_NRF24_TX_FIFO_DEPTH];
+    uint8_t _txHead = 0;
+    uint8_t _txCount = 0;
+    uint16_t _txNextId = 0;
+
+    // streaming transmission results
+    nRF24TxResult_t _txResults[RADIOLIB_NRF24_TX_RESULT_QUEUE_SIZE];
+    uint8_t _txResultHead = 0;
+    uint8_t _txResultCount = 0;
+    uint16_t _txResultsDropped = 0;
+    #endif
+
+    // channel scan
+    bool _scanning = false;
+    uint16_t* _scanHits = NULL;
+    uint8_t _scanStart = 0;
+    uint8_t _scanNum = 0;
+    uint8_t _scanIndex = 0;
+    uint16_t _scanPasses = 0;
+    uint32_t _scanTuned = 0;
+
     int16_t config();
     void clearIRQ();
+    #if !defined(RADIOLIB_EXCLUDE_NRF24_STREAM)
+    void completeTx(int16_t state, uint8_t retransmits);
+    #endif
+    void scanTune(uint8_t channel);
+
+    // allow multi-pipe receiver access to SPI commands
+    friend class MultiPipeClient;
+
+    // allow link quality controller access to address width
+    friend class LinkQualityClient;
 };
 
 #endif
@@ -1,6 +1,23 @@
 #include "AX25.h"
 #if !defined(RADIOLIB_EXCLUDE_AX25)
 
+#if !defined(RADIOLIB_EXCLUDE_DIRECT_RECEIVE)
+// global-scope ISR is needed to decode the bits as they arrive,
+// so only one AX.25 receiver can be running at the same time
+static AX25Client* _decodeBitInstance = NULL;
+static Module* _decodeBitMod = NULL;
+static RADIOLIB_PIN_TYPE _decodeBitPin = RADIOLIB_NC;
+
+#if defined(ESP8266) || defined(ESP32)
+  ICACHE_RAM_ATTR
+#endif
+static void AX25ClientDecodeBit(void) {
+  if(_decodeBitInstance) {
+    _decodeBitInstance->decodeBit((uint8_t)_decodeBitMod->digitalRead(_decodeBitPin));
+  }
+}
+#endif
+
 AX25Frame::AX25Frame(const char* destCallsign, uint8_t destSSID, const char* srcCallsign, uint8_t srcSSID, uint8_t control)
 : AX25Frame(destCallsign, destSSID, srcCallsign, srcSSID, control, 0, NULL, 0) {
 
@@ -174,6 +191,20 @@ int16_t AX25Client::setCorrection(int16_t mark, int16_t space, float length) {
 }
 #endif
 
+AX25Client::~AX25Client() {
+  #if !defined(RADIOLIB_EXCLUDE_DIRECT_RECEIVE)
+    if(_decodeBitInstance == this) {
+      _decodeBitInstance = NULL;
+    }
+    #if !defined(RADIOLIB_STATIC_ONLY)
+      delete[] _rxPool;
+    #endif
+  #endif
+  #if !defined(RADIOLIB_EXCLUDE_AX25_LINK) && !defined(RADIOLIB_STATIC_ONLY)
+    delete[] _linkPool;
+  #endif
+}
+
 int16_t AX25Client::begin(const char* srcCallsign, uint8_t srcSSID, uint8_t preambleLen) {
   // set source SSID
   _srcSSID = srcSSID;
@@ -227,49 +258,1014 @@ int16_t AX25Client::sendFrame(AX25Frame* frame) {
       }
     }
   #endif
+  if(frame->numRepeaters > 8) {
+    return(RADIOLIB_ERR_INVALID_NUM_REPEATERS);
+  }
+
+  // address, control and PID fields, info field is read directly from the frame
+  uint8_t header[RADIOLIB_AX25_MAX_HEADER_LEN];
+  size_t headerLen = buildHeader(frame, header);
+
+  return(transmitEncoded(header, headerLen, frame->info, frame->infoLen));
+}
+
+int16_t AX25Client::transmitEncoded(uint8_t* header, size_t headerLen, uint8_t* info, size_t infoLen) {
+  bool hdlc = true;
+  #if !defined(RADIOLIB_EXCLUDE_AFSK)
+  hdlc = (_audio == nullptr);
+  #endif
+  int16_t state = RADIOLIB_ERR_NONE;
+  if(hdlc && _phyHdlc) {
+    // modules with HDLC framing engine do stuffing, FCS and NRZI themselves, so nothing is encoded here
+    // frame without info field is sent straight from the header, otherwise both have to be joined
+    uint8_t* frameBuff = header;
+    size_t frameBuffLen = headerLen + infoLen;
+    #if !defined(RADIOLIB_STATIC_ONLY)
+      if(infoLen > 0) {
+        frameBuff = new uint8_t[frameBuffLen];
+      }
+    #else
+      if(frameBuffLen > RADIOLIB_STATIC_ARRAY_SIZE) {
+        return(RADIOLIB_ERR_PACKET_TOO_LONG);
+      }
+      uint8_t frameBuffStatic[RADIOLIB_STATIC_ARRAY_SIZE];
+      if(infoLen > 0) {
+        frameBuff = frameBuffStatic;
+      }
+    #endif
+    if(infoLen > 0) {
+      memcpy(frameBuff, header, headerLen);
+      memcpy(frameBuff + headerLen, info, infoLen);
+    }
+    state = _phy->transmitHdlc(frameBuff, frameBuffLen, _preambleLen);
+    #if !defined(RADIOLIB_STATIC_ONLY)
+      if(infoLen > 0) {
+        delete[] frameBuff;
+      }
+    #endif
+    if(state != RADIOLIB_ERR_UNSUPPORTED) {
+      return(state);
+    }
+
+    // the module can not change, so there is no point in asking again
+    _phyHdlc = false;
+  }
+
+  // total length of the encoded frame is needed in advance
+  size_t stuffedFrameBuffLen = encodeStart(header, headerLen, info, infoLen);
+
+  if(hdlc) {
+    // modules with FIFO refill support get the frame encoded in small chunks while it is being transmitted
+    state = _phy->transmitStream(stuffedFrameBuffLen, AX25Client::encodeStream, this);
+    if(state != RADIOLIB_ERR_UNSUPPORTED) {
+      return(state);
+    }
+  }
+
+  #if !defined(RADIOLIB_EXCLUDE_AFSK)
+  if(_audio != nullptr) {
+    // audio is generated bit by bit, so the frame is encoded one byte at a time
+    Module* mod = _phy->getMod();
+    _phy->transmitDirect();
+    uint8_t b = 0;
+    encodeChunk(&b, 1);
+    for(size_t i = 0; i < stuffedFrameBuffLen; i++) {
+
+      // check each bit
+      for(uint16_t mask = 0x80; mask >= 0x01; mask >>= 1) {
+        uint32_t start = mod->micros();
+        if(b & mask) {
+          _audio->tone(_afskMark, false);
+        } else {
+          _audio->tone(_afskSpace, false);
+        }
+
+        // encode the next byte while the last bit is being sent
+        if(mask == 0x01) {
+          encodeChunk(&b, 1);
+        }
+        mod->waitForMicroseconds(start, _afskLen);
+      }
+
+    }
+
+    _audio->noTone();
+    return(state);
+  }
+  #endif
+
+  // otherwise, encode the whole frame into a buffer
+  #if !defined(RADIOLIB_STATIC_ONLY)
+    uint8_t* stuffedFrameBuff = new uint8_t[stuffedFrameBuffLen];
+  #else
+    if(stuffedFrameBuffLen > RADIOLIB_STATIC_ARRAY_SIZE) {
+      return(RADIOLIB_ERR_PACKET_TOO_LONG);
+    }
+    uint8_t stuffedFrameBuff[RADIOLIB_STATIC_ARRAY_SIZE];
+  #endif
+  encodeChunk(stuffedFrameBuff, stuffedFrameBuffLen);
+
+  // transmit
+  state = _phy->transmit(stuffedFrameBuff, stuffedFrameBuffLen);
+
+  // deallocate memory
+  #if !defined(RADIOLIB_STATIC_ONLY)
+    delete[] stuffedFrameBuff;
+  #endif
+
+  return(state);
+}
+
+#if !defined(RADIOLIB_EXCLUDE_DIRECT_RECEIVE)
+int16_t AX25Client::startReceive(RADIOLIB_PIN_TYPE pin, bool scrambled) {
+  // allocate the frame pool only once, so that nothing is allocated while receiving
+  #if !defined(RADIOLIB_STATIC_ONLY)
+    if(_rxPool == NULL) {
+      _rxPool = new uint8_t[RADIOLIB_AX25_RX_POOL_SIZE*RADIOLIB_AX25_RX_MAX_LENGTH];
+    }
+  #endif
+
+  // reset decoder, frames already in the pool are kept
+  _rxScrambled = scrambled;
+  _rxScrambler = 0;
+  _rxOnes = 0;
+  _rxHunting = true;
+
+  if(pin == RADIOLIB_NC) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // frames are delimited by flags, so the bits are decoded directly instead of using direct mode sync word and buffer
+  _decodeBitInstance = this;
+  _decodeBitMod = _phy->getMod();
+  _decodeBitPin = pin;
+  _decodeBitMod->pinMode(pin, INPUT);
+  _phy->setDirectAction(AX25ClientDecodeBit);
+  return(_phy->receiveDirect());
+}
+
+size_t AX25Client::available() {
+  size_t num = 0;
+  for(uint8_t i = 0; i < RADIOLIB_AX25_RX_POOL_SIZE; i++) {
+    if(_rxFull[i]) {
+      num++;
+    }
+  }
+  return(num);
+}
+
+int16_t AX25Client::readFrame(AX25Frame* frame) {
+  if(!_rxFull[_rxTail]) {
+    return(RADIOLIB_ERR_QUEUE_EMPTY);
+  }
+
+  // parse the frame and release the slot
+  int16_t state = parseFrame(&_rxPool[_rxTail*RADIOLIB_AX25_RX_MAX_LENGTH], _rxFrameLen[_rxTail], frame);
+  _rxFull[_rxTail] = false;
+  _rxTail = (_rxTail + 1) % RADIOLIB_AX25_RX_POOL_SIZE;
+  return(state);
+}
+
+uint16_t AX25Client::getDropped() {
+  return(_rxDropped);
+}
+
+void AX25Client::decodeBit(uint8_t bit) {
+  bit = bit ? 1 : 0;
+
+  // G3RUH descrambler, polynomial x^17 + x^12 + 1
+  if(_rxScrambled) {
+    uint8_t in = bit;
+    bit ^= ((_rxScrambler >> 11) ^ (_rxScrambler >> 16)) & 0x01;
+    _rxScrambler = (_rxScrambler << 1) | in;
+  }
+
+  // NRZI decoding - no transition is 1, transition is 0
+  uint8_t level = bit;
+  bit = (level == _rxLevel) ? 1 : 0;
+  _rxLevel = level;
+
+  if(bit) {
+    // sixth 1 can only be part of a flag, seven or more abort the frame
+    if(_rxOnes < 7) {
+      _rxOnes++;
+    }
+    if(_rxOnes == 7) {
+      _rxHunting = true;
+      return;
+    } else if(_rxOnes == 6) {
+      return;
+    }
+
+  } else {
+    uint8_t ones = _rxOnes;
+    _rxOnes = 0;
+    if(ones == 6) {
+      decodeFlag();
+      return;
+    } else if(ones == 5) {
+      // stuffed 0
+      return;
+    }
+  }
+
+  if(_rxHunting) {
+    return;
+  }
+
+  // bytes are sent least significant bit first
+  _rxByte = (_rxByte >> 1) | (bit << 7);
+  _rxBits++;
+  if(_rxBits < 8) {
+    return;
+  }
+  _rxBits = 0;
+
+  // drop frames that would not fit into the pool
+  if(_rxLen >= RADIOLIB_AX25_RX_MAX_LENGTH) {
+    _rxHunting = true;
+    return;
+  }
+
+  if(_rxStore) {
+    _rxPool[_rxHead*RADIOLIB_AX25_RX_MAX_LENGTH + _rxLen] = _rxByte;
+  }
+  _rxCrc = updateFrameCheckSequence(_rxCrc, _rxByte);
+  _rxLen++;
+}
+
+void AX25Client::decodeByte(uint8_t b) {
+  for(uint8_t mask = 0x80; mask > 0x00; mask >>= 1) {
+    decodeBit(b & mask);
+  }
+}
 
-  // calculate frame length without FCS (destination address, source address, repeater addresses, control, PID, info)
-  size_t frameBuffLen = ((2 + frame->numRepeaters)*(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1)) + 1 + 1 + frame->infoLen;
-  // create frame buffer without preamble, start or stop flags
+void AX25Client::decodeFlag() {
+  // the flag's leading 0 and five 1s were already shifted in, so a byte-aligned frame has exactly 6 bits left over
+  if(!_rxHunting && (_rxBits == 6) && (_rxLen >= RADIOLIB_AX25_RX_MIN_LENGTH) && (_rxCrc == RADIOLIB_AX25_FCS_GOOD)) {
+    if(_rxStore) {
+      _rxFrameLen[_rxHead] = _rxLen - 2;
+      _rxFull[_rxHead] = true;
+      _rxHead = (_rxHead + 1) % RADIOLIB_AX25_RX_POOL_SIZE;
+    } else {
+      _rxDropped++;
+    }
+  }
+
+  // flag also starts the next frame, store it only if there is a free slot for the whole frame
+  _rxHunting = false;
   #if !defined(RADIOLIB_STATIC_ONLY)
-    uint8_t* frameBuff = new uint8_t[frameBuffLen + 2];
+    _rxStore = (_rxPool != NULL) && !_rxFull[_rxHead];
   #else
-    uint8_t frameBuff[RADIOLIB_STATIC_ARRAY_SIZE];
+    _rxStore = !_rxFull[_rxHead];
+  #endif
+  _rxBits = 0;
+  _rxLen = 0;
+  _rxCrc = CRC_CCITT_INIT;
+}
+#endif
+
+int16_t AX25Client::parseFrame(uint8_t* data, size_t len, AX25Frame* frame) {
+  if((data == NULL) || (frame == NULL)) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // find the end of address field, marked by HDLC extension bit
+  size_t addrLen = 0;
+  for(size_t i = RADIOLIB_AX25_MAX_CALLSIGN_LEN; i < len; i += RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1) {
+    if(data[i] & RADIOLIB_AX25_SSID_HDLC_EXTENSION_END) {
+      addrLen = i + 1;
+      break;
+    }
+  }
+  uint8_t numRepeaters = addrLen/(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1) - 2;
+  if((addrLen < 2*(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1)) || (numRepeaters > 8) || (addrLen >= len)) {
+    return(RADIOLIB_ERR_INVALID_FRAME);
+  }
+
+  // release the previous contents
+  #if !defined(RADIOLIB_STATIC_ONLY)
+    if(frame->infoLen > 0) {
+      delete[] frame->info;
+    }
+    if(frame->numRepeaters > 0) {
+      for(uint8_t i = 0; i < frame->numRepeaters; i++) {
+        delete[] frame->repeaterCallsigns[i];
+      }
+      delete[] frame->repeaterCallsigns;
+      delete[] frame->repeaterSSIDs;
+    }
+    frame->repeaterCallsigns = NULL;
+    frame->repeaterSSIDs = NULL;
+  #endif
+  frame->infoLen = 0;
+  frame->numRepeaters = 0;
+
+  // addresses
+  uint8_t* dataPtr = data;
+  frame->destSSID = parseAddress(dataPtr, frame->destCallsign);
+  dataPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1;
+  frame->srcSSID = parseAddress(dataPtr, frame->srcCallsign);
+  dataPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1;
+  if(numRepeaters > 0) {
+    char repeaterCallsigns[8][RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1];
+    char* repeaterCallsignPtrs[8];
+    uint8_t repeaterSSIDs[8];
+    for(uint8_t i = 0; i < numRepeaters; i++) {
+      repeaterSSIDs[i] = parseAddress(dataPtr, repeaterCallsigns[i]);
+      repeaterCallsignPtrs[i] = repeaterCallsigns[i];
+      dataPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1;
+    }
+    int16_t state = frame->setRepeaters(repeaterCallsignPtrs, repeaterSSIDs, numRepeaters);
+    RADIOLIB_ASSERT(state);
+  }
+
+  // control field, sequence numbers are split off into their own fields
+  uint8_t controlField = *(dataPtr++);
+  frame->rcvSeqNumber = 0;
+  frame->sendSeqNumber = 0;
+  if((controlField & 0x01) == 0) {
+    // information frame, has both sequence numbers
+    frame->rcvSeqNumber = (controlField >> 5) & 0x07;
+    frame->sendSeqNumber = (controlField >> 1) & 0x07;
+    frame->control = controlField & RADIOLIB_AX25_CONTROL_POLL_FINAL_ENABLED;
+  } else if((controlField & 0x02) == 0) {
+    // supervisory frame, has only receive sequence number
+    frame->rcvSeqNumber = (controlField >> 5) & 0x07;
+    frame->control = controlField & 0x1F;
+  } else {
+    frame->control = controlField;
+  }
+
+  // PID field is only present in information and unnumbered information frames
+  frame->protocolID = 0x00;
+  if(((controlField & 0x01) == 0) || ((controlField & ~RADIOLIB_AX25_CONTROL_POLL_FINAL_ENABLED) == (RADIOLIB_AX25_CONTROL_U_UNNUMBERED_INFORMATION | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME))) {
+    if(dataPtr >= data + len) {
+      return(RADIOLIB_ERR_INVALID_FRAME);
+    }
+    frame->protocolID = *(dataPtr++);
+  }
+
+  // info field is the rest of the frame
+  uint16_t infoLen = (data + len) - dataPtr;
+  if(infoLen > 0) {
+    #if !defined(RADIOLIB_STATIC_ONLY)
+      frame->info = new uint8_t[infoLen];
+    #else
+      if(infoLen > RADIOLIB_STATIC_ARRAY_SIZE) {
+        infoLen = RADIOLIB_STATIC_ARRAY_SIZE;
+      }
+    #endif
+    memcpy(frame->info, dataPtr, infoLen);
+  }
+  frame->infoLen = infoLen;
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+#if !defined(RADIOLIB_EXCLUDE_AX25_LINK)
+int16_t AX25Client::connect(const char* destCallsign, uint8_t destSSID, bool extended) {
+  // check destination callsign length (6 characters max)
+  if(strlen(destCallsign) > RADIOLIB_AX25_MAX_CALLSIGN_LEN) {
+    return(RADIOLIB_ERR_INVALID_CALLSIGN);
+  }
+
+  // addresses are the same for all frames of the link, only command/response bits change
+  setAddress(_linkAddr, destCallsign, destSSID);
+  setAddress(&_linkAddr[RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1], _srcCallsign, _srcSSID);
+  _linkMask = extended ? 0x7F : 0x07;
+
+  // new remote station, forget the previous round trip estimate
+  _linkSrtt = 0;
+  _linkRttVar = 0;
+  _linkRto = RADIOLIB_AX25_LINK_T1_INITIAL;
+  return(linkEstablish());
+}
+
+int16_t AX25Client::disconnect() {
+  if(_linkState == RADIOLIB_AX25_LINK_DISCONNECTED) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  linkReset();
+  _linkState = RADIOLIB_AX25_LINK_AWAITING_RELEASE;
+  int16_t state = linkSend(RADIOLIB_AX25_CONTROL_U_DISCONNECT | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME, true, true, 0);
+  linkStartT1();
+  return(state);
+}
+
+int16_t AX25Client::sendData(uint8_t* data, size_t len) {
+  if(data == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(len > RADIOLIB_AX25_LINK_MAX_INFO) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+  if((_linkState != RADIOLIB_AX25_LINK_CONNECTED) && (_linkState != RADIOLIB_AX25_LINK_TIMER_RECOVERY)) {
+    return(RADIOLIB_ERR_LINK_NOT_CONNECTED);
+  }
+
+  // queued frames can't have more sequence numbers than the modulus allows
+  if((_linkQueued >= RADIOLIB_AX25_LINK_POOL_SIZE) || (_linkQueued >= _linkMask)) {
+    return(RADIOLIB_ERR_LINK_WINDOW_FULL);
+  }
+
+  // copy into the first free slot, it will be sent as soon as the window allows
+  uint8_t slot = (_linkPoolHead + _linkQueued) % RADIOLIB_AX25_LINK_POOL_SIZE;
+  memcpy(&_linkPool[slot*RADIOLIB_AX25_LINK_MAX_INFO], data, len);
+  _linkPoolLen[slot] = len;
+  _linkQueued++;
+  return(linkPump());
+}
+
+int16_t AX25Client::update() {
+  #if !defined(RADIOLIB_EXCLUDE_DIRECT_RECEIVE)
+    // process frames received in the meantime
+    while(_rxFull[_rxTail]) {
+      processFrame(&_rxPool[_rxTail*RADIOLIB_AX25_RX_MAX_LENGTH], _rxFrameLen[_rxTail]);
+      _rxFull[_rxTail] = false;
+      _rxTail = (_rxTail + 1) % RADIOLIB_AX25_RX_POOL_SIZE;
+    }
+  #endif
+
+  if(_linkState == RADIOLIB_AX25_LINK_DISCONNECTED) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // check timers
+  uint32_t now = _phy->getMod()->millis();
+  if(_linkT1Running && (now - _linkT1Start >= _linkT1)) {
+    _linkT1Running = false;
+    linkTimeout();
+  } else if(_linkT3Running && (now - _linkT3Start >= _linkT3)) {
+    // nothing heard for a long time, check the remote station is still there
+    _linkT3Running = false;
+    _linkRetries = 0;
+    _linkState = RADIOLIB_AX25_LINK_TIMER_RECOVERY;
+    linkSendSupervisory(true, true);
+    linkStartT1();
+  }
+
+  // send new information frames, acknowledgement is only sent separately when it can't be piggybacked
+  int16_t state = linkPump();
+  RADIOLIB_ASSERT(state);
+  if(_linkAckPending) {
+    state = linkSendSupervisory(false, false);
+  }
+  return(state);
+}
+
+int16_t AX25Client::processFrame(uint8_t* data, size_t len) {
+  if(data == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // find the end of address field, marked by HDLC extension bit
+  size_t addrLen = 0;
+  for(size_t i = RADIOLIB_AX25_MAX_CALLSIGN_LEN; i < len; i += RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1) {
+    if(data[i] & RADIOLIB_AX25_SSID_HDLC_EXTENSION_END) {
+      addrLen = i + 1;
+      break;
+    }
+  }
+  if((addrLen < 2*(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1)) || (addrLen >= len)) {
+    return(RADIOLIB_ERR_INVALID_FRAME);
+  }
+
+  // frames sent through repeaters are only accepted after the last repeater has sent them
+  if((addrLen > 2*(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1)) && !(data[addrLen - 1] & RADIOLIB_AX25_SSID_HAS_BEEN_REPEATED)) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // only frames for this station are processed
+  uint8_t ownAddr[RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1];
+  setAddress(ownAddr, _srcCallsign, _srcSSID);
+  if((memcmp(data, ownAddr, RADIOLIB_AX25_MAX_CALLSIGN_LEN) != 0) || ((data[RADIOLIB_AX25_MAX_CALLSIGN_LEN] & 0x1E) != (ownAddr[RADIOLIB_AX25_MAX_CALLSIGN_LEN] & 0x1E))) {
+    return(RADIOLIB_ERR_NONE);
+  }
+  uint8_t* srcAddr = &data[RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1];
+  bool peer = (_linkState != RADIOLIB_AX25_LINK_DISCONNECTED) && (memcmp(srcAddr, _linkAddr, RADIOLIB_AX25_MAX_CALLSIGN_LEN) == 0) &&
+              ((srcAddr[RADIOLIB_AX25_MAX_CALLSIGN_LEN] & 0x1E) == (_linkAddr[RADIOLIB_AX25_MAX_CALLSIGN_LEN] & 0x1E));
+
+  // response has the bit set only in source SSID, anything else (including AX.25 1.x frames) is a command
+  bool command = !(!(data[RADIOLIB_AX25_MAX_CALLSIGN_LEN] & RADIOLIB_AX25_SSID_COMMAND_DEST) && (srcAddr[RADIOLIB_AX25_MAX_CALLSIGN_LEN] & RADIOLIB_AX25_SSID_RESPONSE_SOURCE));
+
+  uint8_t* ctrl = &data[addrLen];
+  if((ctrl[0] & RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME) == RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME) {
+    bool pf = ctrl[0] & RADIOLIB_AX25_CONTROL_POLL_FINAL_ENABLED;
+    uint8_t type = ctrl[0] & ~(RADIOLIB_AX25_CONTROL_POLL_FINAL_ENABLED | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME);
+    switch(type) {
+      case(RADIOLIB_AX25_CONTROL_U_SET_ASYNC_BAL_MODE):
+      case(RADIOLIB_AX25_CONTROL_U_SET_ASYNC_BAL_MODE_EXT):
+        if(!command || (!peer && (_linkState != RADIOLIB_AX25_LINK_DISCONNECTED))) {
+          // already connected to another station
+          return(RADIOLIB_ERR_NONE);
+        }
+
+        // incoming connection is accepted, or the remote station restarted the existing link
+        if(!peer) {
+          linkSetPeer(srcAddr);
+          _linkSrtt = 0;
+          _linkRttVar = 0;
+          _linkRto = RADIOLIB_AX25_LINK_T1_INITIAL;
+        }
+        _linkMask = (type == RADIOLIB_AX25_CONTROL_U_SET_ASYNC_BAL_MODE_EXT) ? 0x7F : 0x07;
+        linkReset();
+        _linkState = RADIOLIB_AX25_LINK_CONNECTED;
+        _linkT3Start = _phy->getMod()->millis();
+        _linkT3Running = true;
+        return(linkSend(RADIOLIB_AX25_CONTROL_U_UNNUMBERED_ACK | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME, false, pf, 0));
+
+      case(RADIOLIB_AX25_CONTROL_U_DISCONNECT):
+        if(!command) {
+          return(RADIOLIB_ERR_NONE);
+        }
+        if(!peer) {
+          // the remote station probably missed our acknowledgement of its previous DISC
+          if(_linkState != RADIOLIB_AX25_LINK_DISCONNECTED) {
+            return(RADIOLIB_ERR_NONE);
+          }
+          linkSetPeer(srcAddr);
+          return(linkSend(RADIOLIB_AX25_CONTROL_U_DISCONNECT_MODE | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME, false, pf, 0));
+        }
+        linkReset();
+        _linkState = RADIOLIB_AX25_LINK_DISCONNECTED;
+        return(linkSend(RADIOLIB_AX25_CONTROL_U_UNNUMBERED_ACK | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME, false, pf, 0));
+
+      case(RADIOLIB_AX25_CONTROL_U_UNNUMBERED_ACK):
+        if(!peer) {
+          return(RADIOLIB_ERR_NONE);
+        }
+        if(_linkState == RADIOLIB_AX25_LINK_AWAITING_CONNECTION) {
+          if(_linkRttTiming) {
+            linkRoundTrip(_phy->getMod()->millis() - _linkRttStart);
+          }
+          linkReset();
+          _linkState = RADIOLIB_AX25_LINK_CONNECTED;
+          _linkT3Start = _phy->getMod()->millis();
+          _linkT3Running = true;
+        } else if(_linkState == RADIOLIB_AX25_LINK_AWAITING_RELEASE) {
+          linkReset();
+          _linkState = RADIOLIB_AX25_LINK_DISCONNECTED;
+        }
+        return(RADIOLIB_ERR_NONE);
+
+      case(RADIOLIB_AX25_CONTROL_U_DISCONNECT_MODE):
+        // connection refused or the remote station dropped the link
+        if(peer) {
+          linkReset();
+          _linkState = RADIOLIB_AX25_LINK_DISCONNECTED;
+        }
+        return(RADIOLIB_ERR_NONE);
+
+      case(RADIOLIB_AX25_CONTROL_U_FRAME_REJECT):
+        if(peer && ((_linkState == RADIOLIB_AX25_LINK_CONNECTED) || (_linkState == RADIOLIB_AX25_LINK_TIMER_RECOVERY))) {
+          return(linkEstablish());
+        }
+        return(RADIOLIB_ERR_NONE);
+
+      default:
+        // unnumbered information and other frames are not part of the link
+        return(RADIOLIB_ERR_NONE);
+    }
+  }
+
+  // information and supervisory frames are only processed on established link
+  if((_linkState == RADIOLIB_AX25_LINK_DISCONNECTED) && command) {
+    // tell the remote station the link is gone, so that it doesn't have to wait for all retries
+    linkSetPeer(srcAddr);
+    return(linkSend(RADIOLIB_AX25_CONTROL_U_DISCONNECT_MODE | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME, false, ctrl[0] & RADIOLIB_AX25_CONTROL_POLL_FINAL_ENABLED, 0));
+  }
+  if(!peer || ((_linkState != RADIOLIB_AX25_LINK_CONNECTED) && (_linkState != RADIOLIB_AX25_LINK_TIMER_RECOVERY))) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // modulo 128 frames have 2-byte control field
+  size_t ctrlLen = (_linkMask == 0x07) ? 1 : 2;
+  if(addrLen + ctrlLen > len) {
+    return(RADIOLIB_ERR_INVALID_FRAME);
+  }
+  uint8_t nr, ns;
+  bool pf;
+  if(ctrlLen == 1) {
+    nr = ctrl[0] >> 5;
+    ns = (ctrl[0] >> 1) & 0x07;
+    pf = ctrl[0] & RADIOLIB_AX25_CONTROL_POLL_FINAL_ENABLED;
+  } else {
+    nr = ctrl[1] >> 1;
+    ns = ctrl[0] >> 1;
+    pf = ctrl[1] & 0x01;
+  }
+
+  if((ctrl[0] & 0x01) == RADIOLIB_AX25_CONTROL_INFORMATION_FRAME) {
+    // information frame has PID, the rest is data
+    if(addrLen + ctrlLen + 1 > len) {
+      return(RADIOLIB_ERR_INVALID_FRAME);
+    }
+    if(!linkAcknowledge(nr)) {
+      return(linkEstablish());
+    }
+    if(_linkOwnBusy) {
+      // data is discarded, the remote station will send it again once the busy condition is cleared
+      return(pf ? linkSendSupervisory(false, true) : RADIOLIB_ERR_NONE);
+    }
+
+    if(ns == _linkVr) {
+      _linkVr = (_linkVr + 1) & _linkMask;
+      _linkRejectSent = false;
+      size_t infoLen = len - (addrLen + ctrlLen + 1);
+      if((_linkDataAction != NULL) && (infoLen > 0)) {
+        _linkDataAction(&ctrl[ctrlLen + 1], infoLen);
+      }
+      if(pf) {
+        return(linkSendSupervisory(false, true));
+      }
+      _linkAckPending = true;
+      return(RADIOLIB_ERR_NONE);
+    }
+
+    // out of sequence frames are not kept, so ask for everything since the expected frame (REJ, not SREJ) only once
+    if(_linkRejectSent) {
+      return(pf ? linkSendSupervisory(false, true) : RADIOLIB_ERR_NONE);
+    }
+    _linkRejectSent = true;
+    return(linkSend(RADIOLIB_AX25_CONTROL_S_REJECT | RADIOLIB_AX25_CONTROL_SUPERVISORY_FRAME, false, pf, 0));
+  }
+
+  // supervisory frame
+  uint8_t type = ctrl[0] & 0x0F & ~RADIOLIB_AX25_CONTROL_SUPERVISORY_FRAME;
+  if(type == RADIOLIB_AX25_CONTROL_S_SELECTIVE_REJECT) {
+    // frames before the rejected one are only acknowledged when final bit is set
+    if(pf && !linkAcknowledge(nr)) {
+      return(linkEstablish());
+    }
+    if(((nr - _linkVa) & _linkMask) >= ((_linkVs - _linkVa) & _linkMask)) {
+      return(RADIOLIB_ERR_NONE);
+    }
+    _linkRttTiming = false;
+    return(linkSend(RADIOLIB_AX25_CONTROL_INFORMATION_FRAME, true, false, nr));
+  }
+
+  _linkPeerBusy = (type == RADIOLIB_AX25_CONTROL_S_RECEIVE_NOT_READY);
+  if(!linkAcknowledge(nr)) {
+    return(linkEstablish());
+  }
+
+  int16_t state = RADIOLIB_ERR_NONE;
+  if(command && pf) {
+    state = linkSendSupervisory(false, true);
+    RADIOLIB_ASSERT(state);
+  }
+
+  if(_linkState == RADIOLIB_AX25_LINK_TIMER_RECOVERY) {
+    // answer to our poll, resend everything that was not acknowledged
+    if(!command && pf) {
+      _linkT1Running = false;
+      _linkRetries = 0;
+      _linkState = RADIOLIB_AX25_LINK_CONNECTED;
+      linkRetransmit(_linkVa);
+      if(_linkQueued == 0) {
+        _linkT3Start = _phy->getMod()->millis();
+        _linkT3Running = true;
+      }
+    }
+  } else if(type == RADIOLIB_AX25_CONTROL_S_REJECT) {
+    linkRetransmit(nr);
+  }
+
+  // busy remote station is polled when T1 expires
+  if(_linkPeerBusy && !_linkT1Running) {
+    linkStartT1();
+  }
+  return(state);
+}
+
+int16_t AX25Client::setWindow(uint8_t k) {
+  if((k == 0) || (k > RADIOLIB_AX25_LINK_MAX_WINDOW) || (k > RADIOLIB_AX25_LINK_POOL_SIZE)) {
+    return(RADIOLIB_ERR_INVALID_WINDOW_SIZE);
+  }
+  _linkWindow = k;
+  return(RADIOLIB_ERR_NONE);
+}
+
+void AX25Client::setIdleTimeout(uint32_t timeout) {
+  _linkT3 = timeout;
+}
+
+void AX25Client::setLinkDataAction(void (*func)(uint8_t*, size_t)) {
+  _linkDataAction = func;
+}
+
+void AX25Client::setBusy(bool busy) {
+  if(busy == _linkOwnBusy) {
+    return;
+  }
+
+  // tell the remote station immediately
+  _linkOwnBusy = busy;
+  if((_linkState == RADIOLIB_AX25_LINK_CONNECTED) || (_linkState == RADIOLIB_AX25_LINK_TIMER_RECOVERY)) {
+    linkSendSupervisory(false, false);
+  }
+}
+
+uint8_t AX25Client::getLinkState() {
+  return(_linkState);
+}
+
+uint8_t AX25Client::getLinkPeer(char* callsign) {
+  return(parseAddress(_linkAddr, callsign));
+}
+
+size_t AX25Client::getQueued() {
+  return(_linkQueued);
+}
+
+uint32_t AX25Client::getRoundTripTime() {
+  return(_linkSrtt);
+}
+
+void AX25Client::linkSetPeer(uint8_t* addr) {
+  memcpy(_linkAddr, addr, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+  _linkAddr[RADIOLIB_AX25_MAX_CALLSIGN_LEN] = RADIOLIB_AX25_SSID_RESERVED_BITS | (addr[RADIOLIB_AX25_MAX_CALLSIGN_LEN] & 0x1E);
+  setAddress(&_linkAddr[RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1], _srcCallsign, _srcSSID);
+}
+
+void AX25Client::linkReset() {
+  // allocate the retransmission pool only once
+  #if !defined(RADIOLIB_STATIC_ONLY)
+    if(_linkPool == NULL) {
+      _linkPool = new uint8_t[RADIOLIB_AX25_LINK_POOL_SIZE*RADIOLIB_AX25_LINK_MAX_INFO];
+    }
   #endif
-  uint8_t* frameBuffPtr = frameBuff;
+
+  _linkVs = 0;
+  _linkVa = 0;
+  _linkVr = 0;
+  _linkRetries = 0;
+  _linkPeerBusy = false;
+  _linkRejectSent = false;
+  _linkAckPending = false;
+  _linkT1Running = false;
+  _linkT3Running = false;
+  _linkRttTiming = false;
+  _linkPoolHead = 0;
+  _linkQueued = 0;
+  _linkSent = 0;
+}
+
+int16_t AX25Client::linkSend(uint8_t type, bool command, bool pollFinal, uint8_t seq) {
+  // command has the bit set in destination SSID, response in source SSID
+  uint8_t header[2*(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1) + 3];
+  size_t headerLen = 2*(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1);
+  memcpy(header, _linkAddr, headerLen);
+  if(command) {
+    header[RADIOLIB_AX25_MAX_CALLSIGN_LEN] |= RADIOLIB_AX25_SSID_COMMAND_DEST;
+  } else {
+    header[headerLen - 1] |= RADIOLIB_AX25_SSID_RESPONSE_SOURCE;
+  }
+  header[headerLen - 1] |= RADIOLIB_AX25_SSID_HDLC_EXTENSION_END;
+
+  // unnumbered frames have 1-byte control field, the others carry sequence numbers
+  uint8_t pf = pollFinal ? 1 : 0;
+  uint8_t* info = NULL;
+  size_t infoLen = 0;
+  if((type & RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME) == RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME) {
+    header[headerLen++] = type | (pf << 4);
+  } else {
+    uint8_t ns = ((type & 0x01) == RADIOLIB_AX25_CONTROL_INFORMATION_FRAME) ? seq : 0;
+    if(_linkMask == 0x07) {
+      header[headerLen++] = (_linkVr << 5) | (pf << 4) | (ns << 1) | type;
+    } else {
+      header[headerLen++] = (ns << 1) | type;
+      header[headerLen++] = (_linkVr << 1) | pf;
+    }
+
+    // the frame acknowledges everything received so far
+    _linkAckPending = false;
+
+    if((type & 0x01) == RADIOLIB_AX25_CONTROL_INFORMATION_FRAME) {
+      header[headerLen++] = RADIOLIB_AX25_PID_NO_LAYER_3;
+      uint8_t slot = linkSlot(seq);
+      info = &_linkPool[slot*RADIOLIB_AX25_LINK_MAX_INFO];
+      infoLen = _linkPoolLen[slot];
+    }
+  }
+
+  int16_t state = transmitEncoded(header, headerLen, info, infoLen);
+
+  #if !defined(RADIOLIB_EXCLUDE_DIRECT_RECEIVE)
+    // only re-arm when this client receives in direct mode, stream transmission switches to packet mode by itself
+    // transmission interrupted reception, so the decoder has to wait for the next flag
+    if(_decodeBitInstance == this) {
+      _rxHunting = true;
+      _phy->receiveDirect();
+    }
+  #endif
+  return(state);
+}
+
+int16_t AX25Client::linkSendSupervisory(bool command, bool pollFinal) {
+  uint8_t type = _linkOwnBusy ? RADIOLIB_AX25_CONTROL_S_RECEIVE_NOT_READY : RADIOLIB_AX25_CONTROL_S_RECEIVE_READY;
+  return(linkSend(type | RADIOLIB_AX25_CONTROL_SUPERVISORY_FRAME, command, pollFinal, 0));
+}
+
+int16_t AX25Client::linkPump() {
+  // no new frames are sent while waiting for answer to a poll
+  if(_linkState != RADIOLIB_AX25_LINK_CONNECTED) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  int16_t state = RADIOLIB_ERR_NONE;
+  uint8_t outstanding = (_linkVs - _linkVa) & _linkMask;
+  while(!_linkPeerBusy && (outstanding < _linkWindow) && (outstanding < _linkQueued)) {
+    state = linkSend(RADIOLIB_AX25_CONTROL_INFORMATION_FRAME, true, false, _linkVs);
+    RADIOLIB_ASSERT(state);
+
+    // only frames sent for the first time can be timed, otherwise it is not known which copy was acknowledged
+    if(outstanding >= _linkSent) {
+      _linkSent = outstanding + 1;
+      if(!_linkRttTiming) {
+        _linkRttTiming = true;
+        _linkRttSeq = _linkVs;
+        _linkRttStart = _phy->getMod()->millis();
+      }
+    }
+
+    _linkVs = (_linkVs + 1) & _linkMask;
+    outstanding++;
+    if(!_linkT1Running) {
+      linkStartT1();
+    }
+  }
+  return(state);
+}
+
+bool AX25Client::linkAcknowledge(uint8_t nr) {
+  // N(R) must be between the oldest unacknowledged frame and the next one to send
+  uint8_t num = (nr - _linkVa) & _linkMask;
+  if(num > ((_linkVs - _linkVa) & _linkMask)) {
+    return(false);
+  }
+
+  if(num > 0) {
+    if(_linkRttTiming && (((_linkRttSeq - _linkVa) & _linkMask) < num)) {
+      _linkRttTiming = false;
+      linkRoundTrip(_phy->getMod()->millis() - _linkRttStart);
+    }
+
+    // release acknowledged frames from the pool
+    _linkPoolHead = (_linkPoolHead + num) % RADIOLIB_AX25_LINK_POOL_SIZE;
+    _linkQueued -= num;
+    _linkSent -= num;
+    _linkVa = nr;
+  }
+
+  // with nothing left to recover, any frame from the remote station shows the link is still up
+  if((_linkState == RADIOLIB_AX25_LINK_TIMER_RECOVERY) && (_linkVa == _linkVs)) {
+    _linkState = RADIOLIB_AX25_LINK_CONNECTED;
+    _linkRetries = 0;
+    num = 1;
+  }
+
+  // while polling, timers are handled when the answer arrives
+  if((num > 0) && (_linkState == RADIOLIB_AX25_LINK_CONNECTED)) {
+    if(_linkVa == _linkVs) {
+      _linkT1Running = false;
+      _linkT3Start = _phy->getMod()->millis();
+      _linkT3Running = true;
+    } else {
+      linkStartT1();
+    }
+  }
+  return(true);
+}
+
+void AX25Client::linkRetransmit(uint8_t from) {
+  _linkVs = from;
+  _linkRttTiming = false;
+}
+
+void AX25Client::linkRoundTrip(uint32_t rtt) {
+  // smoothed round trip time and its mean deviation, as used for TCP retransmission timer
+  int32_t err = (int32_t)rtt - _linkSrtt;
+  if((_linkSrtt == 0) && (_linkRttVar == 0)) {
+    _linkSrtt = rtt;
+    _linkRttVar = rtt / 2;
+  } else {
+    _linkSrtt += err / 8;
+    if(err < 0) {
+      err = -err;
+    }
+    _linkRttVar += (err - _linkRttVar) / 4;
+  }
+
+  _linkRto = _linkSrtt + 4*_linkRttVar;
+  if(_linkRto < RADIOLIB_AX25_LINK_T1_MIN) {
+    _linkRto = RADIOLIB_AX25_LINK_T1_MIN;
+  } else if(_linkRto > RADIOLIB_AX25_LINK_T1_MAX) {
+    _linkRto = RADIOLIB_AX25_LINK_T1_MAX;
+  }
+}
+
+void AX25Client::linkTimeout() {
+  // acknowledgement of the timed frame can't be told apart from acknowledgement of its retransmission
+  _linkRttTiming = false;
+
+  if(_linkRetries >= RADIOLIB_AX25_LINK_MAX_RETRIES) {
+    // remote station is gone
+    linkReset();
+    _linkState = RADIOLIB_AX25_LINK_DISCONNECTED;
+    return;
+  }
+  _linkRetries++;
+
+  switch(_linkState) {
+    case(RADIOLIB_AX25_LINK_AWAITING_CONNECTION):
+      linkSend(((_linkMask == 0x07) ? RADIOLIB_AX25_CONTROL_U_SET_ASYNC_BAL_MODE : RADIOLIB_AX25_CONTROL_U_SET_ASYNC_BAL_MODE_EXT) | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME, true, true, 0);
+      break;
+    case(RADIOLIB_AX25_LINK_AWAITING_RELEASE):
+      linkSend(RADIOLIB_AX25_CONTROL_U_DISCONNECT | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME, true, true, 0);
+      break;
+    default:
+      // poll the remote station to find out what it received
+      _linkState = RADIOLIB_AX25_LINK_TIMER_RECOVERY;
+      linkSendSupervisory(true, true);
+      break;
+  }
+  linkStartT1();
+}
+
+void AX25Client::linkStartT1() {
+  // back off exponentially while retrying, the estimate itself is kept for when the remote station answers
+  _linkT1 = _linkRto << _linkRetries;
+  if(_linkT1 > RADIOLIB_AX25_LINK_T1_MAX) {
+    _linkT1 = RADIOLIB_AX25_LINK_T1_MAX;
+  }
+  _linkT1Start = _phy->getMod()->millis();
+  _linkT1Running = true;
+  _linkT3Running = false;
+}
+
+int16_t AX25Client::linkEstablish() {
+  // all unacknowledged frames are discarded
+  linkReset();
+  _linkState = RADIOLIB_AX25_LINK_AWAITING_CONNECTION;
+  uint8_t type = (_linkMask == 0x07) ? RADIOLIB_AX25_CONTROL_U_SET_ASYNC_BAL_MODE : RADIOLIB_AX25_CONTROL_U_SET_ASYNC_BAL_MODE_EXT;
+  int16_t state = linkSend(type | RADIOLIB_AX25_CONTROL_UNNUMBERED_FRAME, true, true, 0);
+  linkStartT1();
+  _linkRttTiming = true;
+  _linkRttStart = _linkT1Start;
+  return(state);
+}
+
+uint8_t AX25Client::linkSlot(uint8_t seq) {
+  return((_linkPoolHead + ((seq - _linkVa) & _linkMask)) % RADIOLIB_AX25_LINK_POOL_SIZE);
+}
+#endif
+
+void AX25Client::getCallsign(char* buff) {
+  strncpy(buff, _srcCallsign, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+}
+
+uint8_t AX25Client::getSSID() {
+  return(_srcSSID);
+}
+
+size_t AX25Client::buildHeader(AX25Frame* frame, uint8_t* buff) {
+  uint8_t* buffPtr = buff;
 
   // set destination callsign - all address field bytes are shifted by one bit to make room for HDLC address extension bit
-  memset(frameBuffPtr, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+  memset(buffPtr, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
   for(size_t i = 0; i < strlen(frame->destCallsign); i++) {
-    *(frameBuffPtr + i) = frame->destCallsign[i] << 1;
+    *(buffPtr + i) = frame->destCallsign[i] << 1;
   }
-  frameBuffPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN;
+  buffPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN;
 
   // set destination SSID
-  *(frameBuffPtr++) = RADIOLIB_AX25_SSID_RESPONSE_DEST | RADIOLIB_AX25_SSID_RESERVED_BITS | (frame->destSSID & 0x0F) << 1 | RADIOLIB_AX25_SSID_HDLC_EXTENSION_CONTINUE;
+  *(buffPtr++) = RADIOLIB_AX25_SSID_RESPONSE_DEST | RADIOLIB_AX25_SSID_RESERVED_BITS | (frame->destSSID & 0x0F) << 1 | RADIOLIB_AX25_SSID_HDLC_EXTENSION_CONTINUE;
 
   // set source callsign - all address field bytes are shifted by one bit to make room for HDLC address extension bit
-  memset(frameBuffPtr, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+  memset(buffPtr, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
   for(size_t i = 0; i < strlen(frame->srcCallsign); i++) {
-    *(frameBuffPtr + i) = frame->srcCallsign[i] << 1;
+    *(buffPtr + i) = frame->srcCallsign[i] << 1;
   }
-  frameBuffPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN;
+  buffPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN;
 
   // set source SSID
-  *(frameBuffPtr++) = RADIOLIB_AX25_SSID_COMMAND_SOURCE | RADIOLIB_AX25_SSID_RESERVED_BITS | (frame->srcSSID & 0x0F) << 1 | RADIOLIB_AX25_SSID_HDLC_EXTENSION_CONTINUE;
+  *(buffPtr++) = RADIOLIB_AX25_SSID_COMMAND_SOURCE | RADIOLIB_AX25_SSID_RESERVED_BITS | (frame->srcSSID & 0x0F) << 1 | RADIOLIB_AX25_SSID_HDLC_EXTENSION_CONTINUE;
 
   // set repeater callsigns
   for(uint16_t i = 0; i < frame->numRepeaters; i++) {
-    memset(frameBuffPtr, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+    memset(buffPtr, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
     for(size_t j = 0; j < strlen(frame->repeaterCallsigns[i]); j++) {
-      *(frameBuffPtr + j) = frame->repeaterCallsigns[i][j] << 1;
+      *(buffPtr + j) = frame->repeaterCallsigns[i][j] << 1;
     }
-    frameBuffPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN;
-    *(frameBuffPtr++) = RADIOLIB_AX25_SSID_HAS_NOT_BEEN_REPEATED | RADIOLIB_AX25_SSID_RESERVED_BITS | (frame->repeaterSSIDs[i] & 0x0F) << 1 | RADIOLIB_AX25_SSID_HDLC_EXTENSION_CONTINUE;
+    buffPtr += RADIOLIB_AX25_MAX_CALLSIGN_LEN;
+    *(buffPtr++) = RADIOLIB_AX25_SSID_HAS_NOT_BEEN_REPEATED | RADIOLIB_AX25_SSID_RESERVED_BITS | (frame->repeaterSSIDs[i] & 0x0F) << 1 | RADIOLIB_AX25_SSID_HDLC_EXTENSION_CONTINUE;
   }
 
   // set HDLC extension end bit
-  *(frameBuffPtr - 1) |= RADIOLIB_AX25_SSID_HDLC_EXTENSION_END;
+  *(buffPtr - 1) |= RADIOLIB_AX25_SSID_HDLC_EXTENSION_END;
 
   // set sequence numbers of the frames that have it
   uint8_t controlField = frame->control;
@@ -283,187 +1279,210 @@ int16_t AX25Client::sendFrame(AX25Frame* frame) {
   }
 
   // set control field
-  *(frameBuffPtr++) = controlField;
+  *(buffPtr++) = controlField;
 
   // set PID field of the frames that have it
   if(frame->protocolID != 0x00) {
-    *(frameBuffPtr++) = frame->protocolID;
+    *(buffPtr++) = frame->protocolID;
   }
 
-  // set info field of the frames that have it
-  if(frame->infoLen > 0) {
-    memcpy(frameBuffPtr, frame->info, frame->infoLen);
-    frameBuffPtr += frame->infoLen;
-  }
+  return(buffPtr - buff);
+}
 
-  // flip bit order
-  for(size_t i = 0; i < frameBuffLen; i++) {
-    frameBuff[i] = Module::flipBits(frameBuff[i]);
+size_t AX25Client::encodeStart(uint8_t* header, size_t headerLen, uint8_t* info, size_t infoLen) {
+  _encHeader = header;
+  _encHeaderLen = headerLen;
+  _encInfo = info;
+  _encInfoLen = infoLen;
+
+  // dry run to get the encoded length, stuffing depends on the data
+  encodeReset();
+  size_t len = 0;
+  while(!_encDone) {
+    len += encodeNext(_encPending);
   }
+  encodeReset();
+  return(len);
+}
 
-  // calculate FCS
-  uint16_t fcs = getFrameCheckSequence(frameBuff, frameBuffLen);
-  *(frameBuffPtr++) = (uint8_t)((fcs >> 8) & 0xFF);
-  *(frameBuffPtr++) = (uint8_t)(fcs & 0xFF);
+size_t AX25Client::encodeNext(uint8_t* out) {
+  if(_encDone) {
+    return(0);
+  }
 
-  // prepare buffer for the final frame (stuffed, with added preamble + flags and NRZI-encoded)
-  #if !defined(RADIOLIB_STATIC_ONLY)
-    // worst-case scenario: sequence of 1s, will have 120% of the original length, stuffed frame also includes both flags
-    uint8_t* stuffedFrameBuff = new uint8_t[_preambleLen + 1 + (6*frameBuffLen)/5 + 2];
-  #else
-    uint8_t stuffedFrameBuff[RADIOLIB_STATIC_ARRAY_SIZE];
-  #endif
+  // preamble and start flag
+  size_t i = _encPos++;
+  if(i < (size_t)_preambleLen + 1) {
+    return(encodeByte(RADIOLIB_AX25_FLAG, false, out));
+  }
+  i -= _preambleLen + 1;
+
+  // address, control, PID and info fields
+  size_t dataLen = _encHeaderLen + _encInfoLen;
+  if(i < dataLen) {
+    uint8_t b = (i < _encHeaderLen) ? _encHeader[i] : _encInfo[i - _encHeaderLen];
+    _encCrc = updateFrameCheckSequence(_encCrc, b);
+    return(encodeByte(b, true, out));
+  }
+  i -= dataLen;
 
-  // initialize buffer to all zeros
-  memset(stuffedFrameBuff, 0x00, _preambleLen + 1 + (6*frameBuffLen)/5 + 2);
-
-  // stuff bits (skip preamble and both flags)
-  uint16_t stuffedFrameBuffLenBits = 8*(_preambleLen + 1);
-  uint8_t count = 0;
-  for(size_t i = 0; i < frameBuffLen + 2; i++) {
-    for(int8_t shift = 7; shift >= 0; shift--) {
-      uint16_t stuffedFrameBuffPos = stuffedFrameBuffLenBits + 7 - 2*(stuffedFrameBuffLenBits%8);
-      if((frameBuff[i] >> shift) & 0x01) {
-        // copy 1 and increment counter
-        SET_BIT_IN_ARRAY(stuffedFrameBuff, stuffedFrameBuffPos);
-        stuffedFrameBuffLenBits++;
-        count++;
-
-        // check 5 consecutive 1s
-        if(count == 5) {
-          // get the new position in stuffed frame
-          stuffedFrameBuffPos = stuffedFrameBuffLenBits + 7 - 2*(stuffedFrameBuffLenBits%8);
-
-          // insert 0 and reset counter
-          CLEAR_BIT_IN_ARRAY(stuffedFrameBuff, stuffedFrameBuffPos);
-          stuffedFrameBuffLenBits++;
-          count = 0;
-        }
+  // FCS, sent least significant byte first
+  if(i < 2) {
+    uint16_t fcs = ~_encCrc;
+    return(encodeByte((i == 0) ? (fcs & 0xFF) : (fcs >> 8), true, out));
+  }
 
-      } else {
-        // copy 0 and reset counter
-        CLEAR_BIT_IN_ARRAY(stuffedFrameBuff, stuffedFrameBuffPos);
-        stuffedFrameBuffLenBits++;
-        count = 0;
-      }
+  // end flag and padding
+  if(i == 2) {
+    return(encodeByte(RADIOLIB_AX25_FLAG, false, out));
+  }
+  _encDone = true;
+  return(encodeFlush(out));
+}
 
+size_t AX25Client::encodeChunk(uint8_t* buff, size_t len) {
+  size_t num = 0;
+  while(num < len) {
+    // output leftovers from the previous byte first
+    if(_encPendingPos < _encPendingLen) {
+      buff[num++] = _encPending[_encPendingPos++];
+      continue;
     }
+    if(_encDone) {
+      break;
+    }
+    _encPendingLen = encodeNext(_encPending);
+    _encPendingPos = 0;
   }
+  return(num);
+}
 
-  // deallocate memory
-  #if !defined(RADIOLIB_STATIC_ONLY)
-    delete[] frameBuff;
-  #endif
+size_t AX25Client::encodeStream(void* ctx, uint8_t* buff, size_t len) {
+  return(((AX25Client*)ctx)->encodeChunk(buff, len));
+}
 
-  // set preamble bytes and start flag field
-  for(uint16_t i = 0; i < _preambleLen + 1; i++) {
-    stuffedFrameBuff[i] = RADIOLIB_AX25_FLAG;
+void AX25Client::encodeReset() {
+  _encBuff = 0;
+  _encBits = 0;
+  _encOnes = 0;
+  _encLevel = 0;
+  _encPos = 0;
+  _encCrc = CRC_CCITT_INIT;
+  _encPendingLen = 0;
+  _encPendingPos = 0;
+  _encDone = false;
+}
+
+size_t AX25Client::encodeByte(uint8_t b, bool stuff, uint8_t* out) {
+  // flags are never stuffed
+  if(!stuff) {
+    _encBuff |= (uint16_t)b << _encBits;
+    _encBits += 8;
+    _encOnes = 0;
+    return(encodeOutput(out));
   }
 
-  // get stuffed frame length in bytes
-  size_t stuffedFrameBuffLen = stuffedFrameBuffLenBits/8 + 1;
-  uint8_t trailingLen = stuffedFrameBuffLenBits % 8;
+  // most bytes can't form 5 consecutive 1s with the previous byte, those are appended at once
+  uint8_t runs = RADIOLIB_NONVOLATILE_READ_BYTE(&AX25StuffTable[b]);
+  if((runs != 0xFF) && (_encOnes + (runs & 0x07) < 5)) {
+    _encBuff |= (uint16_t)b << _encBits;
+    _encBits += 8;
+    _encOnes = runs >> 3;
+    return(encodeOutput(out));
+  }
 
-  // set end flag field (may be split into two bytes due to misalignment caused by extra stuffing bits)
-  if(trailingLen != 0) {
-    stuffedFrameBuffLen++;
-    stuffedFrameBuff[stuffedFrameBuffLen - 2] |= RADIOLIB_AX25_FLAG >> trailingLen;
-    stuffedFrameBuff[stuffedFrameBuffLen - 1] = RADIOLIB_AX25_FLAG << (8 - trailingLen);
-  } else {
-    stuffedFrameBuff[stuffedFrameBuffLen - 1] = RADIOLIB_AX25_FLAG;
-  }
-
-  // convert to NRZI
-  for(size_t i = _preambleLen + 1; i < stuffedFrameBuffLen*8; i++) {
-    size_t currBitPos = i + 7 - 2*(i%8);
-    size_t prevBitPos = (i - 1) + 7 - 2*((i - 1)%8);
-    if(TEST_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos)) {
-      // bit is 1, no change, copy previous bit
-      if(TEST_BIT_IN_ARRAY(stuffedFrameBuff, prevBitPos)) {
-        SET_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos);
-      } else {
-        CLEAR_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos);
+  // otherwise stuff bit by bit
+  size_t num = 0;
+  for(uint8_t i = 0; i < 8; i++) {
+    if((b >> i) & 0x01) {
+      _encBuff |= (uint16_t)1 << _encBits;
+      _encBits++;
+      _encOnes++;
+
+      // insert 0 after 5 consecutive 1s
+      if(_encOnes == 5) {
+        _encBits++;
+        _encOnes = 0;
       }
-
     } else {
-      // bit is 0, transition, copy inversion of the previous bit
-      if(TEST_BIT_IN_ARRAY(stuffedFrameBuff, prevBitPos)) {
-        CLEAR_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos);
-      } else {
-        SET_BIT_IN_ARRAY(stuffedFrameBuff, currBitPos);
-      }
+      _encBits++;
+      _encOnes = 0;
     }
+    num += encodeOutput(&out[num]);
   }
+  return(num);
+}
 
-  // transmit
-  int16_t state = RADIOLIB_ERR_NONE;
-  #if !defined(RADIOLIB_EXCLUDE_AFSK)
-  if(_audio != nullptr) {
-    Module* mod = _phy->getMod();
-    _phy->transmitDirect();
-
-    // iterate over all bytes in the buffer
-    for(uint32_t i = 0; i < stuffedFrameBuffLen; i++) {
-
-      // check each bit
-      for(uint16_t mask = 0x80; mask >= 0x01; mask >>= 1) {
-        uint32_t start = mod->micros();
-        if(stuffedFrameBuff[i] & mask) {
-          _audio->tone(_afskMark, false);
-        } else {
-          _audio->tone(_afskSpace, false);
-        }
-        mod->waitForMicroseconds(start, _afskLen);
-      }
+size_t AX25Client::encodeFlush(uint8_t* out) {
+  // pad the last byte with 0s
+  if(_encBits == 0) {
+    return(0);
+  }
+  _encBits = 8;
+  return(encodeOutput(out));
+}
 
+size_t AX25Client::encodeOutput(uint8_t* out) {
+  size_t num = 0;
+  while(_encBits >= 8) {
+    // NRZI - level changes on every 0, so the output is prefix XOR of the inverted bits, starting from the previous level
+    uint8_t b = ~(uint8_t)(_encBuff & 0xFF);
+    b ^= b << 1;
+    b ^= b << 2;
+    b ^= b << 4;
+    if(_encLevel) {
+      b = ~b;
     }
+    _encLevel = b >> 7;
 
-    _audio->noTone();
-
-  } else {
-  #endif
-    state = _phy->transmit(stuffedFrameBuff, stuffedFrameBuffLen);
-  #if !defined(RADIOLIB_EXCLUDE_AFSK)
+    // the bits were collected least significant first, but are transmitted most significant first
+    out[num++] = Module::flipBits(b);
+    _encBuff >>= 8;
+    _encBits -= 8;
   }
-  #endif
-
-  // deallocate memory
-  #if !defined(RADIOLIB_STATIC_ONLY)
-    delete[] stuffedFrameBuff;
-  #endif
-
-  return(state);
+  return(num);
 }
 
-void AX25Client::getCallsign(char* buff) {
-  strncpy(buff, _srcCallsign, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+uint16_t AX25Client::getFrameCheckSequence(uint8_t* buff, size_t len) {
+  uint16_t crc = CRC_CCITT_INIT;
+  for(size_t i = 0; i < len; i++) {
+    crc = updateFrameCheckSequence(crc, buff[i]);
+  }
+  return(~crc);
 }
 
-uint8_t AX25Client::getSSID() {
-  return(_srcSSID);
+uint16_t AX25Client::updateFrameCheckSequence(uint16_t crc, uint8_t b) {
+  // reflected CRC-CCITT, one nibble at a time
+  crc ^= b;
+  uint8_t i = crc & 0x0F;
+  crc = (crc >> 4) ^ (RADIOLIB_NONVOLATILE_READ_BYTE(&AX25CrcTable[i][0]) | (uint16_t)RADIOLIB_NONVOLATILE_READ_BYTE(&AX25CrcTable[i][1]) << 8);
+  i = crc & 0x0F;
+  crc = (crc >> 4) ^ (RADIOLIB_NONVOLATILE_READ_BYTE(&AX25CrcTable[i][0]) | (uint16_t)RADIOLIB_NONVOLATILE_READ_BYTE(&AX25CrcTable[i][1]) << 8);
+  return(crc);
 }
 
-/*
-  CCITT CRC implementation based on https://github.com/kicksat/ax25
-
-  Licensed under Creative Commons Attribution-ShareAlike 4.0 International
-  https://creativecommons.org/licenses/by-sa/4.0/
-*/
-uint16_t AX25Client::getFrameCheckSequence(uint8_t* buff, size_t len) {
-  uint8_t outBit;
-  uint16_t mask;
-  uint16_t shiftReg = CRC_CCITT_INIT;
+#if !defined(RADIOLIB_EXCLUDE_AX25_LINK)
+void AX25Client::setAddress(uint8_t* buff, const char* callsign, uint8_t ssid) {
+  // address bytes are shifted by one bit, callsign is padded by spaces
+  memset(buff, ' ' << 1, RADIOLIB_AX25_MAX_CALLSIGN_LEN);
+  for(size_t i = 0; i < strlen(callsign); i++) {
+    buff[i] = callsign[i] << 1;
+  }
+  buff[RADIOLIB_AX25_MAX_CALLSIGN_LEN] = RADIOLIB_AX25_SSID_RESERVED_BITS | (ssid & 0x0F) << 1;
+}
+#endif
 
-  for(size_t i = 0; i < len; i++) {
-    for(uint8_t b = 0x80; b > 0x00; b /= 2) {
-      outBit = (shiftReg & 0x01) ? 0x01 : 0x00;
-      shiftReg >>= 1;
-      mask = XOR((buff[i] & b), outBit) ? CRC_CCITT_POLY_REVERSED : 0x0000;
-      shiftReg ^= mask;
+uint8_t AX25Client::parseAddress(uint8_t* buff, char* callsign) {
+  // address bytes are shifted by one bit, callsign is padded by spaces
+  uint8_t len = 0;
+  for(uint8_t i = 0; i < RADIOLIB_AX25_MAX_CALLSIGN_LEN; i++) {
+    callsign[i] = (char)(buff[i] >> 1);
+    if(callsign[i] != ' ') {
+      len = i + 1;
     }
   }
-
-  return(Module::flipBits16(~shiftReg));
+  callsign[len] = '\0';
+  return((buff[RADIOLIB_AX25_MAX_CALLSIGN_LEN] >> 1) & 0x0F);
 }
 
 #endif
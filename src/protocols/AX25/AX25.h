@@ -80,6 +80,88 @@
 // tone duration in us (for 1200 baud AFSK)
 #define RADIOLIB_AX25_AFSK_TONE_DURATION                        833
 
+// number of received frames that can be kept before they are read
+// the pool is only allocated by startReceive, unless RADIOLIB_STATIC_ONLY is defined
+#if !defined(RADIOLIB_AX25_RX_POOL_SIZE)
+  #define RADIOLIB_AX25_RX_POOL_SIZE                            2
+#endif
+
+// maximum received frame length in bytes (addresses with 8 repeaters, control, PID, 256-byte info and FCS)
+#if !defined(RADIOLIB_AX25_RX_MAX_LENGTH)
+  #define RADIOLIB_AX25_RX_MAX_LENGTH                           332
+#endif
+
+// maximum length of address, control and PID fields in bytes (addresses with 8 repeaters)
+#define RADIOLIB_AX25_MAX_HEADER_LEN                            ((2 + 8)*(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1) + 2)
+
+// minimum received frame length in bytes (two addresses, control and FCS)
+#define RADIOLIB_AX25_RX_MIN_LENGTH                             17
+
+// CRC-CCITT remainder of a frame received together with its FCS
+#define RADIOLIB_AX25_FCS_GOOD                                  0xF0B8
+
+// connected mode link states
+#define RADIOLIB_AX25_LINK_DISCONNECTED                         0
+#define RADIOLIB_AX25_LINK_AWAITING_CONNECTION                  1
+#define RADIOLIB_AX25_LINK_AWAITING_RELEASE                     2
+#define RADIOLIB_AX25_LINK_CONNECTED                            3
+#define RADIOLIB_AX25_LINK_TIMER_RECOVERY                       4
+
+// number of sent information frames that can be kept until acknowledged, limits the window size
+// the pool is only allocated once a link is established, unless RADIOLIB_STATIC_ONLY is defined
+#if !defined(RADIOLIB_AX25_LINK_POOL_SIZE)
+  #define RADIOLIB_AX25_LINK_POOL_SIZE                          4
+#endif
+
+// maximum information field length of connected mode frames in bytes (N1)
+#if !defined(RADIOLIB_AX25_LINK_MAX_INFO)
+  #define RADIOLIB_AX25_LINK_MAX_INFO                           128
+#endif
+
+// maximum window size (k), 7 frames for compatibility with modulo 8 stations
+#define RADIOLIB_AX25_LINK_MAX_WINDOW                           7
+
+// number of retries before the link is considered lost (N2)
+#define RADIOLIB_AX25_LINK_MAX_RETRIES                          10
+
+// acknowledgement timer (T1) in ms, initial value is used until the first round trip is measured
+#define RADIOLIB_AX25_LINK_T1_INITIAL                           3000
+#define RADIOLIB_AX25_LINK_T1_MIN                               500
+#define RADIOLIB_AX25_LINK_T1_MAX                               30000
+
+// inactive link timer (T3) in ms
+#define RADIOLIB_AX25_LINK_T3_DEFAULT                           180000
+
+// CRC-CCITT in reversed bit order for one nibble, split into low and high byte
+static const uint8_t AX25CrcTable[16][2] RADIOLIB_NONVOLATILE = {
+  {0x00, 0x00}, {0x81, 0x10}, {0x02, 0x21}, {0x83, 0x31},
+  {0x04, 0x42}, {0x85, 0x52}, {0x06, 0x63}, {0x87, 0x73},
+  {0x08, 0x84}, {0x89, 0x94}, {0x0A, 0xA5}, {0x8B, 0xB5},
+  {0x0C, 0xC6}, {0x8D, 0xD6}, {0x0E, 0xE7}, {0x8F, 0xF7}
+};
+
+// bit stuffing lookup, bytes are sent least significant bit first
+// bits 2 - 0: number of 1s at the start of the byte, bits 5 - 3: number of 1s at the end of the byte
+// 0xFF: byte contains 5 or more consecutive 1s and always has to be stuffed bit by bit
+static const uint8_t AX25StuffTable[256] RADIOLIB_NONVOLATILE = {
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFF,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0xFF, 0xFF,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFF,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x0B, 0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x0C,
+  0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x0B, 0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0x08, 0xFF,
+  0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x0B, 0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x0C,
+  0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x0B, 0x08, 0x09, 0x08, 0x0A, 0x08, 0x09, 0xFF, 0xFF,
+  0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x14,
+  0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0xFF,
+  0x18, 0x19, 0x18, 0x1A, 0x18, 0x19, 0x18, 0x1B, 0x18, 0x19, 0x18, 0x1A, 0x18, 0x19, 0x18, 0x1C,
+  0x20, 0x21, 0x20, 0x22, 0x20, 0x21, 0x20, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
 /*!
   \class AX25Frame
 
@@ -307,6 +389,11 @@ class AX25Client {
     int16_t setCorrection(int16_t mark, int16_t space, float length = 1.0f);
     #endif
 
+    /*!
+      \brief Default destructor.
+    */
+    ~AX25Client();
+
     // basic methods
 
     /*!
@@ -349,7 +436,8 @@ class AX25Client {
     int16_t transmit(const char* str, const char* destCallsign, uint8_t destSSID = 0x00);
 
     /*!
-      \brief Transmit arbitrary AX.25 frame.
+      \brief Transmit arbitrary AX.25 frame. When the module has HDLC framing engine (e.g. AX5043),
+      the frame is passed to it unstuffed and without FCS, otherwise it is encoded in software.
 
       \param frame Frame to be sent.
 
@@ -357,6 +445,191 @@ class AX25Client {
     */
     int16_t sendFrame(AX25Frame* frame);
 
+    #if !defined(RADIOLIB_EXCLUDE_DIRECT_RECEIVE)
+    /*!
+      \brief Start receiving AX.25 frames using the module's direct mode. Bits are decoded as they arrive from the data pin,
+      complete frames are kept in a preallocated pool until read by readFrame. The module must be configured for 2-FSK reception
+      with the correct bit rate beforehand.
+
+      \param pin Pin to receive the data on. When set to RADIOLIB_NC, only the decoder is prepared and bits have to be passed to it by decodeBit or decodeByte.
+
+      \param scrambled Set to true to descramble G3RUH-scrambled input (9600 baud GFSK). Defaults to false.
+
+      \returns \ref status_codes
+    */
+    int16_t startReceive(RADIOLIB_PIN_TYPE pin = RADIOLIB_NC, bool scrambled = false);
+
+    /*!
+      \brief Get the number of received frames waiting in the pool.
+
+      \returns Number of frames that can be read.
+    */
+    size_t available();
+
+    /*!
+      \brief Read the oldest received frame from the pool and release its slot.
+
+      \param frame Frame to save the received addresses, control, PID and info field to.
+
+      \returns \ref status_codes
+    */
+    int16_t readFrame(AX25Frame* frame);
+
+    /*!
+      \brief Get the number of valid frames that were dropped because the pool was full.
+
+      \returns Number of dropped frames.
+    */
+    uint16_t getDropped();
+
+    /*!
+      \brief Feed a single received bit into the decoder. Called automatically after startReceive,
+      but can also be used to decode bits from other sources.
+
+      \param bit Received bit, as sent over the air (NRZI-encoded and optionally scrambled).
+    */
+    void decodeBit(uint8_t bit);
+
+    /*!
+      \brief Feed 8 received bits into the decoder, most significant bit first.
+
+      \param b Received bits, as sent over the air (NRZI-encoded and optionally scrambled).
+    */
+    void decodeByte(uint8_t b);
+    #endif
+
+    /*!
+      \brief Parse raw AX.25 frame without flags and FCS (e.g. as received by modules with HDLC framing engine).
+
+      \param data Frame contents, starting with the destination address.
+
+      \param len Number of bytes in the frame.
+
+      \param frame Frame to save the addresses, control, PID and info field to.
+
+      \returns \ref status_codes
+    */
+    static int16_t parseFrame(uint8_t* data, size_t len, AX25Frame* frame);
+
+    #if !defined(RADIOLIB_EXCLUDE_AX25_LINK)
+    // connected mode methods
+
+    /*!
+      \brief Establish connected mode link by sending SABM (or SABME) frame. The method returns immediately,
+      link state should be checked by getLinkState while calling update.
+      Lost information frames are recovered by REJ and retransmission timeout. Received SREJ frames are honoured,
+      but SREJ is never sent, as out of sequence frames are not kept. Can be excluded by RADIOLIB_EXCLUDE_AX25_LINK.
+
+      \param destCallsign Callsign of the remote station.
+
+      \param destSSID 4-bit SSID of the remote station. Defaults to 0.
+
+      \param extended Set to true to use modulo 128 sequence numbers (SABME), supported by AX.25 2.2 stations only. Defaults to false.
+
+      \returns \ref status_codes
+    */
+    int16_t connect(const char* destCallsign, uint8_t destSSID = 0x00, bool extended = false);
+
+    /*!
+      \brief Release connected mode link by sending DISC frame. Frames that were not acknowledged yet are discarded.
+
+      \returns \ref status_codes
+    */
+    int16_t disconnect();
+
+    /*!
+      \brief Queue data to be sent in information frame over connected mode link. The data is copied into retransmission pool
+      and kept until acknowledged by the remote station.
+
+      \param data Data to be sent.
+
+      \param len Number of bytes to send, up to RADIOLIB_AX25_LINK_MAX_INFO.
+
+      \returns \ref status_codes
+    */
+    int16_t sendData(uint8_t* data, size_t len);
+
+    /*!
+      \brief Run connected mode link. Processes received frames, sends queued information frames and acknowledgements,
+      and handles timeouts. Must be called periodically. When the receive pool is used, all frames in it are consumed by the link.
+
+      \returns \ref status_codes
+    */
+    int16_t update();
+
+    /*!
+      \brief Pass received frame to connected mode link, e.g. when received by module with HDLC framing engine.
+      Frames that do not belong to the link are ignored.
+
+      \param data Frame contents without FCS, starting with the destination address.
+
+      \param len Number of bytes in the frame.
+
+      \returns \ref status_codes
+    */
+    int16_t processFrame(uint8_t* data, size_t len);
+
+    /*!
+      \brief Set the window size, i.e. the number of information frames that can be sent before waiting for acknowledgement.
+
+      \param k Window size, 1 to RADIOLIB_AX25_LINK_MAX_WINDOW. Cannot be larger than RADIOLIB_AX25_LINK_POOL_SIZE.
+
+      \returns \ref status_codes
+    */
+    int16_t setWindow(uint8_t k);
+
+    /*!
+      \brief Set inactive link timer (T3). When nothing is received for this long, the link is polled.
+
+      \param timeout Timeout in ms.
+    */
+    void setIdleTimeout(uint32_t timeout);
+
+    /*!
+      \brief Set function to be called when information is received over connected mode link.
+
+      \param func Function to be called with received data and its length.
+    */
+    void setLinkDataAction(void (*func)(uint8_t*, size_t));
+
+    /*!
+      \brief Set own receiver busy condition. The remote station is told to stop sending by RNR frames until cleared.
+
+      \param busy Set to true when no more data can be received.
+    */
+    void setBusy(bool busy);
+
+    /*!
+      \brief Get the current state of connected mode link.
+
+      \returns Link state, one of RADIOLIB_AX25_LINK_* values.
+    */
+    uint8_t getLinkState();
+
+    /*!
+      \brief Get the callsign of the remote station, e.g. after an incoming connection was accepted.
+
+      \param callsign Buffer to save the callsign to, must be at least RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1 bytes long.
+
+      \returns SSID of the remote station.
+    */
+    uint8_t getLinkPeer(char* callsign);
+
+    /*!
+      \brief Get the number of information frames waiting for transmission or acknowledgement.
+
+      \returns Number of frames in the retransmission pool.
+    */
+    size_t getQueued();
+
+    /*!
+      \brief Get smoothed round trip time of the link, used to set acknowledgement timer (T1).
+
+      \returns Round trip time in ms, 0 if not measured yet.
+    */
+    uint32_t getRoundTripTime();
+    #endif
+
 #if !defined(RADIOLIB_GODMODE)
   private:
 #endif
@@ -374,7 +647,127 @@ class AX25Client {
     uint8_t _srcSSID = 0;
     uint16_t _preambleLen = 0;
 
+    // cleared once the physical layer reports it has no HDLC framing engine
+    bool _phyHdlc = true;
+
+    #if !defined(RADIOLIB_EXCLUDE_DIRECT_RECEIVE)
+    // decoder state
+    bool _rxScrambled = false;
+    uint32_t _rxScrambler = 0;
+    uint8_t _rxLevel = 0;
+    uint8_t _rxOnes = 0;
+    uint8_t _rxBits = 0;
+    uint8_t _rxByte = 0;
+    bool _rxHunting = true;
+    bool _rxStore = false;
+    uint16_t _rxLen = 0;
+    uint16_t _rxCrc = CRC_CCITT_INIT;
+
+    // frame pool, each slot is owned by the decoder until it is marked as full, and by readFrame afterwards
+    #if !defined(RADIOLIB_STATIC_ONLY)
+      uint8_t* _rxPool = NULL;
+    #else
+      uint8_t _rxPool[RADIOLIB_AX25_RX_POOL_SIZE*RADIOLIB_AX25_RX_MAX_LENGTH];
+    #endif
+    uint16_t _rxFrameLen[RADIOLIB_AX25_RX_POOL_SIZE];
+    volatile bool _rxFull[RADIOLIB_AX25_RX_POOL_SIZE] = {};
+    uint8_t _rxHead = 0;
+    uint8_t _rxTail = 0;
+    uint16_t _rxDropped = 0;
+
+    void decodeFlag();
+    #endif
+
+    // encoder state
+    uint16_t _encBuff = 0;
+    uint8_t _encBits = 0;
+    uint8_t _encOnes = 0;
+    uint8_t _encLevel = 0;
+
+    // frame being encoded, the encoder produces at most 2 bytes per input byte
+    uint8_t* _encHeader = NULL;
+    uint8_t _encHeaderLen = 0;
+    uint8_t* _encInfo = NULL;
+    size_t _encInfoLen = 0;
+    size_t _encPos = 0;
+    uint16_t _encCrc = CRC_CCITT_INIT;
+    uint8_t _encPending[2] = {0, 0};
+    uint8_t _encPendingLen = 0;
+    uint8_t _encPendingPos = 0;
+    bool _encDone = false;
+
+    size_t buildHeader(AX25Frame* frame, uint8_t* buff);
+    int16_t transmitEncoded(uint8_t* header, size_t headerLen, uint8_t* info, size_t infoLen);
+    size_t encodeStart(uint8_t* header, size_t headerLen, uint8_t* info, size_t infoLen);
+    size_t encodeNext(uint8_t* out);
+    size_t encodeChunk(uint8_t* buff, size_t len);
+    static size_t encodeStream(void* ctx, uint8_t* buff, size_t len);
+    void encodeReset();
+    size_t encodeByte(uint8_t b, bool stuff, uint8_t* out);
+    size_t encodeFlush(uint8_t* out);
+    size_t encodeOutput(uint8_t* out);
+
+    #if !defined(RADIOLIB_EXCLUDE_AX25_LINK)
+    // connected mode link state
+    uint8_t _linkState = RADIOLIB_AX25_LINK_DISCONNECTED;
+    uint8_t _linkAddr[2*(RADIOLIB_AX25_MAX_CALLSIGN_LEN + 1)] = {};
+    uint8_t _linkMask = 0x07;
+    uint8_t _linkWindow = (RADIOLIB_AX25_LINK_POOL_SIZE < RADIOLIB_AX25_LINK_MAX_WINDOW) ? RADIOLIB_AX25_LINK_POOL_SIZE : RADIOLIB_AX25_LINK_MAX_WINDOW;
+    uint8_t _linkVs = 0;
+    uint8_t _linkVa = 0;
+    uint8_t _linkVr = 0;
+    uint8_t _linkRetries = 0;
+    bool _linkPeerBusy = false;
+    bool _linkOwnBusy = false;
+    bool _linkRejectSent = false;
+    bool _linkAckPending = false;
+    void (*_linkDataAction)(uint8_t*, size_t) = NULL;
+
+    // timers, T1 is derived from round trip time estimate
+    uint32_t _linkT1Start = 0;
+    uint32_t _linkT3Start = 0;
+    uint32_t _linkT3 = RADIOLIB_AX25_LINK_T3_DEFAULT;
+    bool _linkT1Running = false;
+    bool _linkT3Running = false;
+    int32_t _linkSrtt = 0;
+    int32_t _linkRttVar = 0;
+    uint32_t _linkRto = RADIOLIB_AX25_LINK_T1_INITIAL;
+    uint32_t _linkT1 = RADIOLIB_AX25_LINK_T1_INITIAL;
+    uint32_t _linkRttStart = 0;
+    uint8_t _linkRttSeq = 0;
+    bool _linkRttTiming = false;
+
+    // retransmission pool, the first slot holds the oldest unacknowledged frame
+    #if !defined(RADIOLIB_STATIC_ONLY)
+      uint8_t* _linkPool = NULL;
+    #else
+      uint8_t _linkPool[RADIOLIB_AX25_LINK_POOL_SIZE*RADIOLIB_AX25_LINK_MAX_INFO];
+    #endif
+    uint16_t _linkPoolLen[RADIOLIB_AX25_LINK_POOL_SIZE];
+    uint8_t _linkPoolHead = 0;
+    uint8_t _linkQueued = 0;
+    uint8_t _linkSent = 0;
+
+    void linkSetPeer(uint8_t* addr);
+    void linkReset();
+    int16_t linkSend(uint8_t type, bool command, bool pollFinal, uint8_t seq);
+    int16_t linkSendSupervisory(bool command, bool pollFinal);
+    int16_t linkPump();
+    bool linkAcknowledge(uint8_t nr);
+    void linkRetransmit(uint8_t from);
+    void linkRoundTrip(uint32_t rtt);
+    void linkTimeout();
+    void linkStartT1();
+    int16_t linkEstablish();
+    uint8_t linkSlot(uint8_t seq);
+    #endif
+
     static uint16_t getFrameCheckSequence(uint8_t* buff, size_t len);
+    static uint16_t updateFrameCheckSequence(uint16_t crc, uint8_t b);
+    static uint8_t parseAddress(uint8_t* buff, char* callsign);
+    #if !defined(RADIOLIB_EXCLUDE_AX25_LINK)
+    static void setAddress(uint8_t* buff, const char* callsign, uint8_t ssid);
+    #endif
 
     void getCallsign(char* buff);
     uint8_t getSSID();
@@ -0,0 +1,359 @@
+#include "BLE.h"
+#if !defined(RADIOLIB_EXCLUDE_BLE) && !defined(RADIOLIB_EXCLUDE_SX128X)
+
+BLEAdvClient::BLEAdvClient(SX128x* radio) {
+  _radio = radio;
+}
+
+int16_t BLEAdvClient::begin(int8_t power) {
+  // initialize radio for advertising channel PHY - 1 Mbps, modulation index 0.5, BT 0.5
+  int16_t state = _radio->beginBLE(RADIOLIB_BLE_ADV_CHANNEL_37_FREQ, RADIOLIB_BLE_ADV_BIT_RATE, RADIOLIB_BLE_ADV_FREQ_DEV, power, RADIOLIB_SHAPING_0_5);
+  RADIOLIB_ASSERT(state);
+
+  // advertising PDU payload can be up to 37 bytes (AdvA + 31 bytes of data)
+  _radio->_connectionState = RADIOLIB_SX128X_BLE_PAYLOAD_LENGTH_MAX_37;
+
+  // set advertising access address
+  state = _radio->setAccessAddress(RADIOLIB_BLE_ADV_ACCESS_ADDRESS);
+  RADIOLIB_ASSERT(state);
+
+  // enable hardware CRC with advertising channel initial value, this also updates packet parameters
+  state = _radio->setCRC(3, RADIOLIB_BLE_ADV_CRC_INIT);
+  RADIOLIB_ASSERT(state);
+
+  // reset PDU to non-connectable advertising with empty data
+  memset(_pdu, 0x00, sizeof(_pdu));
+  _pdu[0] = RADIOLIB_BLE_PDU_TYPE_ADV_NONCONN_IND | RADIOLIB_BLE_PDU_TX_ADD_RANDOM;
+  clearData();
+
+  // reset scanner
+  _scanning = false;
+  _queueHead = 0;
+  _queueCount = 0;
+  _dropped = 0;
+  return(state);
+}
+
+int16_t BLEAdvClient::setAddress(uint8_t* addr, bool random, uint8_t pduType) {
+  if(addr == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // only undirected advertising PDUs carry AD structures
+  if(!((pduType == RADIOLIB_BLE_PDU_TYPE_ADV_IND) || (pduType == RADIOLIB_BLE_PDU_TYPE_ADV_NONCONN_IND) || (pduType == RADIOLIB_BLE_PDU_TYPE_ADV_SCAN_IND))) {
+    return(RADIOLIB_ERR_BLE_INVALID_PDU);
+  }
+
+  _pdu[0] = pduType;
+  if(random) {
+    _pdu[0] |= RADIOLIB_BLE_PDU_TX_ADD_RANDOM;
+  }
+
+  // AdvA is sent least significant byte first
+  for(uint8_t i = 0; i < RADIOLIB_BLE_ADV_ADDR_LEN; i++) {
+    _pdu[RADIOLIB_BLE_PDU_HEADER_LEN + i] = addr[RADIOLIB_BLE_ADV_ADDR_LEN - 1 - i];
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+void BLEAdvClient::clearData() {
+  _dataLen = 0;
+  _pdu[1] = RADIOLIB_BLE_ADV_ADDR_LEN;
+}
+
+int16_t BLEAdvClient::addData(uint8_t type, uint8_t* data, uint8_t len) {
+  if((data == NULL) && (len > 0)) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // AD structure consists of length, type and data
+  if((uint16_t)_dataLen + 2 + len > RADIOLIB_BLE_ADV_DATA_MAX_LEN) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  uint8_t* ptr = &_pdu[RADIOLIB_BLE_PDU_HEADER_LEN + RADIOLIB_BLE_ADV_ADDR_LEN + _dataLen];
+  *(ptr++) = len + 1;
+  *(ptr++) = type;
+  if(len > 0) {
+    memcpy(ptr, data, len);
+  }
+  _dataLen += 2 + len;
+  _pdu[1] = RADIOLIB_BLE_ADV_ADDR_LEN + _dataLen;
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t BLEAdvClient::addFlags(uint8_t flags) {
+  return(addData(RADIOLIB_BLE_AD_TYPE_FLAGS, &flags, 1));
+}
+
+int16_t BLEAdvClient::addName(const char* name) {
+  if(name == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  size_t len = strlen(name);
+  if(len > RADIOLIB_BLE_ADV_DATA_MAX_LEN) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+  return(addData(RADIOLIB_BLE_AD_TYPE_NAME_COMPLETE, (uint8_t*)name, len));
+}
+
+int16_t BLEAdvClient::addManufacturerData(uint16_t companyId, uint8_t* data, uint8_t len) {
+  if(len > RADIOLIB_BLE_ADV_DATA_MAX_LEN - 4) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+  if((data == NULL) && (len > 0)) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // company identifier is sent least significant byte first
+  uint8_t buff[RADIOLIB_BLE_ADV_DATA_MAX_LEN];
+  buff[0] = (uint8_t)(companyId & 0xFF);
+  buff[1] = (uint8_t)((companyId >> 8) & 0xFF);
+  if(len > 0) {
+    memcpy(&buff[2], data, len);
+  }
+  return(addData(RADIOLIB_BLE_AD_TYPE_MANUFACTURER_DATA, buff, len + 2));
+}
+
+int16_t BLEAdvClient::advertise(uint8_t channelMap) {
+  // check active modem
+  if(_radio->getPacketType() != RADIOLIB_SX128X_PACKET_TYPE_BLE) {
+    return(RADIOLIB_ERR_WRONG_MODEM);
+  }
+
+  // pause scanning for the duration of the event
+  bool scanning = _scanning;
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+
+  // packet parameters, output power and buffer contents are the same on all channels, so they are only set once per event
+  state = _radio->setPacketParamsBLE(_radio->_connectionState, _radio->_crcBLE, _radio->_bleTestPayload, _radio->_whitening);
+  RADIOLIB_ASSERT(state);
+  state = _radio->setTxParams(_radio->_pwr);
+  RADIOLIB_ASSERT(state);
+  state = _radio->setBufferBaseAddress();
+  RADIOLIB_ASSERT(state);
+  state = _radio->writeBuffer(_pdu, RADIOLIB_BLE_PDU_HEADER_LEN + _pdu[1]);
+  RADIOLIB_ASSERT(state);
+  state = _radio->setDioIrqParams(RADIOLIB_SX128X_IRQ_TX_DONE | RADIOLIB_SX128X_IRQ_RX_TX_TIMEOUT, RADIOLIB_SX128X_IRQ_TX_DONE);
+  RADIOLIB_ASSERT(state);
+
+  // send the PDU on all enabled advertising channels back-to-back
+  for(uint8_t i = 0; i < 3; i++) {
+    if(!(channelMap & (1 << i))) {
+      continue;
+    }
+
+    state = setChannel(RADIOLIB_BLE_ADV_CHANNEL_37 + i);
+    RADIOLIB_ASSERT(state);
+
+    state = transmitPdu();
+    RADIOLIB_ASSERT(state);
+  }
+
+  // resume scanning
+  if(scanning) {
+    return(restartScan());
+  }
+  return(state);
+}
+
+int16_t BLEAdvClient::startScan(uint8_t channel, uint32_t dwell) {
+  // check active modem
+  if(_radio->getPacketType() != RADIOLIB_SX128X_PACKET_TYPE_BLE) {
+    return(RADIOLIB_ERR_WRONG_MODEM);
+  }
+
+  if((channel < RADIOLIB_BLE_ADV_CHANNEL_37) || (channel > RADIOLIB_BLE_ADV_CHANNEL_39)) {
+    return(RADIOLIB_ERR_INVALID_FREQUENCY);
+  }
+
+  _scanChannel = channel;
+  _scanDwell = dwell;
+  _scanning = true;
+  return(restartScan());
+}
+
+int16_t BLEAdvClient::stopScan() {
+  _scanning = false;
+  _radio->clearIrqStatus();
+  return(_radio->standby());
+}
+
+int16_t BLEAdvClient::update() {
+  if(!_scanning) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // process received packet
+  int16_t state = RADIOLIB_ERR_NONE;
+  if(_radio->_mod->digitalRead(_radio->_mod->getIrq())) {
+    state = receivePdu();
+  }
+
+  // hop to the next advertising channel
+  if((_scanDwell > 0) && (_radio->_mod->millis() - _scanStart >= _scanDwell)) {
+    _scanChannel++;
+    if(_scanChannel > RADIOLIB_BLE_ADV_CHANNEL_39) {
+      _scanChannel = RADIOLIB_BLE_ADV_CHANNEL_37;
+    }
+    int16_t hopState = restartScan();
+    RADIOLIB_ASSERT(hopState);
+  }
+
+  return(state);
+}
+
+uint8_t BLEAdvClient::available() {
+  return(_queueCount);
+}
+
+int16_t BLEAdvClient::read(BLEAdvRecord_t* record) {
+  if(record == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(_queueCount == 0) {
+    return(RADIOLIB_ERR_BLE_QUEUE_EMPTY);
+  }
+
+  memcpy(record, &_queue[_queueHead], sizeof(BLEAdvRecord_t));
+  _queueHead = (_queueHead + 1) % RADIOLIB_BLE_QUEUE_SIZE;
+  _queueCount--;
+  return(RADIOLIB_ERR_NONE);
+}
+
+uint16_t BLEAdvClient::getDropped() {
+  return(_dropped);
+}
+
+uint8_t* BLEAdvClient::findData(BLEAdvRecord_t* record, uint8_t type, uint8_t* len) {
+  if((record == NULL) || (len == NULL)) {
+    return(NULL);
+  }
+
+  // walk through AD structures, stop at zero-length padding or malformed structure
+  uint8_t i = 0;
+  while(i < record->dataLen) {
+    uint8_t adLen = record->data[i];
+    if((adLen == 0) || (i + 1 + adLen > record->dataLen)) {
+      break;
+    }
+    if(record->data[i + 1] == type) {
+      *len = adLen - 1;
+      return(&record->data[i + 2]);
+    }
+    i += adLen + 1;
+  }
+  return(NULL);
+}
+
+int16_t BLEAdvClient::setChannel(uint8_t channel) {
+  float freq = RADIOLIB_BLE_ADV_CHANNEL_37_FREQ;
+  if(channel == RADIOLIB_BLE_ADV_CHANNEL_38) {
+    freq = RADIOLIB_BLE_ADV_CHANNEL_38_FREQ;
+  } else if(channel == RADIOLIB_BLE_ADV_CHANNEL_39) {
+    freq = RADIOLIB_BLE_ADV_CHANNEL_39_FREQ;
+  }
+
+  int16_t state = _radio->setFrequency(freq);
+  RADIOLIB_ASSERT(state);
+
+  // whitening is seeded by the channel index
+  uint8_t seed = RADIOLIB_BLE_WHITENING_SEED_BASE | channel;
+  return(_radio->writeRegister(RADIOLIB_SX128X_REG_WHITENING_INITIAL_VALUE, &seed, 1));
+}
+
+int16_t BLEAdvClient::transmitPdu() {
+  // clear interrupt flags
+  int16_t state = _radio->clearIrqStatus();
+  RADIOLIB_ASSERT(state);
+
+  // set RF switch (if present)
+  _radio->_mod->setRfSwitchState(LOW, HIGH);
+
+  // start transmission
+  state = _radio->setTx(RADIOLIB_SX128X_TX_TIMEOUT_NONE);
+  RADIOLIB_ASSERT(state);
+
+  // wait for packet transmission or timeout
+  uint32_t start = _radio->_mod->micros();
+  while(!_radio->_mod->digitalRead(_radio->_mod->getIrq())) {
+    _radio->_mod->yield();
+    if(_radio->_mod->micros() - start > RADIOLIB_BLE_ADV_TX_TIMEOUT) {
+      _radio->finishTransmit();
+      return(RADIOLIB_ERR_TX_TIMEOUT);
+    }
+  }
+
+  // radio falls back to standby on its own, just clear the flags
+  return(_radio->clearIrqStatus());
+}
+
+int16_t BLEAdvClient::receivePdu() {
+  uint16_t irq = _radio->getIrqStatus();
+  if(!(irq & RADIOLIB_SX128X_IRQ_RX_DONE)) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // drop packets with invalid CRC
+  if(irq & RADIOLIB_SX128X_IRQ_CRC_ERROR) {
+    _radio->clearIrqStatus();
+    return(RADIOLIB_ERR_CRC_MISMATCH);
+  }
+
+  // get start of the packet in buffer
+  uint8_t rxBufStatus[2] = {0, 0};
+  int16_t state = _radio->SPIreadCommand(RADIOLIB_SX128X_CMD_GET_RX_BUFFER_STATUS, rxBufStatus, 2);
+  RADIOLIB_ASSERT(state);
+  uint8_t offset = rxBufStatus[1];
+
+  // read header first to get the actual payload length
+  uint8_t header[RADIOLIB_BLE_PDU_HEADER_LEN];
+  state = _radio->readBuffer(header, RADIOLIB_BLE_PDU_HEADER_LEN, offset);
+  RADIOLIB_ASSERT(state);
+  uint8_t len = header[1] & RADIOLIB_BLE_PDU_LENGTH_MASK;
+  if((len < RADIOLIB_BLE_ADV_ADDR_LEN) || (len > RADIOLIB_BLE_ADV_PAYLOAD_MAX_LEN)) {
+    _radio->clearIrqStatus();
+    return(RADIOLIB_ERR_BLE_INVALID_PDU);
+  }
+
+  uint8_t payload[RADIOLIB_BLE_ADV_PAYLOAD_MAX_LEN];
+  state = _radio->readBuffer(payload, len, offset + RADIOLIB_BLE_PDU_HEADER_LEN);
+  RADIOLIB_ASSERT(state);
+
+  // drop the packet if there is no space left
+  if(_queueCount >= RADIOLIB_BLE_QUEUE_SIZE) {
+    _dropped++;
+    return(_radio->clearIrqStatus());
+  }
+
+  // parse into the next free record
+  BLEAdvRecord_t* rec = &_queue[(_queueHead + _queueCount) % RADIOLIB_BLE_QUEUE_SIZE];
+  rec->pduType = header[0] & RADIOLIB_BLE_PDU_TYPE_MASK;
+  rec->randomAddr = header[0] & RADIOLIB_BLE_PDU_TX_ADD_RANDOM;
+  for(uint8_t i = 0; i < RADIOLIB_BLE_ADV_ADDR_LEN; i++) {
+    rec->addr[i] = payload[RADIOLIB_BLE_ADV_ADDR_LEN - 1 - i];
+  }
+  rec->dataLen = len - RADIOLIB_BLE_ADV_ADDR_LEN;
+  memcpy(rec->data, &payload[RADIOLIB_BLE_ADV_ADDR_LEN], rec->dataLen);
+  rec->rssi = _radio->getRSSI();
+  rec->channel = _scanChannel;
+  rec->timestamp = _radio->_mod->millis();
+  _queueCount++;
+
+  // radio stays in continuous receive mode, only clear the flags
+  return(_radio->clearIrqStatus());
+}
+
+int16_t BLEAdvClient::restartScan() {
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+
+  state = setChannel(_scanChannel);
+  RADIOLIB_ASSERT(state);
+
+  _scanStart = _radio->_mod->millis();
+  return(_radio->startReceive(RADIOLIB_SX128X_RX_TIMEOUT_INF));
+}
+
+#endif
@@ -0,0 +1,305 @@
+#if !defined(_RADIOLIB_BLE_H)
+#define _RADIOLIB_BLE_H
+
+#include "../../TypeDef.h"
+
+#if !defined(RADIOLIB_EXCLUDE_BLE) && !defined(RADIOLIB_EXCLUDE_SX128X)
+
+#include "../../modules/SX128x/SX128x.h"
+
+// number of received advertising records buffered by the scanner
+#if !defined(RADIOLIB_BLE_QUEUE_SIZE)
+  #define RADIOLIB_BLE_QUEUE_SIZE                               (4)
+#endif
+
+// advertising channel physical layer constants
+#define RADIOLIB_BLE_ADV_ACCESS_ADDRESS                         (0x8E89BED6UL)
+#define RADIOLIB_BLE_ADV_CRC_INIT                               (0x555555UL)
+#define RADIOLIB_BLE_ADV_BIT_RATE                               (1000)
+#define RADIOLIB_BLE_ADV_FREQ_DEV                               (250.0)
+#define RADIOLIB_BLE_ADV_CHANNEL_37                             (37)
+#define RADIOLIB_BLE_ADV_CHANNEL_38                             (38)
+#define RADIOLIB_BLE_ADV_CHANNEL_39                             (39)
+#define RADIOLIB_BLE_ADV_CHANNEL_37_FREQ                        (2402.0)
+#define RADIOLIB_BLE_ADV_CHANNEL_38_FREQ                        (2426.0)
+#define RADIOLIB_BLE_ADV_CHANNEL_39_FREQ                        (2480.0)
+
+// whitening seed - position 0 of the LFSR is always set, channel index fills the rest
+#define RADIOLIB_BLE_WHITENING_SEED_BASE                        (0x40)
+
+// advertising PDU layout
+#define RADIOLIB_BLE_PDU_HEADER_LEN                             (2)
+#define RADIOLIB_BLE_ADV_ADDR_LEN                               (6)
+#define RADIOLIB_BLE_ADV_DATA_MAX_LEN                           (31)
+#define RADIOLIB_BLE_ADV_PAYLOAD_MAX_LEN                        (RADIOLIB_BLE_ADV_ADDR_LEN + RADIOLIB_BLE_ADV_DATA_MAX_LEN)
+
+// maximum time to wait for a single advertising packet to be sent, in us
+#define RADIOLIB_BLE_ADV_TX_TIMEOUT                             (5000)
+
+// PDU header                                                            MSB   LSB   DESCRIPTION
+#define RADIOLIB_BLE_PDU_TYPE_ADV_IND                           (0x00)  //  3     0   PDU type: connectable undirected advertising
+#define RADIOLIB_BLE_PDU_TYPE_ADV_DIRECT_IND                    (0x01)  //  3     0             connectable directed advertising
+#define RADIOLIB_BLE_PDU_TYPE_ADV_NONCONN_IND                   (0x02)  //  3     0             non-connectable undirected advertising
+#define RADIOLIB_BLE_PDU_TYPE_SCAN_REQ                          (0x03)  //  3     0             scan request
+#define RADIOLIB_BLE_PDU_TYPE_SCAN_RSP                          (0x04)  //  3     0             scan response
+#define RADIOLIB_BLE_PDU_TYPE_CONNECT_IND                       (0x05)  //  3     0             connection request
+#define RADIOLIB_BLE_PDU_TYPE_ADV_SCAN_IND                      (0x06)  //  3     0             scannable undirected advertising
+#define RADIOLIB_BLE_PDU_TYPE_MASK                              (0x0F)  //  3     0   PDU type mask
+#define RADIOLIB_BLE_PDU_TX_ADD_RANDOM                          (0x40)  //  6     6   advertiser address is random
+#define RADIOLIB_BLE_PDU_RX_ADD_RANDOM                          (0x80)  //  7     7   target address is random
+#define RADIOLIB_BLE_PDU_LENGTH_MASK                            (0x3F)  //  5     0   payload length mask
+
+// AD structure types
+#define RADIOLIB_BLE_AD_TYPE_FLAGS                              (0x01)
+#define RADIOLIB_BLE_AD_TYPE_UUID16_INCOMPLETE                  (0x02)
+#define RADIOLIB_BLE_AD_TYPE_UUID16_COMPLETE                    (0x03)
+#define RADIOLIB_BLE_AD_TYPE_NAME_SHORT                         (0x08)
+#define RADIOLIB_BLE_AD_TYPE_NAME_COMPLETE                      (0x09)
+#define RADIOLIB_BLE_AD_TYPE_TX_POWER                           (0x0A)
+#define RADIOLIB_BLE_AD_TYPE_SERVICE_DATA_UUID16                (0x16)
+#define RADIOLIB_BLE_AD_TYPE_MANUFACTURER_DATA                  (0xFF)
+
+// AD flags
+#define RADIOLIB_BLE_AD_FLAG_LE_LIMITED_DISC                    (0x01)
+#define RADIOLIB_BLE_AD_FLAG_LE_GENERAL_DISC                    (0x02)
+#define RADIOLIB_BLE_AD_FLAG_BR_EDR_NOT_SUPPORTED               (0x04)
+
+/*!
+  \struct BLEAdvRecord_t
+
+  \brief Parsed advertising packet received by the scanner.
+*/
+struct BLEAdvRecord_t {
+  /*!
+    \brief PDU type, see RADIOLIB_BLE_PDU_TYPE_* macros.
+  */
+  uint8_t pduType;
+
+  /*!
+    \brief Whether the advertiser address is random (true) or public (false).
+  */
+  bool randomAddr;
+
+  /*!
+    \brief Advertiser address, most significant byte first (as usually printed, e.g. C0:11:22:33:44:55).
+  */
+  uint8_t addr[RADIOLIB_BLE_ADV_ADDR_LEN];
+
+  /*!
+    \brief Length of advertising data in bytes.
+  */
+  uint8_t dataLen;
+
+  /*!
+    \brief Advertising data (sequence of AD structures).
+  */
+  uint8_t data[RADIOLIB_BLE_ADV_DATA_MAX_LEN];
+
+  /*!
+    \brief RSSI of the packet in dBm.
+  */
+  float rssi;
+
+  /*!
+    \brief Advertising channel the packet was received on (37, 38 or 39).
+  */
+  uint8_t channel;
+
+  /*!
+    \brief Reception timestamp in ms.
+  */
+  uint32_t timestamp;
+};
+
+/*!
+  \class BLEAdvClient
+
+  \brief Client for Bluetooth Low Energy advertising and scanning on advertising channels 37, 38 and 39.
+  Uses %SX128x BLE packet engine with hardware CRC and whitening.
+*/
+class BLEAdvClient {
+  public:
+    /*!
+      \brief Default constructor.
+
+      \param radio Pointer to the %SX128x module that will be used.
+    */
+    explicit BLEAdvClient(SX128x* radio);
+
+    // basic methods
+
+    /*!
+      \brief Initialization method. Configures the radio in BLE mode for 1 Mbps advertising channel PHY
+      (access address 0x8E89BED6, CRC initial value 0x555555, 37-byte maximum payload).
+
+      \param power Output power in dBm. Defaults to 10 dBm.
+
+      \returns \ref status_codes
+    */
+    int16_t begin(int8_t power = 10);
+
+    /*!
+      \brief Sets advertiser address and PDU type.
+
+      \param addr Advertiser address, most significant byte first (as usually printed, e.g. C0:11:22:33:44:55).
+
+      \param random Set to true for random address, false for public address. Random static addresses must have two most significant bits set.
+
+      \param pduType Type of advertising PDU, allowed values are RADIOLIB_BLE_PDU_TYPE_ADV_IND,
+      RADIOLIB_BLE_PDU_TYPE_ADV_NONCONN_IND and RADIOLIB_BLE_PDU_TYPE_ADV_SCAN_IND. Defaults to non-connectable advertising.
+
+      \returns \ref status_codes
+    */
+    int16_t setAddress(uint8_t* addr, bool random = true, uint8_t pduType = RADIOLIB_BLE_PDU_TYPE_ADV_NONCONN_IND);
+
+    /*!
+      \brief Removes all AD structures from the advertising data.
+    */
+    void clearData();
+
+    /*!
+      \brief Appends AD structure to the advertising data.
+
+      \param type AD type, see RADIOLIB_BLE_AD_TYPE_* macros.
+
+      \param data Data of the AD structure.
+
+      \param len Length of data in bytes.
+
+      \returns \ref status_codes
+    */
+    int16_t addData(uint8_t type, uint8_t* data, uint8_t len);
+
+    /*!
+      \brief Appends flags AD structure.
+
+      \param flags Flags to advertise, see RADIOLIB_BLE_AD_FLAG_* macros.
+
+      \returns \ref status_codes
+    */
+    int16_t addFlags(uint8_t flags = RADIOLIB_BLE_AD_FLAG_LE_GENERAL_DISC | RADIOLIB_BLE_AD_FLAG_BR_EDR_NOT_SUPPORTED);
+
+    /*!
+      \brief Appends complete local name AD structure.
+
+      \param name Null-terminated device name.
+
+      \returns \ref status_codes
+    */
+    int16_t addName(const char* name);
+
+    /*!
+      \brief Appends manufacturer specific data AD structure.
+
+      \param companyId Bluetooth SIG company identifier.
+
+      \param data Manufacturer data.
+
+      \param len Length of manufacturer data in bytes.
+
+      \returns \ref status_codes
+    */
+    int16_t addManufacturerData(uint16_t companyId, uint8_t* data, uint8_t len);
+
+    /*!
+      \brief Sends one advertising event - the same PDU is sent on channels 37, 38 and 39 back-to-back.
+      Whitening seed is updated for each channel. Advertising interval (and random advertising delay) is up to the caller.
+
+      \param channelMap Bit mask of channels to use, bit 0 is channel 37, bit 1 channel 38 and bit 2 channel 39. Defaults to all three channels.
+
+      \returns \ref status_codes
+    */
+    int16_t advertise(uint8_t channelMap = 0x07);
+
+    /*!
+      \brief Starts scanning for advertising packets. Progress is driven by calling update.
+
+      \param channel Advertising channel to listen on first (37, 38 or 39).
+
+      \param dwell Time in ms to stay on each channel before hopping to the next one. Set to 0 to stay on a single channel.
+
+      \returns \ref status_codes
+    */
+    int16_t startScan(uint8_t channel = RADIOLIB_BLE_ADV_CHANNEL_37, uint32_t dwell = 0);
+
+    /*!
+      \brief Stops scanning and sets the radio to standby.
+
+      \returns \ref status_codes
+    */
+    int16_t stopScan();
+
+    /*!
+      \brief Processes scanner. Received packets are parsed and saved to record queue.
+      Should be called as often as possible, e.g. from loop or when DIO1 interrupt fires.
+
+      \returns \ref status_codes
+    */
+    int16_t update();
+
+    /*!
+      \brief Gets number of records waiting in the queue.
+
+      \returns Number of received records.
+    */
+    uint8_t available();
+
+    /*!
+      \brief Gets the oldest record from the queue.
+
+      \param record Pointer to structure to save the record.
+
+      \returns \ref status_codes
+    */
+    int16_t read(BLEAdvRecord_t* record);
+
+    /*!
+      \brief Gets number of records that were dropped because the queue was full.
+
+      \returns Number of dropped records.
+    */
+    uint16_t getDropped();
+
+    /*!
+      \brief Finds AD structure in advertising data of a received record.
+
+      \param record Record to search.
+
+      \param type AD type to look for.
+
+      \param len Pointer to variable to save AD data length.
+
+      \returns Pointer to AD data within record, NULL if not found.
+    */
+    static uint8_t* findData(BLEAdvRecord_t* record, uint8_t type, uint8_t* len);
+
+#if !defined(RADIOLIB_GODMODE)
+  private:
+#endif
+    SX128x* _radio;
+
+    // advertising PDU (header, AdvA and AD structures)
+    uint8_t _pdu[RADIOLIB_BLE_PDU_HEADER_LEN + RADIOLIB_BLE_ADV_PAYLOAD_MAX_LEN];
+    uint8_t _dataLen = 0;
+
+    // scanner state
+    bool _scanning = false;
+    uint8_t _scanChannel = RADIOLIB_BLE_ADV_CHANNEL_37;
+    uint32_t _scanDwell = 0;
+    uint32_t _scanStart = 0;
+
+    // received record queue
+    BLEAdvRecord_t _queue[RADIOLIB_BLE_QUEUE_SIZE];
+    uint8_t _queueHead = 0;
+    uint8_t _queueCount = 0;
+    uint16_t _dropped = 0;
+
+    int16_t setChannel(uint8_t channel);
+    int16_t transmitPdu();
+    int16_t receivePdu();
+    int16_t restartScan();
+};
+
+#endif
+
+#endif
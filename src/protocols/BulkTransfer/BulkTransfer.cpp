@@ -0,0 +1,545 @@
+#include "BulkTransfer.h"
+#if !defined(RADIOLIB_EXCLUDE_BULK_TRANSFER) && !defined(RADIOLIB_EXCLUDE_SX128X)
+
+BulkTransferClient::BulkTransferClient(SX128x* radio) {
+  _radio = radio;
+}
+
+int16_t BulkTransferClient::begin(uint8_t chunkSize, uint8_t window, uint16_t ackTimeout, uint8_t retries) {
+  if((chunkSize == 0) || (chunkSize > RADIOLIB_BULK_MAX_CHUNK_SIZE)) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+  if(window > RADIOLIB_BULK_MAX_WINDOW) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  // only FLRC and GFSK packet engines can be used
+  uint8_t modem = _radio->getPacketType();
+  if(!((modem == RADIOLIB_SX128X_PACKET_TYPE_FLRC) || (modem == RADIOLIB_SX128X_PACKET_TYPE_GFSK))) {
+    return(RADIOLIB_ERR_WRONG_MODEM);
+  }
+
+  _chunkSize = chunkSize;
+  _window = window;
+  _ackTimeout = ackTimeout;
+  _retries = retries;
+  _state = RADIOLIB_BULK_STATE_IDLE;
+  _finished = false;
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t BulkTransferClient::startTransmit(uint8_t* data, size_t len) {
+  if(data == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if((len == 0) || (len > (size_t)_chunkSize * RADIOLIB_BULK_MAX_CHUNKS)) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // reset transfer state
+  _data = data;
+  _len = len;
+  _numChunks = (len + _chunkSize - 1) / _chunkSize;
+  _base = 0;
+  _map = 0;
+  _nextNew = 0;
+  _retryCount = 0;
+  _finished = false;
+  memset(&_stats, 0x00, sizeof(BulkTransferStats_t));
+  _startTime = _radio->_mod->micros();
+  _lastTime = _startTime;
+
+  return(startRound());
+}
+
+int16_t BulkTransferClient::startReceive(uint8_t* data, size_t maxLen) {
+  if(data == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // reset transfer state
+  _data = data;
+  _len = maxLen;
+  _numChunks = 0;
+  _base = 0;
+  _map = 0;
+  _rxCount = 0;
+  _rxLen = 0;
+  _finished = false;
+  memset(&_stats, 0x00, sizeof(BulkTransferStats_t));
+
+  _state = RADIOLIB_BULK_STATE_RX;
+  return(startListening());
+}
+
+int16_t BulkTransferClient::update() {
+  if(_state == RADIOLIB_BULK_STATE_IDLE) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // check ACK timeout
+  if(_state == RADIOLIB_BULK_STATE_WAIT_ACK) {
+    if(_radio->_mod->millis() - _ackStart >= _ackTimeout) {
+      _retryCount++;
+      if(_retryCount > _retries) {
+        stop();
+        return(RADIOLIB_ERR_ACK_NOT_RECEIVED);
+      }
+
+      // resend everything that was not acknowledged yet
+      return(startRound());
+    }
+  }
+
+  // nothing to do until DIO1 is raised
+  if(!_radio->_mod->digitalRead(_radio->_mod->getIrq())) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  switch(_state) {
+    case RADIOLIB_BULK_STATE_TX:
+      return(processTxDone());
+    case RADIOLIB_BULK_STATE_WAIT_ACK:
+      return(processAck());
+    case RADIOLIB_BULK_STATE_RX:
+      return(processData());
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t BulkTransferClient::stop() {
+  _state = RADIOLIB_BULK_STATE_IDLE;
+  _radio->clearIrqStatus();
+  return(_radio->standby());
+}
+
+bool BulkTransferClient::isFinished() {
+  return(_finished);
+}
+
+int16_t BulkTransferClient::transmit(uint8_t* data, size_t len) {
+  int16_t state = startTransmit(data, len);
+  RADIOLIB_ASSERT(state);
+
+  // ACK timeouts are handled in update, so there is no need for additional timeout here
+  while(!_finished) {
+    state = update();
+    RADIOLIB_ASSERT(state);
+    _radio->_mod->yield();
+  }
+
+  return(state);
+}
+
+int16_t BulkTransferClient::receive(uint8_t* data, size_t maxLen, uint32_t timeout) {
+  int16_t state = startReceive(data, maxLen);
+  RADIOLIB_ASSERT(state);
+
+  uint32_t start = _radio->_mod->millis();
+  while(!_finished) {
+    // CRC errors and dropped frames are not fatal, the sender will repeat them
+    update();
+    _radio->_mod->yield();
+    if(_radio->_mod->millis() - start >= timeout) {
+      stop();
+      return(RADIOLIB_ERR_RX_TIMEOUT);
+    }
+  }
+
+  // give the sender some time to receive the final ACK, repeated frames are acknowledged again
+  if(_window > 0) {
+    start = _radio->_mod->millis();
+    while(_radio->_mod->millis() - start < _ackTimeout) {
+      update();
+      _radio->_mod->yield();
+    }
+  }
+
+  return(stop());
+}
+
+size_t BulkTransferClient::getReceivedLength() {
+  return(_rxLen);
+}
+
+uint16_t BulkTransferClient::getMissingChunks() {
+  return(_numChunks - _rxCount);
+}
+
+int16_t BulkTransferClient::getStats(BulkTransferStats_t* stats) {
+  if(stats == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  memcpy(stats, &_stats, sizeof(BulkTransferStats_t));
+  if(stats->elapsed > 0) {
+    // bits per microsecond to kbps
+    stats->throughput = ((float)stats->bytes * 8.0f * 1000.0f) / (float)stats->elapsed;
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t BulkTransferClient::startRound() {
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+
+  // map TX done to DIO1
+  state = _radio->setDioIrqParams(RADIOLIB_SX128X_IRQ_TX_DONE | RADIOLIB_SX128X_IRQ_RX_TX_TIMEOUT, RADIOLIB_SX128X_IRQ_TX_DONE);
+  RADIOLIB_ASSERT(state);
+  state = _radio->setTxParams(_radio->_pwr);
+  RADIOLIB_ASSERT(state);
+
+  // set RF switch (if present)
+  _radio->_mod->setRfSwitchState(LOW, HIGH);
+
+  // stage first two frames and start transmitting the first one
+  _cursor = _base;
+  _lastLen = 0;
+  state = stage(0);
+  RADIOLIB_ASSERT(state);
+  if(!_staged[0]) {
+    // everything is already acknowledged
+    _finished = true;
+    return(stop());
+  }
+  state = launch(0);
+  RADIOLIB_ASSERT(state);
+  _state = RADIOLIB_BULK_STATE_TX;
+  return(stage(1));
+}
+
+int32_t BulkTransferClient::findNext(uint16_t from) {
+  // without ACK window, all chunks are sent exactly once
+  uint32_t limit = _numChunks;
+  if(_window > 0) {
+    if((uint32_t)_base + _window < limit) {
+      limit = (uint32_t)_base + _window;
+    }
+  }
+
+  // skip chunks that were already acknowledged
+  for(uint32_t seq = from; seq < limit; seq++) {
+    if((_window > 0) && (_map & ((uint32_t)1 << (seq - _base)))) {
+      continue;
+    }
+    return(seq);
+  }
+  return(-1);
+}
+
+int16_t BulkTransferClient::stage(uint8_t slot) {
+  int32_t seq = findNext(_cursor);
+  if(seq < 0) {
+    _staged[slot] = false;
+    return(RADIOLIB_ERR_NONE);
+  }
+  _cursor = seq + 1;
+
+  // build frame header
+  uint8_t frame[RADIOLIB_BULK_STAGING_SLOT_SIZE];
+  frame[0] = RADIOLIB_BULK_TYPE_DATA;
+  if(seq == _numChunks - 1) {
+    frame[0] |= RADIOLIB_BULK_FLAG_LAST;
+  }
+  if((_window > 0) && (findNext(_cursor) < 0)) {
+    frame[0] |= RADIOLIB_BULK_FLAG_ACK_REQ;
+  }
+  frame[1] = (uint8_t)(seq & 0xFF);
+  frame[2] = (uint8_t)((seq >> 8) & 0xFF);
+  frame[3] = (uint8_t)(_numChunks & 0xFF);
+  frame[4] = (uint8_t)((_numChunks >> 8) & 0xFF);
+
+  // copy data chunk
+  size_t offset = (size_t)seq * _chunkSize;
+  uint8_t len = _chunkSize;
+  if(offset + len > _len) {
+    len = _len - offset;
+  }
+  memcpy(&frame[RADIOLIB_BULK_HEADER_LEN], &_data[offset], len);
+
+  // count retransmissions
+  if((uint16_t)seq < _nextNew) {
+    _stats.retransmissions++;
+  } else {
+    _nextNew = seq + 1;
+  }
+
+  // write the frame to radio buffer, this can be done while the other slot is being transmitted
+  _stagedLen[slot] = RADIOLIB_BULK_HEADER_LEN + len;
+  _staged[slot] = true;
+  return(_radio->writeBuffer(frame, _stagedLen[slot], slot * RADIOLIB_BULK_STAGING_SLOT_SIZE));
+}
+
+int16_t BulkTransferClient::launch(uint8_t slot) {
+  // packet parameters only need to be updated when length changes (usually only for the last chunk)
+  int16_t state = setPayloadLength(_stagedLen[slot]);
+  RADIOLIB_ASSERT(state);
+
+  state = _radio->setBufferBaseAddress(slot * RADIOLIB_BULK_STAGING_SLOT_SIZE, 0x00);
+  RADIOLIB_ASSERT(state);
+
+  state = _radio->clearIrqStatus();
+  RADIOLIB_ASSERT(state);
+
+  _txSlot = slot;
+  _staged[slot] = false;
+  return(_radio->setTx(RADIOLIB_SX128X_TX_TIMEOUT_NONE));
+}
+
+int16_t BulkTransferClient::setPayloadLength(uint8_t len) {
+  if(len == _lastLen) {
+    return(RADIOLIB_ERR_NONE);
+  }
+  _lastLen = len;
+  return(_radio->setPacketParamsGFSK(_radio->_preambleLengthGFSK, _radio->_syncWordLen, _radio->_syncWordMatch, _radio->_crcGFSK, _radio->_whitening, len));
+}
+
+int16_t BulkTransferClient::startListening() {
+  // accept frames up to the maximum staging slot size
+  _lastLen = 0;
+  int16_t state = setPayloadLength(RADIOLIB_BULK_HEADER_LEN + _chunkSize);
+  RADIOLIB_ASSERT(state);
+
+  // continuous receive mode, the radio stays in receive mode after each frame
+  return(_radio->startReceive(RADIOLIB_SX128X_RX_TIMEOUT_INF));
+}
+
+int16_t BulkTransferClient::processTxDone() {
+  uint16_t irq = _radio->getIrqStatus();
+  if(!(irq & RADIOLIB_SX128X_IRQ_TX_DONE)) {
+    return(_radio->clearIrqStatus());
+  }
+  uint32_t now = _radio->_mod->micros();
+  _stats.packets++;
+  if(_window == 0) {
+    _stats.bytes += _stagedLen[_txSlot] - RADIOLIB_BULK_HEADER_LEN;
+  }
+
+  // start the pre-staged frame as soon as possible
+  uint8_t next = _txSlot ^ 1;
+  if(_staged[next]) {
+    int16_t state = launch(next);
+    RADIOLIB_ASSERT(state);
+
+    // measure turnaround
+    uint32_t gap = _radio->_mod->micros() - now;
+    if(gap > _stats.maxGap) {
+      _stats.maxGap = gap;
+    }
+    _stats.elapsed = _radio->_mod->micros() - _startTime;
+
+    // stage the following one in the slot that was just sent
+    return(stage(next ^ 1));
+  }
+
+  // this round is done
+  _stats.elapsed = now - _startTime;
+  if(_window == 0) {
+    _finished = true;
+    return(stop());
+  }
+
+  // wait for selective ACK
+  _state = RADIOLIB_BULK_STATE_WAIT_ACK;
+  _ackStart = _radio->_mod->millis();
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+  return(startListening());
+}
+
+int16_t BulkTransferClient::processAck() {
+  uint16_t irq = _radio->getIrqStatus();
+  if(!(irq & RADIOLIB_SX128X_IRQ_RX_DONE) || (irq & RADIOLIB_SX128X_IRQ_CRC_ERROR)) {
+    // keep waiting until timeout
+    return(_radio->clearIrqStatus());
+  }
+
+  // read the frame
+  uint8_t rxBufStatus[2] = {0, 0};
+  int16_t state = _radio->SPIreadCommand(RADIOLIB_SX128X_CMD_GET_RX_BUFFER_STATUS, rxBufStatus, 2);
+  RADIOLIB_ASSERT(state);
+  uint8_t ack[RADIOLIB_BULK_ACK_LEN];
+  if(rxBufStatus[0] != RADIOLIB_BULK_ACK_LEN) {
+    return(_radio->clearIrqStatus());
+  }
+  state = _radio->readBuffer(ack, RADIOLIB_BULK_ACK_LEN, rxBufStatus[1]);
+  RADIOLIB_ASSERT(state);
+  state = _radio->clearIrqStatus();
+  RADIOLIB_ASSERT(state);
+  if((ack[0] & RADIOLIB_BULK_TYPE_MASK) != RADIOLIB_BULK_TYPE_ACK) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // parse ACK - stale ACKs from previous rounds are ignored
+  uint16_t ackBase = (uint16_t)ack[1] | ((uint16_t)ack[2] << 8);
+  uint32_t ackMap = (uint32_t)ack[3] | ((uint32_t)ack[4] << 8) | ((uint32_t)ack[5] << 16) | ((uint32_t)ack[6] << 24);
+  if(ackBase < _base) {
+    return(RADIOLIB_ERR_NONE);
+  }
+  _stats.acks++;
+  _retryCount = 0;
+  _base = ackBase;
+  _map = ackMap;
+
+  // count acknowledged bytes
+  size_t acked = (size_t)_base * _chunkSize;
+  _stats.bytes = acked > _len ? _len : acked;
+
+  if(_base >= _numChunks) {
+    _stats.elapsed = _radio->_mod->micros() - _startTime;
+    _finished = true;
+    return(stop());
+  }
+
+  // send the next window
+  return(startRound());
+}
+
+int16_t BulkTransferClient::processData() {
+  uint16_t irq = _radio->getIrqStatus();
+  if(!(irq & RADIOLIB_SX128X_IRQ_RX_DONE)) {
+    return(_radio->clearIrqStatus());
+  }
+  if(irq & RADIOLIB_SX128X_IRQ_CRC_ERROR) {
+    _radio->clearIrqStatus();
+    return(RADIOLIB_ERR_CRC_MISMATCH);
+  }
+  updateTiming();
+
+  // read the frame
+  uint8_t rxBufStatus[2] = {0, 0};
+  int16_t state = _radio->SPIreadCommand(RADIOLIB_SX128X_CMD_GET_RX_BUFFER_STATUS, rxBufStatus, 2);
+  RADIOLIB_ASSERT(state);
+  uint8_t len = rxBufStatus[0];
+  if((len <= RADIOLIB_BULK_HEADER_LEN) || (len > RADIOLIB_BULK_HEADER_LEN + _chunkSize)) {
+    return(_radio->clearIrqStatus());
+  }
+  uint8_t frame[RADIOLIB_BULK_STAGING_SLOT_SIZE];
+  state = _radio->readBuffer(frame, len, rxBufStatus[1]);
+  RADIOLIB_ASSERT(state);
+  state = _radio->clearIrqStatus();
+  RADIOLIB_ASSERT(state);
+  if((frame[0] & RADIOLIB_BULK_TYPE_MASK) != RADIOLIB_BULK_TYPE_DATA) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // parse header
+  uint16_t seq = (uint16_t)frame[1] | ((uint16_t)frame[2] << 8);
+  _numChunks = (uint16_t)frame[3] | ((uint16_t)frame[4] << 8);
+  uint8_t dataLen = len - RADIOLIB_BULK_HEADER_LEN;
+  size_t offset = (size_t)seq * _chunkSize;
+  if(seq >= _numChunks) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // check whether this chunk is new
+  bool accept = true;
+  if(_window > 0) {
+    accept = (seq >= _base) && (seq < (uint32_t)_base + RADIOLIB_BULK_MAX_WINDOW) && !(_map & ((uint32_t)1 << (seq - _base)));
+  }
+  if(offset + dataLen > _len) {
+    accept = false;
+  }
+
+  if(accept) {
+    memcpy(&_data[offset], &frame[RADIOLIB_BULK_HEADER_LEN], dataLen);
+    _rxCount++;
+    _stats.packets++;
+    _stats.bytes += dataLen;
+    if(offset + dataLen > _rxLen) {
+      _rxLen = offset + dataLen;
+    }
+
+    // slide the window over all chunks received in order
+    if(_window > 0) {
+      _map |= ((uint32_t)1 << (seq - _base));
+      while(_map & 0x01) {
+        _map >>= 1;
+        _base++;
+      }
+    }
+  } else if(_window > 0) {
+    _stats.retransmissions++;
+  }
+
+  // check whether the transfer is finished
+  if(_window > 0) {
+    if(_base >= _numChunks) {
+      _finished = true;
+    }
+  } else if((frame[0] & RADIOLIB_BULK_FLAG_LAST) || (_rxCount >= _numChunks)) {
+    _finished = true;
+  }
+
+  // send selective ACK when requested
+  if((_window > 0) && (frame[0] & RADIOLIB_BULK_FLAG_ACK_REQ)) {
+    return(sendAck());
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t BulkTransferClient::sendAck() {
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+
+  // build ACK frame
+  uint8_t ack[RADIOLIB_BULK_ACK_LEN];
+  ack[0] = RADIOLIB_BULK_TYPE_ACK;
+  ack[1] = (uint8_t)(_base & 0xFF);
+  ack[2] = (uint8_t)((_base >> 8) & 0xFF);
+  ack[3] = (uint8_t)(_map & 0xFF);
+  ack[4] = (uint8_t)((_map >> 8) & 0xFF);
+  ack[5] = (uint8_t)((_map >> 16) & 0xFF);
+  ack[6] = (uint8_t)((_map >> 24) & 0xFF);
+
+  // ACK is sent from the upper staging slot to keep received data intact
+  _lastLen = 0;
+  state = setPayloadLength(RADIOLIB_BULK_ACK_LEN);
+  RADIOLIB_ASSERT(state);
+  state = _radio->setBufferBaseAddress(RADIOLIB_BULK_STAGING_SLOT_SIZE, 0x00);
+  RADIOLIB_ASSERT(state);
+  state = _radio->writeBuffer(ack, RADIOLIB_BULK_ACK_LEN, RADIOLIB_BULK_STAGING_SLOT_SIZE);
+  RADIOLIB_ASSERT(state);
+  state = _radio->setDioIrqParams(RADIOLIB_SX128X_IRQ_TX_DONE | RADIOLIB_SX128X_IRQ_RX_TX_TIMEOUT, RADIOLIB_SX128X_IRQ_TX_DONE);
+  RADIOLIB_ASSERT(state);
+  state = _radio->clearIrqStatus();
+  RADIOLIB_ASSERT(state);
+  state = _radio->setTxParams(_radio->_pwr);
+  RADIOLIB_ASSERT(state);
+  _radio->_mod->setRfSwitchState(LOW, HIGH);
+  state = _radio->setTx(RADIOLIB_SX128X_TX_TIMEOUT_NONE);
+  RADIOLIB_ASSERT(state);
+
+  // ACK is short, wait for it here
+  uint32_t start = _radio->_mod->micros();
+  while(!_radio->_mod->digitalRead(_radio->_mod->getIrq())) {
+    _radio->_mod->yield();
+    if(_radio->_mod->micros() - start > RADIOLIB_BULK_ACK_TX_TIMEOUT) {
+      break;
+    }
+  }
+  _stats.acks++;
+
+  // go back to receive mode
+  state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+  return(startListening());
+}
+
+void BulkTransferClient::updateTiming() {
+  uint32_t now = _radio->_mod->micros();
+  if(_stats.packets == 0) {
+    _startTime = now;
+  } else {
+    uint32_t gap = now - _lastTime;
+    if(gap > _stats.maxGap) {
+      _stats.maxGap = gap;
+    }
+  }
+  _lastTime = now;
+  _stats.elapsed = now - _startTime;
+}
+
+#endif
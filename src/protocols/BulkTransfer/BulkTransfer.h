@@ -0,0 +1,264 @@
+#if !defined(_RADIOLIB_BULK_TRANSFER_H)
+#define _RADIOLIB_BULK_TRANSFER_H
+
+#include "../../TypeDef.h"
+
+#if !defined(RADIOLIB_EXCLUDE_BULK_TRANSFER) && !defined(RADIOLIB_EXCLUDE_SX128X)
+
+#include "../../modules/SX128x/SX128x.h"
+
+// radio buffer is split into two halves, one is transmitted while the next chunk is staged in the other
+#define RADIOLIB_BULK_STAGING_SLOT_SIZE                         (128)
+
+// frame layout: type/flags (1 byte), sequence number (2 bytes), total number of chunks (2 bytes), data
+#define RADIOLIB_BULK_HEADER_LEN                                (5)
+#define RADIOLIB_BULK_MAX_CHUNK_SIZE                            (RADIOLIB_BULK_STAGING_SLOT_SIZE - RADIOLIB_BULK_HEADER_LEN)
+#define RADIOLIB_BULK_DEFAULT_CHUNK_SIZE                        (120)
+#define RADIOLIB_BULK_MAX_CHUNKS                                (0xFFFF)
+
+// ACK layout: type (1 byte), first missing chunk (2 bytes), received chunk bitmap relative to first missing (4 bytes)
+#define RADIOLIB_BULK_ACK_LEN                                   (7)
+#define RADIOLIB_BULK_MAX_WINDOW                                (32)
+
+// selective ACK defaults
+#define RADIOLIB_BULK_DEFAULT_ACK_TIMEOUT                       (20)
+#define RADIOLIB_BULK_DEFAULT_RETRIES                           (10)
+
+// maximum time to wait for ACK transmission in us
+#define RADIOLIB_BULK_ACK_TX_TIMEOUT                            (10000)
+
+// frame type and flags                                                  MSB   LSB   DESCRIPTION
+#define RADIOLIB_BULK_TYPE_DATA                                 (0x01)  //  3     0   frame type: data chunk
+#define RADIOLIB_BULK_TYPE_ACK                                  (0x02)  //  3     0               selective ACK
+#define RADIOLIB_BULK_TYPE_MASK                                 (0x0F)  //  3     0   frame type mask
+#define RADIOLIB_BULK_FLAG_LAST                                 (0x40)  //  6     6   last chunk of the transfer
+#define RADIOLIB_BULK_FLAG_ACK_REQ                              (0x80)  //  7     7   last chunk of the window, ACK requested
+
+// transfer states
+#define RADIOLIB_BULK_STATE_IDLE                                (0x00)
+#define RADIOLIB_BULK_STATE_TX                                  (0x01)
+#define RADIOLIB_BULK_STATE_WAIT_ACK                            (0x02)
+#define RADIOLIB_BULK_STATE_RX                                  (0x03)
+
+/*!
+  \struct BulkTransferStats_t
+
+  \brief Statistics of the last bulk transfer.
+*/
+struct BulkTransferStats_t {
+  /*!
+    \brief Number of payload bytes delivered (sender: acknowledged or sent, receiver: received).
+  */
+  uint32_t bytes;
+
+  /*!
+    \brief Number of data frames sent or received.
+  */
+  uint16_t packets;
+
+  /*!
+    \brief Number of data frames that were sent more than once.
+  */
+  uint16_t retransmissions;
+
+  /*!
+    \brief Number of selective ACKs sent or received.
+  */
+  uint16_t acks;
+
+  /*!
+    \brief Duration of the transfer in us, from start until the last frame.
+  */
+  uint32_t elapsed;
+
+  /*!
+    \brief Longest time between two consecutive frames in us (sender: TX done to next TX start, receiver: packet to packet).
+  */
+  uint32_t maxGap;
+
+  /*!
+    \brief Effective throughput in kbps.
+  */
+  float throughput;
+};
+
+/*!
+  \class BulkTransferClient
+
+  \brief Client for high-throughput chunked transfers with %SX128x modules in FLRC or GFSK mode.
+  Chunks are sent back-to-back (TX to TX) with the next chunk pre-staged in radio buffer, receiver stays in continuous
+  receive mode. Optional selective ACK window allows retransmission of lost chunks.
+*/
+class BulkTransferClient {
+  public:
+    /*!
+      \brief Default constructor.
+
+      \param radio Pointer to the %SX128x module that will be used.
+    */
+    explicit BulkTransferClient(SX128x* radio);
+
+    // basic methods
+
+    /*!
+      \brief Initialization method. The radio must already be initialized in FLRC (SX128x::beginFLRC) or GFSK (SX128x::beginGFSK) mode.
+      Both sides must use the same chunk size and window.
+
+      \param chunkSize Number of payload bytes in a single frame, up to RADIOLIB_BULK_MAX_CHUNK_SIZE. Defaults to 120 bytes (fits FLRC maximum payload).
+
+      \param window Number of chunks sent before selective ACK is requested, up to RADIOLIB_BULK_MAX_WINDOW. Set to 0 to disable ACKs (streaming without retransmissions).
+
+      \param ackTimeout Time to wait for ACK in ms. Defaults to 20 ms.
+
+      \param retries Number of consecutive ACK timeouts before the transfer fails. Defaults to 10.
+
+      \returns \ref status_codes
+    */
+    int16_t begin(uint8_t chunkSize = RADIOLIB_BULK_DEFAULT_CHUNK_SIZE, uint8_t window = 0, uint16_t ackTimeout = RADIOLIB_BULK_DEFAULT_ACK_TIMEOUT, uint8_t retries = RADIOLIB_BULK_DEFAULT_RETRIES);
+
+    /*!
+      \brief Starts non-blocking transfer of a buffer. Progress is driven by calling update.
+
+      \param data Data to send, must stay valid until the transfer finishes.
+
+      \param len Number of bytes to send, up to chunkSize * RADIOLIB_BULK_MAX_CHUNKS.
+
+      \returns \ref status_codes
+    */
+    int16_t startTransmit(uint8_t* data, size_t len);
+
+    /*!
+      \brief Starts non-blocking reception of a transfer. Progress is driven by calling update.
+      Once finished, the receiver keeps listening (and acknowledging repeated frames) until stop or another transfer is started.
+
+      \param data Buffer to save received data to.
+
+      \param maxLen Size of the buffer in bytes. Chunks that do not fit are dropped.
+
+      \returns \ref status_codes
+    */
+    int16_t startReceive(uint8_t* data, size_t maxLen);
+
+    /*!
+      \brief Processes ongoing transfer. Should be called as often as possible, e.g. from loop or when DIO1 interrupt fires.
+
+      \returns \ref status_codes
+    */
+    int16_t update();
+
+    /*!
+      \brief Stops the ongoing transfer and sets the radio to standby.
+
+      \returns \ref status_codes
+    */
+    int16_t stop();
+
+    /*!
+      \brief Checks whether the last transfer has finished.
+
+      \returns True if all chunks were sent (and acknowledged) or received, false otherwise.
+    */
+    bool isFinished();
+
+    /*!
+      \brief Blocking transfer of a buffer.
+
+      \param data Data to send.
+
+      \param len Number of bytes to send.
+
+      \returns \ref status_codes
+    */
+    int16_t transmit(uint8_t* data, size_t len);
+
+    /*!
+      \brief Blocking reception of a transfer.
+
+      \param data Buffer to save received data to.
+
+      \param maxLen Size of the buffer in bytes.
+
+      \param timeout Maximum time to wait for the transfer to finish in ms.
+
+      \returns \ref status_codes
+    */
+    int16_t receive(uint8_t* data, size_t maxLen, uint32_t timeout);
+
+    /*!
+      \brief Gets number of bytes received in the last transfer.
+
+      \returns Length of received data in bytes (position of the end of the furthest received chunk).
+    */
+    size_t getReceivedLength();
+
+    /*!
+      \brief Gets number of chunks that were not received. Only meaningful in the receiver without ACK window, once the last chunk arrives.
+
+      \returns Number of missing chunks.
+    */
+    uint16_t getMissingChunks();
+
+    /*!
+      \brief Gets statistics of the last transfer. Can be used to benchmark throughput and latency of different radio configurations.
+
+      \param stats Pointer to structure to save the statistics.
+
+      \returns \ref status_codes
+    */
+    int16_t getStats(BulkTransferStats_t* stats);
+
+#if !defined(RADIOLIB_GODMODE)
+  private:
+#endif
+    SX128x* _radio;
+
+    // configuration
+    uint8_t _chunkSize = RADIOLIB_BULK_DEFAULT_CHUNK_SIZE;
+    uint8_t _window = 0;
+    uint16_t _ackTimeout = RADIOLIB_BULK_DEFAULT_ACK_TIMEOUT;
+    uint8_t _retries = RADIOLIB_BULK_DEFAULT_RETRIES;
+
+    // transfer state
+    uint8_t _state = RADIOLIB_BULK_STATE_IDLE;
+    bool _finished = false;
+    uint8_t* _data = NULL;
+    size_t _len = 0;
+    uint16_t _numChunks = 0;
+    uint16_t _base = 0;
+    uint32_t _map = 0;
+
+    // sender state
+    uint16_t _cursor = 0;
+    uint16_t _nextNew = 0;
+    uint8_t _txSlot = 0;
+    bool _staged[2] = { false, false };
+    uint8_t _stagedLen[2] = { 0, 0 };
+    uint8_t _lastLen = 0;
+    uint8_t _retryCount = 0;
+    uint32_t _ackStart = 0;
+
+    // receiver state
+    uint16_t _rxCount = 0;
+    size_t _rxLen = 0;
+
+    // statistics
+    BulkTransferStats_t _stats;
+    uint32_t _startTime = 0;
+    uint32_t _lastTime = 0;
+
+    int16_t startRound();
+    int32_t findNext(uint16_t from);
+    int16_t stage(uint8_t slot);
+    int16_t launch(uint8_t slot);
+    int16_t setPayloadLength(uint8_t len);
+    int16_t startListening();
+    int16_t processTxDone();
+    int16_t processAck();
+    int16_t processData();
+    int16_t sendAck();
+    void updateTiming();
+};
+
+#endif
+
+#endif
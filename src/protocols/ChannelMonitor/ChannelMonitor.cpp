@@ -0,0 +1,217 @@
+#include "ChannelMonitor.h"
+#if !defined(RADIOLIB_EXCLUDE_CHANNEL_MONITOR) && (!defined(RADIOLIB_EXCLUDE_SX128X) || !defined(RADIOLIB_EXCLUDE_SX126X))
+
+#if !defined(RADIOLIB_EXCLUDE_SX128X)
+ChannelMonitor::ChannelMonitor(SX128x* radio) {
+  _sx128x = radio;
+  _mod = radio->getMod();
+}
+#endif
+
+#if !defined(RADIOLIB_EXCLUDE_SX126X)
+ChannelMonitor::ChannelMonitor(SX126x* radio) {
+  _sx126x = radio;
+  _mod = radio->getMod();
+}
+#endif
+
+int16_t ChannelMonitor::begin(float* freqs, uint8_t num, float threshold, uint16_t interval) {
+  if(freqs == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if((num == 0) || (num > RADIOLIB_CHANNEL_MONITOR_MAX_CHANNELS)) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  _numChannels = num;
+  for(uint8_t i = 0; i < num; i++) {
+    _channels[i].freq = freqs[i];
+  }
+  _threshold = threshold;
+  _interval = interval;
+  _running = false;
+  reset();
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t ChannelMonitor::start() {
+  if(_numChannels == 0) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  _running = true;
+  return(tune(_current));
+}
+
+int16_t ChannelMonitor::stop() {
+  _running = false;
+  return(standby());
+}
+
+int16_t ChannelMonitor::update() {
+  if(!_running) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // wait until the radio has been listening on the current channel long enough
+  if(_mod->millis() - _tuned < _interval) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // sample and move on
+  addSample(_current, getRSSIInst());
+  _current = (_current + 1) % _numChannels;
+  return(tune(_current));
+}
+
+int16_t ChannelMonitor::scan(uint16_t passes) {
+  if(_numChannels == 0) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  for(uint16_t pass = 0; pass < passes; pass++) {
+    for(uint8_t i = 0; i < _numChannels; i++) {
+      int16_t state = tune(i);
+      RADIOLIB_ASSERT(state);
+      while(_mod->millis() - _tuned < _interval) {
+        _mod->yield();
+      }
+      addSample(i, getRSSIInst());
+    }
+  }
+
+  // resume background monitoring, if it was running
+  if(_running) {
+    return(tune(_current));
+  }
+  return(standby());
+}
+
+void ChannelMonitor::reset() {
+  for(uint8_t i = 0; i < _numChannels; i++) {
+    _channels[i].rssiAvg = 0;
+    _channels[i].rssiMax = -255.0;
+    _channels[i].samples = 0;
+    _channels[i].busy = 0;
+  }
+  _current = 0;
+}
+
+int16_t ChannelMonitor::getStats(uint8_t index, ChannelStats_t* stats) {
+  if(stats == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(index >= _numChannels) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  memcpy(stats, &_channels[index], sizeof(ChannelStats_t));
+  return(RADIOLIB_ERR_NONE);
+}
+
+float ChannelMonitor::getBusyRatio(uint8_t index) {
+  if((index >= _numChannels) || (_channels[index].samples == 0)) {
+    return(1.0);
+  }
+  return((float)_channels[index].busy / (float)_channels[index].samples);
+}
+
+int16_t ChannelMonitor::getLeastLoaded(float* freq) {
+  int16_t best = RADIOLIB_ERR_CHANNEL_NOT_SAMPLED;
+  float bestRatio = 0;
+  for(uint8_t i = 0; i < _numChannels; i++) {
+    if(_channels[i].samples == 0) {
+      continue;
+    }
+
+    // lower busy ratio wins, quieter channel breaks ties
+    float ratio = getBusyRatio(i);
+    if((best < 0) || (ratio < bestRatio) || ((ratio == bestRatio) && (_channels[i].rssiAvg < _channels[best].rssiAvg))) {
+      best = i;
+      bestRatio = ratio;
+    }
+  }
+
+  if((best >= 0) && (freq != NULL)) {
+    *freq = _channels[best].freq;
+  }
+  return(best);
+}
+
+int16_t ChannelMonitor::tune(uint8_t index) {
+  int16_t state = standby();
+  RADIOLIB_ASSERT(state);
+
+  // retune and go back to continuous receive mode - instantaneous RSSI is only valid in receive mode
+  #if !defined(RADIOLIB_EXCLUDE_SX128X)
+  if(_sx128x != NULL) {
+    state = _sx128x->setFrequency(_channels[index].freq);
+    RADIOLIB_ASSERT(state);
+    state = _sx128x->startReceive(RADIOLIB_SX128X_RX_TIMEOUT_INF);
+  }
+  #endif
+  #if !defined(RADIOLIB_EXCLUDE_SX126X)
+  if(_sx126x != NULL) {
+    // image calibration is skipped, channel plan is expected to be within a single band
+    state = _sx126x->setFrequencyRaw(_channels[index].freq);
+    RADIOLIB_ASSERT(state);
+    state = _sx126x->startReceive(RADIOLIB_SX126X_RX_TIMEOUT_INF);
+  }
+  #endif
+  _tuned = _mod->millis();
+  return(state);
+}
+
+float ChannelMonitor::getRSSIInst() {
+  #if !defined(RADIOLIB_EXCLUDE_SX128X)
+  if(_sx128x != NULL) {
+    return(_sx128x->getRSSIInst());
+  }
+  #endif
+  #if !defined(RADIOLIB_EXCLUDE_SX126X)
+  if(_sx126x != NULL) {
+    return(_sx126x->getRSSIInst());
+  }
+  #endif
+  return(0);
+}
+
+int16_t ChannelMonitor::standby() {
+  #if !defined(RADIOLIB_EXCLUDE_SX128X)
+  if(_sx128x != NULL) {
+    return(_sx128x->standby());
+  }
+  #endif
+  #if !defined(RADIOLIB_EXCLUDE_SX126X)
+  if(_sx126x != NULL) {
+    return(_sx126x->standby());
+  }
+  #endif
+  return(RADIOLIB_ERR_NONE);
+}
+
+void ChannelMonitor::addSample(uint8_t index, float rssi) {
+  ChannelStats_t* ch = &_channels[index];
+
+  // halve the counters once history is full, so that the ratio follows changes in occupancy
+  if(ch->samples >= RADIOLIB_CHANNEL_MONITOR_HISTORY) {
+    ch->samples /= 2;
+    ch->busy /= 2;
+  }
+
+  if(ch->samples == 0) {
+    ch->rssiAvg = rssi;
+  } else {
+    ch->rssiAvg += RADIOLIB_CHANNEL_MONITOR_RSSI_ALPHA * (rssi - ch->rssiAvg);
+  }
+  if(rssi > ch->rssiMax) {
+    ch->rssiMax = rssi;
+  }
+
+  ch->samples++;
+  if(rssi > _threshold) {
+    ch->busy++;
+  }
+}
+
+#endif
@@ -0,0 +1,200 @@
+#if !defined(_RADIOLIB_CHANNEL_MONITOR_H)
+#define _RADIOLIB_CHANNEL_MONITOR_H
+
+#include "../../TypeDef.h"
+
+#if !defined(RADIOLIB_EXCLUDE_CHANNEL_MONITOR) && (!defined(RADIOLIB_EXCLUDE_SX128X) || !defined(RADIOLIB_EXCLUDE_SX126X))
+
+#if !defined(RADIOLIB_EXCLUDE_SX128X)
+  #include "../../modules/SX128x/SX128x.h"
+#endif
+#if !defined(RADIOLIB_EXCLUDE_SX126X)
+  #include "../../modules/SX126x/SX126x.h"
+#endif
+
+// maximum number of channels in the monitored channel plan
+#if !defined(RADIOLIB_CHANNEL_MONITOR_MAX_CHANNELS)
+  #define RADIOLIB_CHANNEL_MONITOR_MAX_CHANNELS                 (16)
+#endif
+
+// once a channel collects this many samples, its counters are halved so that old samples gradually lose weight
+#if !defined(RADIOLIB_CHANNEL_MONITOR_HISTORY)
+  #define RADIOLIB_CHANNEL_MONITOR_HISTORY                      (256)
+#endif
+
+// monitor defaults
+#define RADIOLIB_CHANNEL_MONITOR_DEFAULT_THRESHOLD              (-85.0)
+#define RADIOLIB_CHANNEL_MONITOR_DEFAULT_INTERVAL               (2)
+
+// weight of new sample in RSSI moving average
+#define RADIOLIB_CHANNEL_MONITOR_RSSI_ALPHA                     (0.125f)
+
+/*!
+  \struct ChannelStats_t
+
+  \brief Occupancy statistics of a single channel.
+*/
+struct ChannelStats_t {
+  /*!
+    \brief Carrier frequency in MHz.
+  */
+  float freq;
+
+  /*!
+    \brief Exponential moving average of instantaneous RSSI in dBm.
+  */
+  float rssiAvg;
+
+  /*!
+    \brief Highest instantaneous RSSI seen in dBm.
+  */
+  float rssiMax;
+
+  /*!
+    \brief Number of samples (decays once RADIOLIB_CHANNEL_MONITOR_HISTORY is reached).
+  */
+  uint16_t samples;
+
+  /*!
+    \brief Number of samples above busy threshold (decays together with samples).
+  */
+  uint16_t busy;
+};
+
+/*!
+  \class ChannelMonitor
+
+  \brief Background channel occupancy monitor for %SX128x and %SX126x modules.
+  Periodically samples instantaneous RSSI across a channel plan and keeps per-channel busy ratio,
+  so that the least loaded channel can be selected before a transfer.
+*/
+class ChannelMonitor {
+  public:
+#if !defined(RADIOLIB_EXCLUDE_SX128X)
+    /*!
+      \brief Constructor for %SX128x modules.
+
+      \param radio Pointer to the %SX128x module that will be used. Must be initialized in LoRa or GFSK mode.
+    */
+    explicit ChannelMonitor(SX128x* radio);
+#endif
+
+#if !defined(RADIOLIB_EXCLUDE_SX126X)
+    /*!
+      \brief Constructor for %SX126x modules.
+
+      \param radio Pointer to the %SX126x module that will be used. Must be initialized in LoRa or FSK mode.
+    */
+    explicit ChannelMonitor(SX126x* radio);
+#endif
+
+    // basic methods
+
+    /*!
+      \brief Initialization method. Sets channel plan and resets statistics.
+
+      \param freqs Array of carrier frequencies in MHz.
+
+      \param num Number of channels, up to RADIOLIB_CHANNEL_MONITOR_MAX_CHANNELS.
+
+      \param threshold RSSI threshold in dBm, samples above it are counted as busy. Defaults to -85 dBm.
+
+      \param interval Time between samples in ms, the radio dwells on each channel for this long before it is sampled. Defaults to 2 ms.
+
+      \returns \ref status_codes
+    */
+    int16_t begin(float* freqs, uint8_t num, float threshold = RADIOLIB_CHANNEL_MONITOR_DEFAULT_THRESHOLD, uint16_t interval = RADIOLIB_CHANNEL_MONITOR_DEFAULT_INTERVAL);
+
+    /*!
+      \brief Starts monitoring. The radio is kept in receive mode, hopping through the channel plan. Progress is driven by calling update.
+
+      \returns \ref status_codes
+    */
+    int16_t start();
+
+    /*!
+      \brief Stops monitoring and sets the radio to standby. Statistics are kept.
+
+      \returns \ref status_codes
+    */
+    int16_t stop();
+
+    /*!
+      \brief Takes a sample when it is due and hops to the next channel. Should be called as often as possible, e.g. from loop.
+
+      \returns \ref status_codes
+    */
+    int16_t update();
+
+    /*!
+      \brief Blocking scan, samples every channel the given number of times.
+
+      \param passes Number of passes through the channel plan.
+
+      \returns \ref status_codes
+    */
+    int16_t scan(uint16_t passes);
+
+    /*!
+      \brief Clears statistics of all channels.
+    */
+    void reset();
+
+    /*!
+      \brief Gets statistics of a channel.
+
+      \param index Index of the channel in the array passed to begin.
+
+      \param stats Pointer to structure to save the statistics.
+
+      \returns \ref status_codes
+    */
+    int16_t getStats(uint8_t index, ChannelStats_t* stats);
+
+    /*!
+      \brief Gets busy ratio of a channel.
+
+      \param index Index of the channel in the array passed to begin.
+
+      \returns Ratio of busy samples from 0.0 to 1.0, or 1.0 when the channel has not been sampled yet.
+    */
+    float getBusyRatio(uint8_t index);
+
+    /*!
+      \brief Finds the least loaded channel. Channels are compared by busy ratio first and average RSSI second.
+
+      \param freq Pointer to variable to save carrier frequency of the channel in MHz. Can be NULL.
+
+      \returns Index of the least loaded channel, or \ref status_codes if no channel has been sampled yet.
+    */
+    int16_t getLeastLoaded(float* freq = NULL);
+
+#if !defined(RADIOLIB_GODMODE)
+  private:
+#endif
+#if !defined(RADIOLIB_EXCLUDE_SX128X)
+    SX128x* _sx128x = NULL;
+#endif
+#if !defined(RADIOLIB_EXCLUDE_SX126X)
+    SX126x* _sx126x = NULL;
+#endif
+    Module* _mod = NULL;
+
+    ChannelStats_t _channels[RADIOLIB_CHANNEL_MONITOR_MAX_CHANNELS];
+    uint8_t _numChannels = 0;
+    float _threshold = RADIOLIB_CHANNEL_MONITOR_DEFAULT_THRESHOLD;
+    uint16_t _interval = RADIOLIB_CHANNEL_MONITOR_DEFAULT_INTERVAL;
+
+    bool _running = false;
+    uint8_t _current = 0;
+    uint32_t _tuned = 0;
+
+    int16_t tune(uint8_t index);
+    float getRSSIInst();
+    int16_t standby();
+    void addSample(uint8_t index, float rssi);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,303 @@
+#include "LinkQuality.h"
+#if !defined(RADIOLIB_EXCLUDE_LINK_QUALITY) && !defined(RADIOLIB_EXCLUDE_NRF24)
+
+LinkQualityClient::LinkQualityClient(nRF24* radio) {
+  _radio = radio;
+  _mod = radio->getMod();
+}
+
+int16_t LinkQualityClient::begin(int16_t* freqs, uint8_t num, uint16_t dwell) {
+  if(freqs == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if((num == 0) || (num > RADIOLIB_LINK_QUALITY_MAX_CHANNELS)) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  _numChannels = num;
+  for(uint8_t i = 0; i < num; i++) {
+    _channels[i].freq = freqs[i];
+  }
+  _dwell = dwell;
+  _numPeers = 0;
+  _activePeer = -1;
+  _hops = 0;
+  _following = false;
+  reset();
+
+  // force retransmission settings to be written on the first transmission
+  _retrDelay = 0;
+  _retrCount = 0;
+
+  return(tune(0));
+}
+
+int16_t LinkQualityClient::addPeer(uint8_t* addr) {
+  if(addr == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(_numPeers >= RADIOLIB_LINK_QUALITY_MAX_PEERS) {
+    return(RADIOLIB_ERR_PEER_TABLE_FULL);
+  }
+
+  memcpy(_peerAddr[_numPeers], addr, _radio->_addrWidth);
+  LinkPeerStats_t* p = &_peers[_numPeers];
+  memset(p, 0, sizeof(LinkPeerStats_t));
+  p->retrDelay = RADIOLIB_LINK_QUALITY_DEFAULT_RETR_DELAY;
+  if(p->retrDelay < _retrDelayMin) {
+    p->retrDelay = _retrDelayMin;
+  }
+  p->retrCount = RADIOLIB_LINK_QUALITY_DEFAULT_RETR_COUNT;
+  return(_numPeers++);
+}
+
+int16_t LinkQualityClient::transmit(uint8_t peer, uint8_t* data, size_t len) {
+  if(peer >= _numPeers) {
+    return(RADIOLIB_ERR_INVALID_PEER);
+  }
+  _following = false;
+
+  // switch destination only when it changes, it takes two address writes
+  int16_t state;
+  if(peer != _activePeer) {
+    state = _radio->setTransmitPipe(_peerAddr[peer]);
+    RADIOLIB_ASSERT(state);
+    _activePeer = peer;
+  }
+
+  // apply retransmission settings of this destination
+  LinkPeerStats_t* p = &_peers[peer];
+  if((p->retrDelay != _retrDelay) || (p->retrCount != _retrCount)) {
+    state = _radio->setAutoRetransmit(p->retrDelay, p->retrCount);
+    RADIOLIB_ASSERT(state);
+    _retrDelay = p->retrDelay;
+    _retrCount = p->retrCount;
+  }
+
+  // only acknowledged and unacknowledged packets say something about the link, other errors are passed through
+  state = _radio->transmit(data, len, 0);
+  if((state != RADIOLIB_ERR_NONE) && (state != RADIOLIB_ERR_ACK_NOT_RECEIVED)) {
+    return(state);
+  }
+
+  record(peer, state == RADIOLIB_ERR_NONE, _radio->getRetransmitCount());
+  return(state);
+}
+
+int16_t LinkQualityClient::startReceive() {
+  _following = true;
+  _lastEvent = _mod->millis();
+  return(_radio->startReceive());
+}
+
+int16_t LinkQualityClient::update() {
+  if(!_following || (_mod->millis() - _lastEvent < _dwell)) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  // leader went silent, look for it on the next channel
+  int16_t state = tune((_current + 1) % _numChannels);
+  RADIOLIB_ASSERT(state);
+  _hops++;
+  _lastEvent = _mod->millis();
+  return(_radio->startReceive());
+}
+
+int16_t LinkQualityClient::readData(uint8_t* data, size_t len) {
+  int16_t state = _radio->readData(data, len);
+  _lastEvent = _mod->millis();
+  RADIOLIB_ASSERT(state);
+
+  if(!_following) {
+    return(state);
+  }
+  return(_radio->startReceive());
+}
+
+int16_t LinkQualityClient::hop() {
+  // score every other channel by its loss history and carrier currently present on it
+  int16_t best = -1;
+  float bestScore = 0;
+  for(uint8_t i = 0; i < _numChannels; i++) {
+    if(i == _current) {
+      continue;
+    }
+
+    probe(i);
+    float score = _channels[i].lossRate + _channels[i].carrierRatio;
+    if((best < 0) || (score < bestScore)) {
+      best = i;
+      bestScore = score;
+    }
+
+    // abandoned channels slowly regain trust, so that they can be used again later
+    _channels[i].lossRate *= (1.0f - RADIOLIB_LINK_QUALITY_ALPHA);
+  }
+  if(best < 0) {
+    best = _current;
+  }
+
+  // move to the selected channel
+  int16_t state = tune(best);
+  RADIOLIB_ASSERT(state);
+  _hops++;
+  _lastEvent = _mod->millis();
+  return(state);
+}
+
+void LinkQualityClient::setAdaptive(bool enable) {
+  _adaptive = enable;
+}
+
+void LinkQualityClient::setHopThreshold(float threshold) {
+  _hopThreshold = threshold;
+}
+
+int16_t LinkQualityClient::setMinRetransmitDelay(uint16_t delay) {
+  if((delay < RADIOLIB_LINK_QUALITY_RETR_DELAY_STEP) || (delay > RADIOLIB_LINK_QUALITY_RETR_DELAY_MAX) || (delay % RADIOLIB_LINK_QUALITY_RETR_DELAY_STEP != 0)) {
+    return(RADIOLIB_ERR_INVALID_AUTO_RETRANSMIT);
+  }
+
+  _retrDelayMin = delay;
+  for(uint8_t i = 0; i < _numPeers; i++) {
+    if(_peers[i].retrDelay < delay) {
+      _peers[i].retrDelay = delay;
+    }
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t LinkQualityClient::getPeerStats(uint8_t peer, LinkPeerStats_t* stats) {
+  if(stats == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(peer >= _numPeers) {
+    return(RADIOLIB_ERR_INVALID_PEER);
+  }
+
+  memcpy(stats, &_peers[peer], sizeof(LinkPeerStats_t));
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t LinkQualityClient::getChannelStats(uint8_t index, LinkChannelStats_t* stats) {
+  if(stats == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(index >= _numChannels) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  memcpy(stats, &_channels[index], sizeof(LinkChannelStats_t));
+  return(RADIOLIB_ERR_NONE);
+}
+
+uint8_t LinkQualityClient::getChannel() {
+  return(_current);
+}
+
+uint16_t LinkQualityClient::getHopCount() {
+  return(_hops);
+}
+
+void LinkQualityClient::reset() {
+  for(uint8_t i = 0; i < _numPeers; i++) {
+    _peers[i].sent = 0;
+    _peers[i].lost = 0;
+    _peers[i].retransmits = 0;
+    _peers[i].retransmitAvg = 0;
+    _peers[i].lossRate = 0;
+  }
+  for(uint8_t i = 0; i < _numChannels; i++) {
+    _channels[i].sent = 0;
+    _channels[i].lost = 0;
+    _channels[i].lossRate = 0;
+    _channels[i].carrierRatio = 0;
+  }
+  _visitSamples = 0;
+}
+
+int16_t LinkQualityClient::tune(uint8_t index) {
+  int16_t state = _radio->setFrequency(_channels[index].freq);
+  RADIOLIB_ASSERT(state);
+  _current = index;
+  _visitSamples = 0;
+  return(state);
+}
+
+void LinkQualityClient::probe(uint8_t index) {
+  uint16_t hits = 0;
+  _radio->scanChannels(&hits, RADIOLIB_LINK_QUALITY_PROBE_SAMPLES, _channels[index].freq - 2400, 1);
+  _channels[index].carrierRatio = (float)hits / (float)RADIOLIB_LINK_QUALITY_PROBE_SAMPLES;
+}
+
+void LinkQualityClient::record(uint8_t peer, bool acked, uint8_t retransmits) {
+  LinkPeerStats_t* p = &_peers[peer];
+  float loss = acked ? 0 : 1;
+  p->sent++;
+  p->retransmits += retransmits;
+  if(!acked) {
+    p->lost++;
+  }
+  if(p->sent == 1) {
+    p->retransmitAvg = retransmits;
+    p->lossRate = loss;
+  } else {
+    p->retransmitAvg += RADIOLIB_LINK_QUALITY_ALPHA * ((float)retransmits - p->retransmitAvg);
+    p->lossRate += RADIOLIB_LINK_QUALITY_ALPHA * (loss - p->lossRate);
+  }
+
+  if(_adaptive) {
+    adapt(p);
+  }
+
+  // after a hop, followers need up to a full pass through the schedule to find the leader, losses in the meantime are expected
+  if((_hops > 0) && (_mod->millis() - _lastEvent < (uint32_t)_dwell * (_numChannels + 1))) {
+    return;
+  }
+
+  // a single unreachable destination says nothing about the channel, unless all of them are unreachable
+  if(!acked && (p->lossRate >= RADIOLIB_LINK_QUALITY_LINK_DOWN)) {
+    for(uint8_t i = 0; i < _numPeers; i++) {
+      if((_peers[i].sent > 0) && (_peers[i].lossRate < RADIOLIB_LINK_QUALITY_LINK_DOWN)) {
+        return;
+      }
+    }
+  }
+
+  LinkChannelStats_t* ch = &_channels[_current];
+  ch->sent++;
+  if(!acked) {
+    ch->lost++;
+  }
+  if(ch->sent == 1) {
+    ch->lossRate = loss;
+  } else {
+    ch->lossRate += RADIOLIB_LINK_QUALITY_ALPHA * (loss - ch->lossRate);
+  }
+  _visitSamples++;
+
+  if(_adaptive && (_numChannels > 1) && (_visitSamples >= RADIOLIB_LINK_QUALITY_MIN_SAMPLES) && (ch->lossRate > _hopThreshold)) {
+    hop();
+  }
+}
+
+void LinkQualityClient::adapt(LinkPeerStats_t* peer) {
+  // frequent retransmissions mean retries hit the same interference burst, so spread them out, otherwise save airtime
+  if((peer->retransmitAvg > RADIOLIB_LINK_QUALITY_RETR_HIGH) && (peer->retrDelay < RADIOLIB_LINK_QUALITY_RETR_DELAY_MAX)) {
+    peer->retrDelay += RADIOLIB_LINK_QUALITY_RETR_DELAY_STEP;
+  } else if((peer->retransmitAvg < RADIOLIB_LINK_QUALITY_RETR_LOW) && (peer->retrDelay > _retrDelayMin)) {
+    peer->retrDelay -= RADIOLIB_LINK_QUALITY_RETR_DELAY_STEP;
+  }
+
+  // keep some headroom above the usual number of retransmissions, but only probe a destination that seems to be gone
+  uint8_t count = RADIOLIB_LINK_QUALITY_RETR_COUNT_MIN;
+  if(peer->lossRate < RADIOLIB_LINK_QUALITY_LINK_DOWN) {
+    count = (uint8_t)(peer->retransmitAvg * 2.0f + 0.5f) + RADIOLIB_LINK_QUALITY_RETR_MARGIN;
+    if(count > RADIOLIB_LINK_QUALITY_RETR_COUNT_MAX) {
+      count = RADIOLIB_LINK_QUALITY_RETR_COUNT_MAX;
+    }
+  }
+  peer->retrCount = count;
+}
+
+#endif
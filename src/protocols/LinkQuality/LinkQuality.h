@@ -0,0 +1,321 @@
+#if !defined(_RADIOLIB_LINK_QUALITY_H)
+#define _RADIOLIB_LINK_QUALITY_H
+
+#include "../../TypeDef.h"
+
+#if !defined(RADIOLIB_EXCLUDE_LINK_QUALITY) && !defined(RADIOLIB_EXCLUDE_NRF24)
+
+#include "../../modules/nRF24/nRF24.h"
+
+// maximum number of destinations tracked
+#if !defined(RADIOLIB_LINK_QUALITY_MAX_PEERS)
+  #define RADIOLIB_LINK_QUALITY_MAX_PEERS                       (6)
+#endif
+
+// maximum number of channels in the hop schedule
+#if !defined(RADIOLIB_LINK_QUALITY_MAX_CHANNELS)
+  #define RADIOLIB_LINK_QUALITY_MAX_CHANNELS                    (16)
+#endif
+
+// number of received power detector samples taken on each candidate channel before hopping
+#if !defined(RADIOLIB_LINK_QUALITY_PROBE_SAMPLES)
+  #define RADIOLIB_LINK_QUALITY_PROBE_SAMPLES                   (8)
+#endif
+
+// controller defaults
+#define RADIOLIB_LINK_QUALITY_DEFAULT_DWELL                     (200)
+#define RADIOLIB_LINK_QUALITY_DEFAULT_HOP_THRESHOLD             (0.25f)
+#define RADIOLIB_LINK_QUALITY_DEFAULT_RETR_DELAY                (1500)
+#define RADIOLIB_LINK_QUALITY_DEFAULT_RETR_COUNT                (5)
+
+// weight of new sample in moving averages
+#define RADIOLIB_LINK_QUALITY_ALPHA                             (0.125f)
+
+// minimum number of transmissions on a channel before it can be abandoned
+#define RADIOLIB_LINK_QUALITY_MIN_SAMPLES                       (8)
+
+// average retransmission count limits for retransmit delay adjustment
+#define RADIOLIB_LINK_QUALITY_RETR_HIGH                         (1.5f)
+#define RADIOLIB_LINK_QUALITY_RETR_LOW                          (0.25f)
+
+// retransmission count headroom above the average, and loss rate above which the link is considered down
+#define RADIOLIB_LINK_QUALITY_RETR_MARGIN                       (3)
+#define RADIOLIB_LINK_QUALITY_LINK_DOWN                         (0.75f)
+
+// retransmission limits
+#define RADIOLIB_LINK_QUALITY_RETR_DELAY_STEP                   (250)
+#define RADIOLIB_LINK_QUALITY_RETR_DELAY_MAX                    (4000)
+#define RADIOLIB_LINK_QUALITY_RETR_COUNT_MIN                    (3)
+#define RADIOLIB_LINK_QUALITY_RETR_COUNT_MAX                    (15)
+
+/*!
+  \struct LinkPeerStats_t
+
+  \brief Link statistics of a single destination.
+*/
+struct LinkPeerStats_t {
+  /*!
+    \brief Number of packets sent.
+  */
+  uint32_t sent;
+
+  /*!
+    \brief Number of packets that were not acknowledged.
+  */
+  uint32_t lost;
+
+  /*!
+    \brief Total number of retransmissions.
+  */
+  uint32_t retransmits;
+
+  /*!
+    \brief Moving average of retransmissions per packet.
+  */
+  float retransmitAvg;
+
+  /*!
+    \brief Moving average of packet loss, from 0.0 to 1.0.
+  */
+  float lossRate;
+
+  /*!
+    \brief Retransmission delay currently used for this destination in us.
+  */
+  uint16_t retrDelay;
+
+  /*!
+    \brief Maximum retransmission count currently used for this destination.
+  */
+  uint8_t retrCount;
+};
+
+/*!
+  \struct LinkChannelStats_t
+
+  \brief Link statistics of a single channel in the hop schedule.
+*/
+struct LinkChannelStats_t {
+  /*!
+    \brief Carrier frequency in MHz.
+  */
+  int16_t freq;
+
+  /*!
+    \brief Number of packets sent on this channel.
+  */
+  uint32_t sent;
+
+  /*!
+    \brief Number of packets that were not acknowledged on this channel.
+  */
+  uint32_t lost;
+
+  /*!
+    \brief Moving average of packet loss, from 0.0 to 1.0.
+  */
+  float lossRate;
+
+  /*!
+    \brief Ratio of received power detector samples above -64 dBm in the last probe, from 0.0 to 1.0.
+  */
+  float carrierRatio;
+};
+
+/*!
+  \class LinkQualityClient
+
+  \brief Link quality controller for %nRF24 modules. Collects retransmission and loss statistics for each destination
+  and channel, adapts automatic retransmission delay and count per destination and hops to a cleaner channel
+  from a shared hop schedule when the current one degrades.
+
+  Hops are coordinated between a leader (transmitting side, uses transmit) and followers (receiving side,
+  use startReceive, update and readData). The leader picks the channel. A follower that has not received anything
+  for the dwell time moves to the next channel in the schedule, until it finds the leader again.
+*/
+class LinkQualityClient {
+  public:
+    /*!
+      \brief Default constructor.
+
+      \param radio Pointer to the %nRF24 module that will be used.
+    */
+    explicit LinkQualityClient(nRF24* radio);
+
+    // basic methods
+
+    /*!
+      \brief Initialization method. Sets hop schedule and tunes to its first channel. Must be the same on all nodes.
+
+      \param freqs Array of carrier frequencies in MHz.
+
+      \param num Number of channels, up to RADIOLIB_LINK_QUALITY_MAX_CHANNELS.
+
+      \param dwell Time in ms a follower waits for a packet before it moves to the next channel.
+      Must be longer than the interval between packets sent by the leader. Defaults to 200 ms.
+
+      \returns \ref status_codes
+    */
+    int16_t begin(int16_t* freqs, uint8_t num, uint16_t dwell = RADIOLIB_LINK_QUALITY_DEFAULT_DWELL);
+
+    /*!
+      \brief Adds destination to the peer table.
+
+      \param addr Destination address, its width must match the address width set in the radio.
+
+      \returns Index of the peer, or \ref status_codes if the table is full.
+    */
+    int16_t addPeer(uint8_t* addr);
+
+    /*!
+      \brief Blocking transmit to a peer. Updates statistics, adapts retransmission settings and hops when needed.
+
+      \param peer Index of the peer returned by addPeer.
+
+      \param data Binary data to be sent.
+
+      \param len Number of bytes to send.
+
+      \returns \ref status_codes
+    */
+    int16_t transmit(uint8_t peer, uint8_t* data, size_t len);
+
+    /*!
+      \brief Starts receiving as a follower.
+
+      \returns \ref status_codes
+    */
+    int16_t startReceive();
+
+    /*!
+      \brief Moves a follower to the next channel when nothing was received for the dwell time. Should be called as often as possible, e.g. from loop.
+
+      \returns \ref status_codes
+    */
+    int16_t update();
+
+    /*!
+      \brief Reads data received by a follower and restarts reception on the current channel.
+
+      \param data Pointer to array to save the received binary data.
+
+      \param len Number of bytes that will be read, 0 to read the whole packet.
+
+      \returns \ref status_codes
+    */
+    int16_t readData(uint8_t* data, size_t len);
+
+    /*!
+      \brief Leader only. Probes all channels in the hop schedule and moves to the best one.
+
+      \returns \ref status_codes
+    */
+    int16_t hop();
+
+    // configuration methods
+
+    /*!
+      \brief Enables or disables adaptation. When disabled, statistics are collected but retransmission settings and channel are kept.
+
+      \param enable Whether adaptation is enabled. Enabled by default.
+    */
+    void setAdaptive(bool enable);
+
+    /*!
+      \brief Sets loss rate above which the leader abandons the current channel.
+
+      \param threshold Loss rate from 0.0 to 1.0. Defaults to 0.25.
+    */
+    void setHopThreshold(float threshold);
+
+    /*!
+      \brief Sets the shortest retransmission delay the controller may use. Has to cover the ACK packet on air,
+      at least 500 us at 250 kbps or when ACK packets carry payload.
+
+      \param delay Retransmission delay in us. Defaults to 250 us.
+
+      \returns \ref status_codes
+    */
+    int16_t setMinRetransmitDelay(uint16_t delay);
+
+    // statistics
+
+    /*!
+      \brief Gets statistics of a peer.
+
+      \param peer Index of the peer returned by addPeer.
+
+      \param stats Pointer to structure to save the statistics.
+
+      \returns \ref status_codes
+    */
+    int16_t getPeerStats(uint8_t peer, LinkPeerStats_t* stats);
+
+    /*!
+      \brief Gets statistics of a channel.
+
+      \param index Index of the channel in the hop schedule.
+
+      \param stats Pointer to structure to save the statistics.
+
+      \returns \ref status_codes
+    */
+    int16_t getChannelStats(uint8_t index, LinkChannelStats_t* stats);
+
+    /*!
+      \brief Gets the channel currently in use.
+
+      \returns Index of the channel in the hop schedule.
+    */
+    uint8_t getChannel();
+
+    /*!
+      \brief Gets number of hops since begin.
+
+      \returns Number of hops.
+    */
+    uint16_t getHopCount();
+
+    /*!
+      \brief Clears statistics of all peers and channels. Retransmission settings are kept.
+    */
+    void reset();
+
+#if !defined(RADIOLIB_GODMODE)
+  private:
+#endif
+    nRF24* _radio;
+    Module* _mod;
+
+    uint8_t _peerAddr[RADIOLIB_LINK_QUALITY_MAX_PEERS][5];
+    LinkPeerStats_t _peers[RADIOLIB_LINK_QUALITY_MAX_PEERS];
+    uint8_t _numPeers = 0;
+    int16_t _activePeer = -1;
+
+    LinkChannelStats_t _channels[RADIOLIB_LINK_QUALITY_MAX_CHANNELS];
+    uint8_t _numChannels = 0;
+    uint8_t _current = 0;
+    uint8_t _visitSamples = 0;
+    uint16_t _hops = 0;
+
+    bool _adaptive = true;
+    float _hopThreshold = RADIOLIB_LINK_QUALITY_DEFAULT_HOP_THRESHOLD;
+    uint16_t _retrDelayMin = RADIOLIB_LINK_QUALITY_RETR_DELAY_STEP;
+    uint16_t _dwell = RADIOLIB_LINK_QUALITY_DEFAULT_DWELL;
+
+    // retransmission settings currently written in the radio
+    uint16_t _retrDelay = 0;
+    uint8_t _retrCount = 0;
+
+    bool _following = false;
+    uint32_t _lastEvent = 0;
+
+    int16_t tune(uint8_t index);
+    void probe(uint8_t index);
+    void record(uint8_t peer, bool acked, uint8_t retransmits);
+    void adapt(LinkPeerStats_t* peer);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,185 @@
+#include "MultiPipe.h"
+#if !defined(RADIOLIB_EXCLUDE_MULTI_PIPE) && !defined(RADIOLIB_EXCLUDE_NRF24)
+
+MultiPipeClient::MultiPipeClient(nRF24* radio) {
+  _radio = radio;
+}
+
+int16_t MultiPipeClient::begin(bool ackPayloads) {
+  // set mode to standby
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+
+  // dynamic payload length on all pipes (required for ACK payloads)
+  state = _radio->_mod->SPIsetRegValue(RADIOLIB_NRF24_REG_DYNPD, RADIOLIB_NRF24_DPL_ALL_ON, 5, 0);
+  RADIOLIB_ASSERT(state);
+  state = _radio->_mod->SPIsetRegValue(RADIOLIB_NRF24_REG_FEATURE, RADIOLIB_NRF24_DPL_ON, 2, 2);
+  RADIOLIB_ASSERT(state);
+
+  // payloads in ACK packets
+  state = _radio->_mod->SPIsetRegValue(RADIOLIB_NRF24_REG_FEATURE, ackPayloads ? RADIOLIB_NRF24_ACK_PAY_ON : RADIOLIB_NRF24_ACK_PAY_OFF, 1, 1);
+  RADIOLIB_ASSERT(state);
+  _ackPayloads = ackPayloads;
+
+  // clear queues
+  for(uint8_t i = 0; i < RADIOLIB_MULTI_PIPE_NUM_PIPES; i++) {
+    _head[i] = 0;
+    _count[i] = 0;
+    _dropped[i] = 0;
+  }
+  _seq = 0;
+
+  return(state);
+}
+
+int16_t MultiPipeClient::startReceive() {
+  // set mode to standby
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+
+  // enable primary Rx mode
+  state = _radio->_mod->SPIsetRegValue(RADIOLIB_NRF24_REG_CONFIG, RADIOLIB_NRF24_PRX, 0, 0);
+  RADIOLIB_ASSERT(state);
+
+  // enable Rx_DataReady interrupt only, TX_DS would fire for every sent ACK payload
+  _radio->clearIRQ();
+  state = _radio->_mod->SPIsetRegValue(RADIOLIB_NRF24_REG_CONFIG, RADIOLIB_NRF24_MASK_RX_DR_IRQ_ON, 6, 6);
+  RADIOLIB_ASSERT(state);
+
+  // flush Rx FIFO, preloaded ACK payloads are kept
+  _radio->SPItransfer(RADIOLIB_NRF24_CMD_FLUSH_RX);
+
+  // CE high to start receiving, it is kept high until stop
+  _radio->_mod->digitalWrite(_radio->_mod->getRst(), HIGH);
+
+  return(state);
+}
+
+int16_t MultiPipeClient::stop() {
+  _radio->_mod->digitalWrite(_radio->_mod->getRst(), LOW);
+  _radio->clearIRQ();
+  return(_radio->standby());
+}
+
+int16_t MultiPipeClient::update() {
+  // clear the flag first, packets received during draining will raise it again
+  _radio->_mod->SPIwriteRegister(RADIOLIB_NRF24_REG_STATUS, RADIOLIB_NRF24_RX_DR | RADIOLIB_NRF24_TX_DS);
+
+  // drain RX FIFO - new packets may arrive in the meantime, so allow a few more reads than FIFO depth
+  for(uint8_t i = 0; i < 2*RADIOLIB_NRF24_RX_FIFO_DEPTH; i++) {
+    // pipe number of the packet at the top of RX FIFO
+    uint8_t status = _radio->_mod->SPIreadRegister(RADIOLIB_NRF24_REG_STATUS);
+    uint8_t pipe = (status & RADIOLIB_NRF24_RX_P_NO_MASK) >> 1;
+    if(pipe >= RADIOLIB_MULTI_PIPE_NUM_PIPES) {
+      break;
+    }
+
+    // dynamic payload length, values above 32 mean corrupted packet and FIFO has to be flushed
+    uint8_t len = 0;
+    _radio->SPItransfer(RADIOLIB_NRF24_CMD_READ_RX_PAYLOAD_WIDTH, false, NULL, &len, 1);
+    if(len > RADIOLIB_NRF24_MAX_PACKET_LENGTH) {
+      _radio->SPItransfer(RADIOLIB_NRF24_CMD_FLUSH_RX);
+      break;
+    }
+
+    // read the packet directly into the queue, or discard it when there is no space
+    if(_count[pipe] < RADIOLIB_MULTI_PIPE_QUEUE_SIZE) {
+      MultiPipePacket_t* pkt = &_queue[pipe][(_head[pipe] + _count[pipe]) % RADIOLIB_MULTI_PIPE_QUEUE_SIZE];
+      _radio->SPIreadRxPayload(pkt->data, len);
+      pkt->len = len;
+      pkt->seq = _seq++;
+      _count[pipe]++;
+    } else {
+      uint8_t dummy[RADIOLIB_NRF24_MAX_PACKET_LENGTH];
+      _radio->SPIreadRxPayload(dummy, len);
+      _dropped[pipe]++;
+    }
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+uint8_t MultiPipeClient::available(uint8_t pipe) {
+  if(pipe >= RADIOLIB_MULTI_PIPE_NUM_PIPES) {
+    return(0);
+  }
+  return(_count[pipe]);
+}
+
+int16_t MultiPipeClient::read(uint8_t pipe, uint8_t* data, uint8_t* len) {
+  if(pipe >= RADIOLIB_MULTI_PIPE_NUM_PIPES) {
+    return(RADIOLIB_ERR_INVALID_PIPE_NUMBER);
+  }
+  if((data == NULL) || (len == NULL)) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(_count[pipe] == 0) {
+    return(RADIOLIB_ERR_QUEUE_EMPTY);
+  }
+
+  MultiPipePacket_t* pkt = &_queue[pipe][_head[pipe]];
+  memcpy(data, pkt->data, pkt->len);
+  *len = pkt->len;
+  _head[pipe] = (_head[pipe] + 1) % RADIOLIB_MULTI_PIPE_QUEUE_SIZE;
+  _count[pipe]--;
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t MultiPipeClient::readAny(uint8_t* pipe, uint8_t* data, uint8_t* len) {
+  if(pipe == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // find the pipe whose oldest packet was received first, sequence numbers may wrap around
+  int16_t oldest = -1;
+  uint16_t oldestAge = 0;
+  for(uint8_t i = 0; i < RADIOLIB_MULTI_PIPE_NUM_PIPES; i++) {
+    if(_count[i] == 0) {
+      continue;
+    }
+    uint16_t age = _seq - _queue[i][_head[i]].seq;
+    if((oldest < 0) || (age > oldestAge)) {
+      oldest = i;
+      oldestAge = age;
+    }
+  }
+
+  if(oldest < 0) {
+    return(RADIOLIB_ERR_QUEUE_EMPTY);
+  }
+  *pipe = oldest;
+  return(read(oldest, data, len));
+}
+
+int16_t MultiPipeClient::writeAckPayload(uint8_t pipe, uint8_t* data, uint8_t len) {
+  if(!_ackPayloads) {
+    return(RADIOLIB_ERR_INVALID_PAYLOAD);
+  }
+  if(pipe >= RADIOLIB_MULTI_PIPE_NUM_PIPES) {
+    return(RADIOLIB_ERR_INVALID_PIPE_NUMBER);
+  }
+  if(len > RADIOLIB_NRF24_MAX_PACKET_LENGTH) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // ACK payloads share TX FIFO
+  if(_radio->_mod->SPIreadRegister(RADIOLIB_NRF24_REG_FIFO_STATUS) & RADIOLIB_NRF24_TX_FIFO_FULL_FLAG) {
+    return(RADIOLIB_ERR_TX_FIFO_FULL);
+  }
+
+  _radio->SPItransfer(RADIOLIB_NRF24_CMD_WRITE_ACK_PAYLOAD | pipe, true, data, NULL, len);
+  return(RADIOLIB_ERR_NONE);
+}
+
+void MultiPipeClient::flushAckPayloads() {
+  _radio->SPItransfer(RADIOLIB_NRF24_CMD_FLUSH_TX);
+}
+
+uint16_t MultiPipeClient::getDropped(uint8_t pipe) {
+  if(pipe >= RADIOLIB_MULTI_PIPE_NUM_PIPES) {
+    return(0);
+  }
+  return(_dropped[pipe]);
+}
+
+#endif
@@ -0,0 +1,170 @@
+#if !defined(_RADIOLIB_MULTI_PIPE_H)
+#define _RADIOLIB_MULTI_PIPE_H
+
+#include "../../TypeDef.h"
+
+#if !defined(RADIOLIB_EXCLUDE_MULTI_PIPE) && !defined(RADIOLIB_EXCLUDE_NRF24)
+
+#include "../../modules/nRF24/nRF24.h"
+
+// number of packets buffered per pipe
+#if !defined(RADIOLIB_MULTI_PIPE_QUEUE_SIZE)
+  #define RADIOLIB_MULTI_PIPE_QUEUE_SIZE                        (3)
+#endif
+
+// nRF24 has 6 receive pipes
+#define RADIOLIB_MULTI_PIPE_NUM_PIPES                           (6)
+
+// pipe number reported in status register when RX FIFO is empty
+#define RADIOLIB_MULTI_PIPE_RX_FIFO_EMPTY                       (7)
+
+/*!
+  \struct MultiPipePacket_t
+
+  \brief Single packet buffered in a pipe queue.
+*/
+struct MultiPipePacket_t {
+  /*!
+    \brief Packet data.
+  */
+  uint8_t data[RADIOLIB_NRF24_MAX_PACKET_LENGTH];
+
+  /*!
+    \brief Packet length in bytes.
+  */
+  uint8_t len;
+
+  /*!
+    \brief Order of reception across all pipes.
+  */
+  uint16_t seq;
+};
+
+/*!
+  \class MultiPipeClient
+
+  \brief Receive engine for %nRF24 star networks. Stays in primary receive mode, drains the whole RX FIFO in one pass
+  and sorts packets into per-pipe queues. ACK payloads can be preloaded for each pipe.
+*/
+class MultiPipeClient {
+  public:
+    /*!
+      \brief Default constructor.
+
+      \param radio Pointer to the %nRF24 module that will be used. Receive pipes must be configured using nRF24::setReceivePipe.
+    */
+    explicit MultiPipeClient(nRF24* radio);
+
+    // basic methods
+
+    /*!
+      \brief Initialization method. Enables dynamic payload length on all pipes and clears all queues.
+
+      \param ackPayloads Set to true to enable payloads in ACK packets (writeAckPayload).
+
+      \returns \ref status_codes
+    */
+    int16_t begin(bool ackPayloads = false);
+
+    /*!
+      \brief Enters primary receive mode. The radio stays in receive mode until stop is called.
+      RX_DR interrupt is reflected on IRQ pin, update should be called when it activates.
+
+      \returns \ref status_codes
+    */
+    int16_t startReceive();
+
+    /*!
+      \brief Leaves receive mode and sets the radio to standby. Queued packets are kept.
+
+      \returns \ref status_codes
+    */
+    int16_t stop();
+
+    /*!
+      \brief Reads all packets waiting in RX FIFO and moves them to queues of the pipes they were received on.
+
+      \returns \ref status_codes
+    */
+    int16_t update();
+
+    /*!
+      \brief Gets number of packets waiting in pipe queue.
+
+      \param pipe Pipe number (0 - 5).
+
+      \returns Number of queued packets.
+    */
+    uint8_t available(uint8_t pipe);
+
+    /*!
+      \brief Gets the oldest packet received on a pipe.
+
+      \param pipe Pipe number (0 - 5).
+
+      \param data Buffer to save the packet, must be at least 32 bytes long.
+
+      \param len Pointer to variable to save packet length.
+
+      \returns \ref status_codes, RADIOLIB_ERR_QUEUE_EMPTY if there is no packet waiting.
+    */
+    int16_t read(uint8_t pipe, uint8_t* data, uint8_t* len);
+
+    /*!
+      \brief Gets the oldest packet received on any pipe.
+
+      \param pipe Pointer to variable to save pipe number.
+
+      \param data Buffer to save the packet, must be at least 32 bytes long.
+
+      \param len Pointer to variable to save packet length.
+
+      \returns \ref status_codes, RADIOLIB_ERR_QUEUE_EMPTY if there is no packet waiting.
+    */
+    int16_t readAny(uint8_t* pipe, uint8_t* data, uint8_t* len);
+
+    /*!
+      \brief Preloads payload to be sent with the next ACK on a pipe. Requires ACK payloads enabled in begin.
+      Up to 3 payloads can be waiting (TX FIFO is shared by all pipes).
+
+      \param pipe Pipe number (0 - 5).
+
+      \param data Payload data.
+
+      \param len Payload length, up to 32 bytes.
+
+      \returns \ref status_codes
+    */
+    int16_t writeAckPayload(uint8_t pipe, uint8_t* data, uint8_t len);
+
+    /*!
+      \brief Discards all ACK payloads that were not sent yet.
+    */
+    void flushAckPayloads();
+
+    /*!
+      \brief Gets number of packets dropped on a pipe because its queue was full.
+
+      \param pipe Pipe number (0 - 5).
+
+      \returns Number of dropped packets.
+    */
+    uint16_t getDropped(uint8_t pipe);
+
+#if !defined(RADIOLIB_GODMODE)
+  private:
+#endif
+    nRF24* _radio;
+
+    bool _ackPayloads = false;
+
+    MultiPipePacket_t _queue[RADIOLIB_MULTI_PIPE_NUM_PIPES][RADIOLIB_MULTI_PIPE_QUEUE_SIZE];
+    uint8_t _head[RADIOLIB_MULTI_PIPE_NUM_PIPES] = { 0 };
+    uint8_t _count[RADIOLIB_MULTI_PIPE_NUM_PIPES] = { 0 };
+    uint16_t _dropped[RADIOLIB_MULTI_PIPE_NUM_PIPES] = { 0 };
+    uint16_t _seq = 0;
+};
+
+#endif
+
+#endif
@@ -191,6 +191,20 @@ int16_t PhysicalLayer::receiveDirect() {
   return(RADIOLIB_ERR_UNSUPPORTED);
 }
 
+int16_t PhysicalLayer::transmitHdlc(uint8_t* data, size_t len, uint8_t preambleLen) {
+  (void)data;
+  (void)len;
+  (void)preambleLen;
+  return(RADIOLIB_ERR_UNSUPPORTED);
+}
+
+int16_t PhysicalLayer::transmitStream(size_t len, size_t (*fill)(void*, uint8_t*, size_t), void* ctx) {
+  (void)len;
+  (void)fill;
+  (void)ctx;
+  return(RADIOLIB_ERR_UNSUPPORTED);
+}
+
 int16_t PhysicalLayer::setFrequency(float freq) {
   (void)freq;
   return(RADIOLIB_ERR_UNSUPPORTED);
@@ -188,6 +188,36 @@ class PhysicalLayer {
     */
     virtual int16_t receiveDirect();
 
+    /*!
+      \brief Blocking transmit of a single HDLC frame, with flags, bit stuffing, FCS and NRZI encoding done by the module.
+      Only implemented by modules with hardware HDLC framing, others return RADIOLIB_ERR_UNSUPPORTED and the frame has to be encoded in software.
+
+      \param data Frame contents without flags and FCS, in transmission byte order with LSB of each byte sent first.
+
+      \param len Number of bytes to transmit.
+
+      \param preambleLen Number of flags to send before the frame.
+
+      \returns \ref status_codes
+    */
+    virtual int16_t transmitHdlc(uint8_t* data, size_t len, uint8_t preambleLen);
+
+    /*!
+      \brief Blocking transmit of data that is produced in small chunks while the module's FIFO is being refilled,
+      so that the whole packet never has to be kept in memory. Only implemented by modules with FIFO refill support,
+      others return RADIOLIB_ERR_UNSUPPORTED and the data has to be transmitted from a buffer.
+
+      \param len Total number of bytes to transmit.
+
+      \param fill Function that writes the next chunk of data. It is called with ctx, buffer and the number of bytes requested,
+      and returns the number of bytes written to the buffer. Missing bytes are sent as zeros.
+
+      \param ctx Arbitrary pointer passed to the fill function.
+
+      \returns \ref status_codes
+    */
+    virtual int16_t transmitStream(size_t len, size_t (*fill)(void*, uint8_t*, size_t), void* ctx);
+
     // configuration methods
 
     /*!
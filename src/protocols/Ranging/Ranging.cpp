@@ -0,0 +1,760 @@
+#include "Ranging.h"
+#if !defined(RADIOLIB_EXCLUDE_RANGING) && !defined(RADIOLIB_EXCLUDE_SX128X)
+
+const float RangingClient::calBandwidths[RADIOLIB_RANGING_CAL_NUM_BW] = { 406.25, 812.5, 1625.0 };
+
+RangingClient::RangingClient(SX1280* radio) {
+  _radio = radio;
+}
+
+int16_t RangingClient::begin(uint8_t exchanges, uint16_t timeout) {
+  if((exchanges == 0) || ((uint16_t)exchanges * (_numChannels > 0 ? _numChannels : 1) > RADIOLIB_RANGING_MAX_SAMPLES)) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  _exchanges = exchanges;
+  _timeout = timeout;
+  _state = RADIOLIB_RANGING_STATE_IDLE;
+  _finished = false;
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t RangingClient::setAnchors(uint32_t* addrs, uint8_t num) {
+  if(addrs == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if((num == 0) || (num > RADIOLIB_RANGING_MAX_ANCHORS)) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  memcpy(_anchors, addrs, num * sizeof(uint32_t));
+  _numAnchors = num;
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t RangingClient::setChannels(float* freqs, uint8_t num) {
+  // NULL means stay on the current frequency
+  if(freqs == NULL) {
+    _numChannels = 0;
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  if((num > RADIOLIB_RANGING_MAX_CHANNELS) || ((uint16_t)num * _exchanges > RADIOLIB_RANGING_MAX_SAMPLES)) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  for(uint8_t i = 0; i < num; i++) {
+    RADIOLIB_CHECK_RANGE(freqs[i], 2400.0, 2500.0, RADIOLIB_ERR_INVALID_FREQUENCY);
+  }
+
+  memcpy(_channels, freqs, num * sizeof(float));
+  _numChannels = num;
+  return(RADIOLIB_ERR_NONE);
+}
+
+void RangingClient::setCalibration(uint16_t calTable[3][6], float offsets[3][6]) {
+  _useCalTable = (calTable != NULL);
+  if(_useCalTable) {
+    memcpy(_calTable, calTable, sizeof(_calTable));
+  }
+
+  _useOffsets = (offsets != NULL);
+  if(_useOffsets) {
+    memcpy(_offsets, offsets, sizeof(_offsets));
+  }
+}
+
+int16_t RangingClient::startMaster() {
+  if(_numAnchors == 0) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  // reset all estimates from the previous session
+  for(uint8_t i = 0; i < _numAnchors; i++) {
+    _estimates[i].addr = _anchors[i];
+    _estimates[i].distance = 0;
+    _estimates[i].variance = 0;
+    _estimates[i].rssi = 0;
+    _estimates[i].numSamples = 0;
+    _estimates[i].numExchanges = 0;
+  }
+
+  _state = RADIOLIB_RANGING_STATE_MASTER;
+  _finished = false;
+  _slotPending = false;
+  _anchorIndex = 0;
+  _channelIndex = 0;
+  _exchangeIndex = 0;
+  _numSamples = 0;
+  _addr = _anchors[0];
+  return(startExchange());
+}
+
+int16_t RangingClient::startSlave(uint32_t addr) {
+  _state = RADIOLIB_RANGING_STATE_SLAVE;
+  _finished = false;
+  _synced = false;
+  _channelIndex = 0;
+  _exchangeIndex = 0;
+  _addr = addr;
+  return(startExchange());
+}
+
+int16_t RangingClient::update() {
+  if(_state == RADIOLIB_RANGING_STATE_IDLE) {
+    return(RADIOLIB_ERR_NONE);
+  }
+
+  Module* mod = _radio->_mod;
+  uint32_t elapsed = mod->millis() - _exchangeStart;
+  if(_slotPending) {
+    // master finished the exchange early, wait for the end of the slot so that the slave can follow by time
+    if(elapsed < _timeout) {
+      return(RADIOLIB_ERR_NONE);
+    }
+    _slotPending = false;
+    return(nextExchange());
+  }
+
+  if(!mod->digitalRead(mod->getIrq())) {
+    // exchange still in progress, check timeout
+    if(_state == RADIOLIB_RANGING_STATE_MASTER) {
+      if(elapsed < _timeout) {
+        return(RADIOLIB_ERR_NONE);
+      }
+
+      // slave did not respond at all, count it as a failed exchange
+      int16_t state = _radio->clearIrqStatus();
+      RADIOLIB_ASSERT(state);
+      return(nextExchange());
+    }
+
+    if(!_synced) {
+      // slave waits for the master on the first channel, listening is restarted after the whole channel window
+      if(elapsed < (uint32_t)_timeout * _exchanges) {
+        return(RADIOLIB_ERR_NONE);
+      }
+      return(startExchange());
+    }
+
+    // master moves on every timeout, switch halfway between its expected requests to stay on the same channel
+    if(elapsed < (uint32_t)_timeout + _timeout/2) {
+      return(RADIOLIB_ERR_NONE);
+    }
+    int16_t state = _radio->clearIrqStatus();
+    RADIOLIB_ASSERT(state);
+    uint32_t slotStart = _exchangeStart + _timeout;
+    state = nextExchange();
+    if(_synced) {
+      _exchangeStart = slotStart;
+    }
+    return(state);
+  }
+
+  // exchange finished, check how
+  uint16_t irq = _radio->getIrqStatus();
+  int16_t state = _radio->clearIrqStatus();
+  RADIOLIB_ASSERT(state);
+
+  if(_state == RADIOLIB_RANGING_STATE_SLAVE) {
+    // request received, the master slot started just now
+    _synced = (_numChannels > 0);
+    return(nextExchange());
+  }
+
+  if((irq & RADIOLIB_SX128X_IRQ_RANGING_MASTER_RES_VALID) && (_numSamples < RADIOLIB_RANGING_MAX_SAMPLES)) {
+    // RSSI must be read before getRangingResult switches to standby
+    _sampleRssi[_numSamples] = _radio->getRSSI();
+    _sampleDist[_numSamples] = _radio->getRangingResult() - getOffset();
+    _numSamples++;
+  }
+
+  // with channel plan, every exchange takes the whole slot
+  if(_numChannels > 0) {
+    _slotPending = true;
+    return(RADIOLIB_ERR_NONE);
+  }
+  return(nextExchange());
+}
+
+int16_t RangingClient::stop() {
+  _state = RADIOLIB_RANGING_STATE_IDLE;
+  int16_t state = _radio->clearIrqStatus();
+  RADIOLIB_ASSERT(state);
+  return(_radio->standby());
+}
+
+bool RangingClient::isFinished() {
+  return(_finished);
+}
+
+int16_t RangingClient::rangeAll() {
+  int16_t state = startMaster();
+  RADIOLIB_ASSERT(state);
+
+  while(!_finished) {
+    state = update();
+    if(state != RADIOLIB_ERR_NONE) {
+      stop();
+      return(state);
+    }
+    _radio->_mod->yield();
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t RangingClient::getEstimate(uint8_t index, RangingEstimate_t* est) {
+  if(est == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(index >= _numAnchors) {
+    return(RADIOLIB_ERR_ADDRESS_NOT_FOUND);
+  }
+
+  memcpy(est, &_estimates[index], sizeof(RangingEstimate_t));
+  if(est->numSamples == 0) {
+    return(RADIOLIB_ERR_RANGING_NO_RESULT);
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t RangingClient::measure(float bw, uint8_t sf, uint16_t cal, uint8_t exchanges, RangingEstimate_t* est) {
+  if(est == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if((_numAnchors == 0) || (exchanges == 0) || (exchanges > RADIOLIB_RANGING_MAX_SAMPLES)) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  // set the configuration to measure
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+  state = _radio->setBandwidth(bw);
+  RADIOLIB_ASSERT(state);
+  state = _radio->setSpreadingFactor(sf);
+  RADIOLIB_ASSERT(state);
+
+  // startRanging picks the table entry for the current configuration, so just fill all of them
+  uint16_t calTbl[3][6];
+  for(uint8_t i = 0; i < 3; i++) {
+    for(uint8_t j = 0; j < 6; j++) {
+      calTbl[i][j] = cal;
+    }
+  }
+
+  est->addr = _anchors[0];
+  est->numExchanges = 0;
+  _numSamples = 0;
+  uint32_t timeout = getCalibrationTimeout(bw, sf);
+  for(uint8_t i = 0; i < exchanges; i++) {
+    state = _radio->startRanging(true, _anchors[0], calTbl);
+    RADIOLIB_ASSERT(state);
+
+    uint16_t irq = 0;
+    state = waitForExchange(timeout, &irq);
+    RADIOLIB_ASSERT(state);
+    est->numExchanges++;
+
+    if(irq & RADIOLIB_SX128X_IRQ_RANGING_MASTER_RES_VALID) {
+      _sampleRssi[_numSamples] = _radio->getRSSI();
+      _sampleDist[_numSamples] = _radio->getRangingResult();
+      _numSamples++;
+    }
+  }
+
+  processSamples(est);
+  _numSamples = 0;
+  if(est->numSamples == 0) {
+    return(RADIOLIB_ERR_RANGING_NO_RESULT);
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t RangingClient::calibrate(float distance, uint16_t calTable[3][6], float measured[3][6], uint8_t exchanges) {
+  if(calTable == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // save the current configuration
+  uint8_t modem = _radio->getPacketType();
+  float bwOrig = _radio->_bwKhz;
+  uint8_t sfOrig = _radio->_sf >> 4;
+
+  int16_t state = RADIOLIB_ERR_NONE;
+  for(uint8_t b = 0; (b < RADIOLIB_RANGING_CAL_NUM_BW) && (state == RADIOLIB_ERR_NONE); b++) {
+    for(uint8_t s = 0; s < RADIOLIB_RANGING_CAL_NUM_SF; s++) {
+      float bw = calBandwidths[b];
+      uint8_t sf = s + 5;
+
+      // first pass with the initial value
+      RangingEstimate_t est;
+      uint16_t cal0 = calTable[b][s];
+      state = measure(bw, sf, cal0, exchanges, &est);
+      if(state != RADIOLIB_ERR_NONE) {
+        break;
+      }
+      float dist0 = est.distance;
+      if(measured != NULL) {
+        measured[b][s] = dist0;
+      }
+
+      // nominal step - one calibration LSB shifts the result by one raw result LSB
+      float lsb = 150.0f / (4.096f * bw);
+      uint16_t cal1 = toCalValue((float)cal0 + (dist0 - distance) / lsb);
+
+      // verification pass, the master and slave always do two passes to stay in sync
+      state = measure(bw, sf, cal1, exchanges, &est);
+      if(state != RADIOLIB_ERR_NONE) {
+        break;
+      }
+      float dist1 = est.distance;
+
+      // refine using the measured slope, in case the actual step differs from nominal
+      uint16_t calFinal = cal1;
+      if((cal1 != cal0) && (dist1 != dist0)) {
+        float slope = (dist1 - dist0) / ((float)cal1 - (float)cal0);
+        if(slope < 0) {
+          calFinal = toCalValue((float)cal1 + (dist1 - distance) / -slope);
+        }
+      }
+      calTable[b][s] = calFinal;
+    }
+  }
+
+  // restore configuration, but do not overwrite the error
+  int16_t restoreState = restoreConfig(modem, bwOrig, sfOrig);
+  RADIOLIB_ASSERT(state);
+  return(restoreState);
+}
+
+int16_t RangingClient::calibrateSlave(uint32_t addr, uint8_t exchanges) {
+  if(exchanges == 0) {
+    return(RADIOLIB_ERR_INVALID_NUM_SAMPLES);
+  }
+
+  // save the current configuration
+  uint8_t modem = _radio->getPacketType();
+  float bwOrig = _radio->_bwKhz;
+  uint8_t sfOrig = _radio->_sf >> 4;
+
+  int16_t state = RADIOLIB_ERR_NONE;
+  bool synced = false;
+  for(uint8_t b = 0; (b < RADIOLIB_RANGING_CAL_NUM_BW) && (state == RADIOLIB_ERR_NONE); b++) {
+    for(uint8_t s = 0; s < RADIOLIB_RANGING_CAL_NUM_SF; s++) {
+      float bw = calBandwidths[b];
+      uint8_t sf = s + 5;
+
+      state = _radio->standby();
+      if(state == RADIOLIB_ERR_NONE) {
+        state = _radio->setBandwidth(bw);
+      }
+      if(state == RADIOLIB_ERR_NONE) {
+        state = _radio->setSpreadingFactor(sf);
+      }
+      if(state != RADIOLIB_ERR_NONE) {
+        break;
+      }
+
+      // master does two passes per configuration, if it goes quiet for a whole pass it has already moved on
+      uint32_t timeout = getCalibrationTimeout(bw, sf) * exchanges;
+      uint16_t served = 0;
+      while(served < 2*(uint16_t)exchanges) {
+        state = _radio->startRanging(false, addr);
+        if(state != RADIOLIB_ERR_NONE) {
+          break;
+        }
+
+        // wait indefinitely for the very first request
+        uint16_t irq = 0;
+        state = waitForExchange(synced ? timeout : 0, &irq);
+        if(state != RADIOLIB_ERR_NONE) {
+          break;
+        }
+
+        if(irq & RADIOLIB_SX128X_IRQ_RANGING_SLAVE_RESP_DONE) {
+          served++;
+          synced = true;
+        } else {
+          break;
+        }
+      }
+
+      if(state != RADIOLIB_ERR_NONE) {
+        break;
+      }
+    }
+  }
+
+  int16_t restoreState = restoreConfig(modem, bwOrig, sfOrig);
+  RADIOLIB_ASSERT(state);
+  return(restoreState);
+}
+
+int16_t RangingClient::multilaterate(float anchors[][3], RangingEstimate_t* estimates, uint8_t num, float* pos, bool threeDim) {
+  if((anchors == NULL) || (estimates == NULL) || (pos == NULL)) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  // find the reference anchor (first valid) and check there are enough anchors
+  uint8_t dim = threeDim ? 3 : 2;
+  uint8_t numValid = 0;
+  uint8_t ref = 0;
+  for(uint8_t i = 0; i < num; i++) {
+    if(estimates[i].numSamples > 0) {
+      if(numValid == 0) {
+        ref = i;
+      }
+      numValid++;
+    }
+  }
+  if(numValid < dim + 1) {
+    return(RADIOLIB_ERR_RANGING_INVALID_GEOMETRY);
+  }
+
+  // linearize by subtracting the reference sphere equation:
+  // 2*(a_i - a_ref) . p = d_ref^2 - d_i^2 + |a_i|^2 - |a_ref|^2
+  float ata[3][3] = { { 0 } };
+  float atb[3] = { 0 };
+  float refNorm = 0;
+  for(uint8_t k = 0; k < dim; k++) {
+    refNorm += anchors[ref][k] * anchors[ref][k];
+  }
+  for(uint8_t i = 0; i < num; i++) {
+    if((i == ref) || (estimates[i].numSamples == 0)) {
+      continue;
+    }
+
+    float row[3];
+    float norm = 0;
+    for(uint8_t k = 0; k < dim; k++) {
+      row[k] = 2.0f * (anchors[i][k] - anchors[ref][k]);
+      norm += anchors[i][k] * anchors[i][k];
+    }
+    float rhs = estimates[ref].distance*estimates[ref].distance - estimates[i].distance*estimates[i].distance + norm - refNorm;
+    float w = 1.0f / (estimates[i].variance + estimates[ref].variance + RADIOLIB_RANGING_MIN_VARIANCE);
+
+    for(uint8_t r = 0; r < dim; r++) {
+      for(uint8_t c = 0; c < dim; c++) {
+        ata[r][c] += w * row[r] * row[c];
+      }
+      atb[r] += w * row[r] * rhs;
+    }
+  }
+
+  if(!solve(ata, atb, dim)) {
+    return(RADIOLIB_ERR_RANGING_INVALID_GEOMETRY);
+  }
+  pos[0] = atb[0];
+  pos[1] = atb[1];
+  pos[2] = threeDim ? atb[2] : 0;
+
+  // refine by Gauss-Newton on the actual range residuals
+  for(uint8_t iter = 0; iter < RADIOLIB_RANGING_SOLVER_MAX_ITER; iter++) {
+    float jtj[3][3] = { { 0 } };
+    float jtr[3] = { 0 };
+    for(uint8_t i = 0; i < num; i++) {
+      if(estimates[i].numSamples == 0) {
+        continue;
+      }
+
+      float diff[3];
+      float range = 0;
+      for(uint8_t k = 0; k < dim; k++) {
+        diff[k] = pos[k] - anchors[i][k];
+        range += diff[k] * diff[k];
+      }
+      range = sqrt(range);
+      if(range < RADIOLIB_RANGING_SOLVER_CONVERGENCE) {
+        // sitting right on top of an anchor, gradient is undefined
+        continue;
+      }
+
+      float res = range - estimates[i].distance;
+      float w = 1.0f / (estimates[i].variance + RADIOLIB_RANGING_MIN_VARIANCE);
+      for(uint8_t r = 0; r < dim; r++) {
+        float jr = diff[r] / range;
+        for(uint8_t c = 0; c < dim; c++) {
+          jtj[r][c] += w * jr * diff[c] / range;
+        }
+        jtr[r] -= w * jr * res;
+      }
+    }
+
+    if(!solve(jtj, jtr, dim)) {
+      // keep the linearized solution
+      break;
+    }
+
+    float step = 0;
+    for(uint8_t k = 0; k < dim; k++) {
+      pos[k] += jtr[k];
+      step += jtr[k] * jtr[k];
+    }
+    if(sqrt(step) < RADIOLIB_RANGING_SOLVER_CONVERGENCE) {
+      break;
+    }
+  }
+
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t RangingClient::startExchange() {
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+
+  // hop to the next channel when starting a new block of exchanges
+  if((_numChannels > 0) && (_exchangeIndex == 0)) {
+    state = _radio->setFrequency(_channels[_channelIndex]);
+    RADIOLIB_ASSERT(state);
+  }
+
+  state = _radio->startRanging(_state == RADIOLIB_RANGING_STATE_MASTER, _addr, _useCalTable ? _calTable : NULL);
+  _exchangeStart = _radio->_mod->millis();
+  return(state);
+}
+
+int16_t RangingClient::nextExchange() {
+  if(_state == RADIOLIB_RANGING_STATE_MASTER) {
+    _estimates[_anchorIndex].numExchanges++;
+  }
+
+  uint8_t numChannels = (_numChannels > 0) ? _numChannels : 1;
+  _exchangeIndex++;
+  if(_exchangeIndex < _exchanges) {
+    return(startExchange());
+  }
+
+  _exchangeIndex = 0;
+  _channelIndex++;
+  if(_channelIndex < numChannels) {
+    return(startExchange());
+  }
+
+  // slave just wraps around the channel plan, and waits for the next session on the first channel
+  _channelIndex = 0;
+  if(_state == RADIOLIB_RANGING_STATE_SLAVE) {
+    _synced = false;
+    return(startExchange());
+  }
+
+  // all channels done for this anchor
+  processSamples(&_estimates[_anchorIndex]);
+  _numSamples = 0;
+  _anchorIndex++;
+  if(_anchorIndex < _numAnchors) {
+    _addr = _anchors[_anchorIndex];
+    return(startExchange());
+  }
+
+  // session finished
+  _state = RADIOLIB_RANGING_STATE_IDLE;
+  _finished = true;
+  return(_radio->standby());
+}
+
+int16_t RangingClient::waitForExchange(uint32_t timeout, uint16_t* irq) {
+  Module* mod = _radio->_mod;
+  uint32_t start = mod->millis();
+  *irq = 0;
+  while(!mod->digitalRead(mod->getIrq())) {
+    mod->yield();
+    if((timeout > 0) && (mod->millis() - start > timeout)) {
+      int16_t state = _radio->clearIrqStatus();
+      RADIOLIB_ASSERT(state);
+      return(_radio->standby());
+    }
+  }
+
+  *irq = _radio->getIrqStatus();
+  return(_radio->clearIrqStatus());
+}
+
+uint32_t RangingClient::getCalibrationTimeout(float bw, uint8_t sf) {
+  // symbol duration in ms is 2^SF / BW in kHz
+  return(_timeout + (uint32_t)((float)RADIOLIB_RANGING_CAL_TIMEOUT_SYMBOLS * (float)((uint32_t)1 << sf) / bw));
+}
+
+int16_t RangingClient::restoreConfig(uint8_t modem, float bw, uint8_t sf) {
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+
+  if(modem != _radio->getPacketType()) {
+    state = _radio->setPacketType(modem);
+    RADIOLIB_ASSERT(state);
+  }
+
+  state = _radio->setBandwidth(bw);
+  RADIOLIB_ASSERT(state);
+  state = _radio->setSpreadingFactor(sf);
+  RADIOLIB_ASSERT(state);
+
+  // packet parameters must be set again after packet type change
+  return(_radio->setPacketParamsLoRa(_radio->_preambleLengthLoRa, _radio->_headerType, _radio->_payloadLen, _radio->_crcLoRa));
+}
+
+void RangingClient::processSamples(RangingEstimate_t* est) {
+  est->numSamples = 0;
+  if(_numSamples == 0) {
+    return;
+  }
+
+  // median of all samples
+  float sorted[RADIOLIB_RANGING_MAX_SAMPLES];
+  memcpy(sorted, _sampleDist, _numSamples * sizeof(float));
+  sort(sorted, _numSamples);
+  float med = median(sorted, _numSamples);
+
+  // median absolute deviation gives outlier window robust to multipath spikes
+  float maxRssi = _sampleRssi[0];
+  for(uint8_t i = 0; i < _numSamples; i++) {
+    sorted[i] = fabs(_sampleDist[i] - med);
+    if(_sampleRssi[i] > maxRssi) {
+      maxRssi = _sampleRssi[i];
+    }
+  }
+  sort(sorted, _numSamples);
+  float window = RADIOLIB_RANGING_OUTLIER_THRESHOLD * RADIOLIB_RANGING_MAD_SCALE * median(sorted, _numSamples);
+  if(window < RADIOLIB_RANGING_OUTLIER_MIN_WINDOW) {
+    window = RADIOLIB_RANGING_OUTLIER_MIN_WINDOW;
+  }
+
+  // RSSI-weighted mean of inliers, weight is signal amplitude relative to the strongest sample
+  float sumW = 0;
+  float sumWD = 0;
+  float sumRssi = 0;
+  uint8_t accepted = 0;
+  for(uint8_t i = 0; i < _numSamples; i++) {
+    if(fabs(_sampleDist[i] - med) > window) {
+      continue;
+    }
+    float w = pow(10.0f, (_sampleRssi[i] - maxRssi) / 20.0f);
+    sumW += w;
+    sumWD += w * _sampleDist[i];
+    sumRssi += _sampleRssi[i];
+    accepted++;
+  }
+  float mean = sumWD / sumW;
+
+  float sumWVar = 0;
+  for(uint8_t i = 0; i < _numSamples; i++) {
+    if(fabs(_sampleDist[i] - med) > window) {
+      continue;
+    }
+    float w = pow(10.0f, (_sampleRssi[i] - maxRssi) / 20.0f);
+    sumWVar += w * (_sampleDist[i] - mean) * (_sampleDist[i] - mean);
+  }
+
+  est->distance = mean;
+  est->variance = sumWVar / sumW;
+  est->rssi = sumRssi / accepted;
+  est->numSamples = accepted;
+}
+
+float RangingClient::getOffset() {
+  if(!_useOffsets) {
+    return(0);
+  }
+
+  // offsets are only calibrated for SF5 - SF10
+  uint8_t sf = _radio->_sf >> 4;
+  if((sf < 5) || (sf >= 5 + RADIOLIB_RANGING_CAL_NUM_SF)) {
+    return(0);
+  }
+
+  uint8_t index = sf - 5;
+  switch(_radio->_bw) {
+    case(RADIOLIB_SX128X_LORA_BW_406_25):
+      return(_offsets[0][index]);
+    case(RADIOLIB_SX128X_LORA_BW_812_50):
+      return(_offsets[1][index]);
+    case(RADIOLIB_SX128X_LORA_BW_1625_00):
+      return(_offsets[2][index]);
+  }
+  return(0);
+}
+
+void RangingClient::sort(float* arr, uint8_t len) {
+  // insertion sort, sample count is small
+  for(uint8_t i = 1; i < len; i++) {
+    float val = arr[i];
+    uint8_t j = i;
+    while((j > 0) && (arr[j - 1] > val)) {
+      arr[j] = arr[j - 1];
+      j--;
+    }
+    arr[j] = val;
+  }
+}
+
+float RangingClient::median(float* sorted, uint8_t len) {
+  if(len % 2) {
+    return(sorted[len / 2]);
+  }
+  return((sorted[len / 2 - 1] + sorted[len / 2]) / 2.0f);
+}
+
+uint16_t RangingClient::toCalValue(float val) {
+  if(val <= 0) {
+    return(0);
+  }
+  if(val >= 65535.0f) {
+    return(65535);
+  }
+  return((uint16_t)(val + 0.5f));
+}
+
+bool RangingClient::solve(float a[3][3], float* b, uint8_t n) {
+  // Gaussian elimination with partial pivoting, solution is returned in b
+  float scale = 0;
+  for(uint8_t i = 0; i < n; i++) {
+    if(fabs(a[i][i]) > scale) {
+      scale = fabs(a[i][i]);
+    }
+  }
+  if(scale == 0) {
+    return(false);
+  }
+
+  for(uint8_t col = 0; col < n; col++) {
+    uint8_t pivot = col;
+    for(uint8_t r = col + 1; r < n; r++) {
+      if(fabs(a[r][col]) > fabs(a[pivot][col])) {
+        pivot = r;
+      }
+    }
+    if(fabs(a[pivot][col]) < scale * 1e-6f) {
+      return(false);
+    }
+
+    if(pivot != col) {
+      for(uint8_t c = 0; c < n; c++) {
+        float tmp = a[col][c];
+        a[col][c] = a[pivot][c];
+        a[pivot][c] = tmp;
+      }
+      float tmp = b[col];
+      b[col] = b[pivot];
+      b[pivot] = tmp;
+    }
+
+    for(uint8_t r = col + 1; r < n; r++) {
+      float f = a[r][col] / a[col][col];
+      for(uint8_t c = col; c < n; c++) {
+        a[r][c] -= f * a[col][c];
+      }
+      b[r] -= f * b[col];
+    }
+  }
+
+  for(int8_t r = n - 1; r >= 0; r--) {
+    for(uint8_t c = r + 1; c < n; c++) {
+      b[r] -= a[r][c] * b[c];
+    }
+    b[r] /= a[r][r];
+  }
+
+  return(true);
+}
+
+#endif
@@ -0,0 +1,333 @@
+#if !defined(_RADIOLIB_RANGING_H)
+#define _RADIOLIB_RANGING_H
+
+#include "../../TypeDef.h"
+
+#if !defined(RADIOLIB_EXCLUDE_RANGING) && !defined(RADIOLIB_EXCLUDE_SX128X)
+
+#include "../../modules/SX128x/SX1280.h"
+
+// maximum number of anchors in a single ranging session
+#if !defined(RADIOLIB_RANGING_MAX_ANCHORS)
+  #define RADIOLIB_RANGING_MAX_ANCHORS                          (8)
+#endif
+
+// maximum number of channels in the channel plan
+#if !defined(RADIOLIB_RANGING_MAX_CHANNELS)
+  #define RADIOLIB_RANGING_MAX_CHANNELS                         (8)
+#endif
+
+// maximum number of ranging samples collected per anchor (channels * exchanges)
+#if !defined(RADIOLIB_RANGING_MAX_SAMPLES)
+  #define RADIOLIB_RANGING_MAX_SAMPLES                          (32)
+#endif
+
+// session defaults
+#define RADIOLIB_RANGING_DEFAULT_EXCHANGES                      (4)
+#define RADIOLIB_RANGING_DEFAULT_TIMEOUT                        (50)
+
+// outlier rejection - samples further than this many (scaled) median absolute deviations from median are dropped
+#define RADIOLIB_RANGING_OUTLIER_THRESHOLD                      (3.0f)
+
+// MAD to standard deviation scaling factor for normally distributed data
+#define RADIOLIB_RANGING_MAD_SCALE                              (1.4826f)
+
+// minimum outlier rejection window in meters, prevents discarding everything when most samples are identical
+#define RADIOLIB_RANGING_OUTLIER_MIN_WINDOW                     (1.0f)
+
+// variance floor in m^2 used when weighting anchors in position solver
+#define RADIOLIB_RANGING_MIN_VARIANCE                           (0.01f)
+
+// position solver iteration limit and convergence step in meters
+#define RADIOLIB_RANGING_SOLVER_MAX_ITER                        (10)
+#define RADIOLIB_RANGING_SOLVER_CONVERGENCE                     (0.001f)
+
+// calibration sweep - 3 bandwidths (406.25, 812.5 and 1625 kHz) and 6 spreading factors (SF5 - SF10)
+#define RADIOLIB_RANGING_CAL_NUM_BW                             (3)
+#define RADIOLIB_RANGING_CAL_NUM_SF                             (6)
+#define RADIOLIB_RANGING_CAL_DEFAULT_EXCHANGES                  (16)
+
+// number of symbols added to exchange timeout during calibration, to accommodate slow configurations (SF10 at 406.25 kHz)
+#define RADIOLIB_RANGING_CAL_TIMEOUT_SYMBOLS                    (64)
+
+// session states
+#define RADIOLIB_RANGING_STATE_IDLE                             (0x00)
+#define RADIOLIB_RANGING_STATE_MASTER                           (0x01)
+#define RADIOLIB_RANGING_STATE_SLAVE                            (0x02)
+
+/*!
+  \struct RangingEstimate_t
+
+  \brief Filtered distance estimate to a single anchor.
+*/
+struct RangingEstimate_t {
+  /*!
+    \brief Ranging address of the anchor.
+  */
+  uint32_t addr;
+
+  /*!
+    \brief Estimated distance in meters.
+  */
+  float distance;
+
+  /*!
+    \brief Variance of accepted samples in m^2.
+  */
+  float variance;
+
+  /*!
+    \brief Average RSSI of accepted samples in dBm.
+  */
+  float rssi;
+
+  /*!
+    \brief Number of samples that passed outlier rejection.
+  */
+  uint8_t numSamples;
+
+  /*!
+    \brief Number of exchanges attempted with this anchor.
+  */
+  uint8_t numExchanges;
+};
+
+/*!
+  \class RangingClient
+
+  \brief Client for multi-anchor ranging sessions with %SX1280 (and %SX1282) modules.
+  Runs multiple exchanges per anchor across a channel plan, filters the results and estimates position.
+*/
+class RangingClient {
+  public:
+    /*!
+      \brief Default constructor.
+
+      \param radio Pointer to the %SX1280 module that will perform ranging exchanges.
+    */
+    explicit RangingClient(SX1280* radio);
+
+    // basic methods
+
+    /*!
+      \brief Initialization method. The radio must already be initialized in LoRa mode (SX1280::begin).
+
+      \param exchanges Number of exchanges per anchor on each channel. Defaults to 4.
+
+      \param timeout Timeout of a single exchange in ms. With channel plan, every exchange takes the whole timeout, so that
+      a slave that missed a request can follow the master by time. Defaults to 50 ms.
+
+      \returns \ref status_codes
+    */
+    int16_t begin(uint8_t exchanges = RADIOLIB_RANGING_DEFAULT_EXCHANGES, uint16_t timeout = RADIOLIB_RANGING_DEFAULT_TIMEOUT);
+
+    /*!
+      \brief Sets addresses of anchors to range against in master mode.
+
+      \param addrs Array of anchor ranging addresses.
+
+      \param num Number of anchors, up to RADIOLIB_RANGING_MAX_ANCHORS.
+
+      \returns \ref status_codes
+    */
+    int16_t setAnchors(uint32_t* addrs, uint8_t num);
+
+    /*!
+      \brief Sets channel plan used for frequency diversity. Both master and slave must use the same plan.
+
+      \param freqs Array of carrier frequencies in MHz. Set to NULL to stay on the current frequency.
+
+      \param num Number of channels, up to RADIOLIB_RANGING_MAX_CHANNELS.
+
+      \returns \ref status_codes
+    */
+    int16_t setChannels(float* freqs, uint8_t num);
+
+    /*!
+      \brief Sets calibration for the current bandwidth and spreading factor.
+
+      \param calTable Ranging calibration table written to the radio, same format as in SX1280::range. Set to NULL to use the default.
+
+      \param offsets Residual distance offsets in meters subtracted from each raw result, indexed the same way as calTable. Set to NULL to disable.
+    */
+    void setCalibration(uint16_t calTable[3][6], float offsets[3][6] = NULL);
+
+    /*!
+      \brief Starts non-blocking ranging session in master mode against all configured anchors.
+      Progress is driven by calling update.
+
+      \returns \ref status_codes
+    */
+    int16_t startMaster();
+
+    /*!
+      \brief Starts non-blocking ranging session in slave mode. The slave keeps answering requests and following
+      the channel plan until stop is called. Progress is driven by calling update.
+
+      \param addr Ranging address of this anchor.
+
+      \returns \ref status_codes
+    */
+    int16_t startSlave(uint32_t addr);
+
+    /*!
+      \brief Processes ranging session. Should be called as often as possible, e.g. from loop or when DIO1 interrupt fires.
+
+      \returns \ref status_codes
+    */
+    int16_t update();
+
+    /*!
+      \brief Stops the ongoing session and sets the radio to standby.
+
+      \returns \ref status_codes
+    */
+    int16_t stop();
+
+    /*!
+      \brief Checks whether the last master session has finished.
+
+      \returns True if all anchors have been ranged, false otherwise.
+    */
+    bool isFinished();
+
+    /*!
+      \brief Blocking master session. Ranges all configured anchors on all channels.
+
+      \returns \ref status_codes
+    */
+    int16_t rangeAll();
+
+    /*!
+      \brief Gets filtered distance estimate of an anchor from the last master session.
+
+      \param index Index of the anchor in the array passed to setAnchors.
+
+      \param est Pointer to structure to save the estimate.
+
+      \returns \ref status_codes
+    */
+    int16_t getEstimate(uint8_t index, RangingEstimate_t* est);
+
+    /*!
+      \brief Blocking measurement with a fixed calibration value, used by calibrate.
+      Ranges the first configured anchor at the current frequency, the channel plan is not used.
+      Raw results are returned, residual offsets are not applied.
+
+      \param bw LoRa bandwidth in kHz, allowed values are 406.25, 812.5 and 1625.0 kHz.
+
+      \param sf LoRa spreading factor, allowed values range from 5 to 10.
+
+      \param cal Calibration value written to the radio.
+
+      \param exchanges Number of exchanges to perform, up to RADIOLIB_RANGING_MAX_SAMPLES.
+
+      \param est Pointer to structure to save the filtered result.
+
+      \returns \ref status_codes
+    */
+    int16_t measure(float bw, uint8_t sf, uint16_t cal, uint8_t exchanges, RangingEstimate_t* est);
+
+    /*!
+      \brief Generates ranging calibration table for this pair of modules. Sweeps all bandwidth and spreading factor combinations,
+      measures the first configured anchor placed at a known distance and adjusts calibration values until the result matches.
+      The anchor must call calibrateSlave with the same number of exchanges. Bandwidth and spreading factor are restored afterwards.
+
+      \param distance Reference distance between the modules in meters.
+
+      \param calTable Calibration table to be filled, same format as in SX1280::range. Must contain the initial values (e.g. defaults from AN1200.29).
+
+      \param measured Optional array to save distance measured with the initial calibration value for each configuration,
+      can be logged and processed by extras/ranging/RangingCalibration.py. Set to NULL to skip.
+
+      \param exchanges Number of exchanges per measurement. Defaults to 16.
+
+      \returns \ref status_codes
+    */
+    int16_t calibrate(float distance, uint16_t calTable[3][6], float measured[3][6] = NULL, uint8_t exchanges = RADIOLIB_RANGING_CAL_DEFAULT_EXCHANGES);
+
+    /*!
+      \brief Blocking slave counterpart of calibrate. Follows the master through the bandwidth and spreading factor sweep.
+
+      \param addr Ranging address of this anchor.
+
+      \param exchanges Number of exchanges per measurement, must match the master. Defaults to 16.
+
+      \returns \ref status_codes
+    */
+    int16_t calibrateSlave(uint32_t addr, uint8_t exchanges = RADIOLIB_RANGING_CAL_DEFAULT_EXCHANGES);
+
+    /*!
+      \brief Weighted least-squares multilateration. Initial position is found by linearization,
+      then refined by Gauss-Newton iterations. Anchors are weighted by the inverse of estimate variance.
+
+      \param anchors Anchor positions in meters as {x, y, z}, in the same order as estimates.
+
+      \param estimates Distance estimates, anchors without valid samples are skipped.
+
+      \param num Number of anchors.
+
+      \param pos Array of 3 floats to save the solved position. In 2D mode, z is set to 0.
+
+      \param threeDim Set to true to solve 3D position (requires 4 anchors), false for 2D (requires 3 anchors).
+
+      \returns \ref status_codes
+    */
+    static int16_t multilaterate(float anchors[][3], RangingEstimate_t* estimates, uint8_t num, float* pos, bool threeDim = false);
+
+#if !defined(RADIOLIB_GODMODE)
+  private:
+#endif
+    SX1280* _radio;
+
+    // session configuration
+    uint32_t _anchors[RADIOLIB_RANGING_MAX_ANCHORS] = { 0 };
+    uint8_t _numAnchors = 0;
+    float _channels[RADIOLIB_RANGING_MAX_CHANNELS] = { 0 };
+    uint8_t _numChannels = 0;
+    uint8_t _exchanges = RADIOLIB_RANGING_DEFAULT_EXCHANGES;
+    uint16_t _timeout = RADIOLIB_RANGING_DEFAULT_TIMEOUT;
+
+    // calibration
+    uint16_t _calTable[3][6];
+    float _offsets[3][6];
+    bool _useCalTable = false;
+    bool _useOffsets = false;
+
+    // session state
+    uint8_t _state = RADIOLIB_RANGING_STATE_IDLE;
+    bool _finished = false;
+    uint32_t _addr = 0;
+    uint8_t _anchorIndex = 0;
+    uint8_t _channelIndex = 0;
+    uint8_t _exchangeIndex = 0;
+    uint32_t _exchangeStart = 0;
+    bool _slotPending = false;
+    bool _synced = false;
+
+    // samples for the current anchor
+    float _sampleDist[RADIOLIB_RANGING_MAX_SAMPLES];
+    float _sampleRssi[RADIOLIB_RANGING_MAX_SAMPLES];
+    uint8_t _numSamples = 0;
+
+    RangingEstimate_t _estimates[RADIOLIB_RANGING_MAX_ANCHORS];
+
+    static const float calBandwidths[RADIOLIB_RANGING_CAL_NUM_BW];
+
+    int16_t startExchange();
+    int16_t waitForExchange(uint32_t timeout, uint16_t* irq);
+    uint32_t getCalibrationTimeout(float bw, uint8_t sf);
+    int16_t restoreConfig(uint8_t modem, float bw, uint8_t sf);
+    int16_t nextExchange();
+    void processSamples(RangingEstimate_t* est);
+    float getOffset();
+
+    static void sort(float* arr, uint8_t len);
+    static float median(float* sorted, uint8_t len);
+    static bool solve(float a[3][3], float* b, uint8_t n);
+    static uint16_t toCalValue(float val);
+};
+
+#endif
+
+#endif
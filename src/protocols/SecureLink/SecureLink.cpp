@@ -0,0 +1,659 @@
+#include "SecureLink.h"
+#if !defined(RADIOLIB_EXCLUDE_SECURE_LINK) && !defined(RADIOLIB_EXCLUDE_RF69)
+
+SecureLinkClient::SecureLinkClient(RF69* radio) {
+  _radio = radio;
+  _mod = radio->getMod();
+}
+
+int16_t SecureLinkClient::begin(uint8_t addr, bool hardwareAES) {
+  // counter starting from the same value after every restart would repeat the key stream
+  if(_txCounter == 0) {
+    return(RADIOLIB_ERR_TX_COUNTER_NOT_SET);
+  }
+
+  int16_t state = _radio->standby();
+  RADIOLIB_ASSERT(state);
+
+  // variable length packets up to 255 bytes, longer than FIFO - setPacketMode only allows 64 bytes
+  state = _mod->SPIsetRegValue(RADIOLIB_RF69_REG_PACKET_CONFIG_1, RADIOLIB_RF69_PACKET_FORMAT_VARIABLE, 7, 7);
+  RADIOLIB_ASSERT(state);
+  state = _mod->SPIsetRegValue(RADIOLIB_RF69_REG_PAYLOAD_LENGTH, RADIOLIB_SECURE_LINK_MAX_FRAME_LENGTH);
+  RADIOLIB_ASSERT(state);
+  _radio->_packetLengthConfig = RADIOLIB_RF69_PACKET_FORMAT_VARIABLE;
+
+  // addresses are part of the encrypted header
+  state = _radio->disableAddressFiltering();
+  RADIOLIB_ASSERT(state);
+
+  // hardware AES is only enabled for the duration of a short transmission
+  state = _radio->disableAES();
+  RADIOLIB_ASSERT(state);
+
+  _addr = addr;
+  _hardwareAES = hardwareAES;
+  _numPeers = 0;
+  _hwKeyPeer = -1;
+  return(state);
+}
+
+int16_t SecureLinkClient::addPeer(uint8_t addr, uint8_t* key) {
+  if(key == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(_numPeers >= RADIOLIB_SECURE_LINK_MAX_PEERS) {
+    return(RADIOLIB_ERR_PEER_TABLE_FULL);
+  }
+
+  SecureLinkPeer_t* p = &_peers[_numPeers];
+  memset(p, 0, sizeof(SecureLinkPeer_t));
+  p->addr = addr;
+  memcpy(p->key, key, 16);
+  return(_numPeers++);
+}
+
+int16_t SecureLinkClient::rotateKey(uint8_t peer, uint8_t* key) {
+  if(key == NULL) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+  if(peer >= _numPeers) {
+    return(RADIOLIB_ERR_INVALID_PEER);
+  }
+
+  SecureLinkPeer_t* p = &_peers[peer];
+  memcpy(p->prevKey, p->key, 16);
+  memcpy(p->key, key, 16);
+  p->keyId++;
+  p->prevValid = true;
+  if(_hwKeyPeer == peer) {
+    _hwKeyPeer = -1;
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t SecureLinkClient::transmit(uint8_t peer, uint8_t* data, size_t len) {
+  if(peer >= _numPeers) {
+    return(RADIOLIB_ERR_INVALID_PEER);
+  }
+  if(len > RADIOLIB_SECURE_LINK_MAX_PAYLOAD_LENGTH) {
+    return(RADIOLIB_ERR_PACKET_TOO_LONG);
+  }
+
+  // counter is consumed even if the transmission fails, it must never repeat with the same key
+  // wrapping around to 0 means all values were used up
+  if(_txCounter == 0) {
+    return(RADIOLIB_ERR_TX_COUNTER_NOT_SET);
+  }
+  uint32_t counter = _txCounter++;
+
+  uint8_t header[RADIOLIB_SECURE_LINK_HEADER_LEN];
+  header[RADIOLIB_SECURE_LINK_HEADER_SRC] = _addr;
+  header[RADIOLIB_SECURE_LINK_HEADER_DST] = _peers[peer].addr;
+  header[RADIOLIB_SECURE_LINK_HEADER_KEY_ID] = _peers[peer].keyId;
+  header[RADIOLIB_SECURE_LINK_HEADER_COUNTER] = (uint8_t)(counter >> 24);
+  header[RADIOLIB_SECURE_LINK_HEADER_COUNTER + 1] = (uint8_t)(counter >> 16);
+  header[RADIOLIB_SECURE_LINK_HEADER_COUNTER + 2] = (uint8_t)(counter >> 8);
+  header[RADIOLIB_SECURE_LINK_HEADER_COUNTER + 3] = (uint8_t)counter;
+
+  // short frames carry payload length in the encrypted header, long frames use packet length
+  if(len <= RADIOLIB_SECURE_LINK_MAX_SHORT_PAYLOAD_LENGTH) {
+    header[RADIOLIB_SECURE_LINK_HEADER_LEN_FLAGS] = len;
+    return(transmitShort(peer, header, data, len));
+  }
+  header[RADIOLIB_SECURE_LINK_HEADER_LEN_FLAGS] = RADIOLIB_SECURE_LINK_FLAG_CTR;
+  return(transmitLong(peer, header, data, len));
+}
+
+int16_t SecureLinkClient::receive(uint8_t* data, size_t* len, uint8_t* peer, uint32_t timeout) {
+  if((data == NULL) || (len == NULL)) {
+    return(RADIOLIB_ERR_NULL_POINTER);
+  }
+
+  uint8_t frame[RADIOLIB_RF69_MAX_PACKET_LENGTH];
+  uint32_t start = _mod->millis();
+  while(true) {
+    uint32_t elapsed = _mod->millis() - start;
+    if(elapsed >= timeout) {
+      return(RADIOLIB_ERR_RX_TIMEOUT);
+    }
+
+    // broken frames are skipped, the radio only reports packets with valid CRC
+    size_t frameLen = 0;
+    int16_t state = receiveFrame(frame, data, &frameLen, timeout - elapsed);
+    if(state == RADIOLIB_ERR_RX_TIMEOUT) {
+      return(state);
+    } else if(state != RADIOLIB_ERR_NONE) {
+      continue;
+    }
+
+    if(frameLen <= RADIOLIB_RF69_MAX_PACKET_LENGTH) {
+      state = openShort(frame, frameLen, data, len, peer);
+    } else {
+      *len = frameLen - RADIOLIB_SECURE_LINK_HEADER_LEN - RADIOLIB_SECURE_LINK_MAC_LEN;
+      state = openLong(frame, data, *len, peer);
+    }
+
+    // frames for other nodes or from unknown peers are not reported
+    if(state != RADIOLIB_ERR_INVALID_PEER) {
+      return(state);
+    }
+  }
+}
+
+uint32_t SecureLinkClient::getTxCounter() {
+  return(_txCounter);
+}
+
+void SecureLinkClient::setTxCounter(uint32_t counter) {
+  _txCounter = counter;
+}
+
+uint8_t SecureLinkClient::getKeyId(uint8_t peer) {
+  if(peer >= _numPeers) {
+    return(0);
+  }
+  return(_peers[peer].keyId);
+}
+
+int16_t SecureLinkClient::transmitShort(uint8_t peer, uint8_t* header, uint8_t* data, size_t len) {
+  // pad to whole blocks, so that hardware and software encryption produce the same packet
+  uint8_t frame[RADIOLIB_RF69_MAX_PACKET_LENGTH];
+  size_t frameLen = ((RADIOLIB_SECURE_LINK_HEADER_LEN + len + RADIOLIB_SECURE_LINK_BLOCK_LEN - 1) / RADIOLIB_SECURE_LINK_BLOCK_LEN) * RADIOLIB_SECURE_LINK_BLOCK_LEN;
+  memcpy(frame, header, RADIOLIB_SECURE_LINK_HEADER_LEN);
+  memcpy(&frame[RADIOLIB_SECURE_LINK_HEADER_LEN], data, len);
+  memset(&frame[RADIOLIB_SECURE_LINK_HEADER_LEN + len], 0x00, frameLen - RADIOLIB_SECURE_LINK_HEADER_LEN - len);
+
+  if(!_hardwareAES) {
+    uint8_t roundKeys[RADIOLIB_SECURE_LINK_AES_ROUND_KEYS_LEN];
+    expandKey(_peers[peer].key, roundKeys);
+    for(size_t i = 0; i < frameLen; i += RADIOLIB_SECURE_LINK_BLOCK_LEN) {
+      encryptBlock(roundKeys, &frame[i]);
+    }
+    return(_radio->transmit(frame, frameLen));
+  }
+
+  // key registers are only written when the destination changes
+  if(_hwKeyPeer != peer) {
+    _radio->setAESKey(_peers[peer].key);
+    _hwKeyPeer = peer;
+  }
+
+  int16_t state = _radio->enableAES();
+  RADIOLIB_ASSERT(state);
+  state = _radio->transmit(frame, frameLen);
+
+  // always leave hardware AES disabled, received frames are decrypted in software
+  int16_t aes = _radio->disableAES();
+  RADIOLIB_ASSERT(state);
+  return(aes);
+}
+
+int16_t SecureLinkClient::transmitLong(uint8_t peer, uint8_t* header, uint8_t* data, size_t len) {
+  int16_t state = _radio->setMode(RADIOLIB_RF69_STANDBY);
+  RADIOLIB_ASSERT(state);
+  _radio->clearIRQFlags();
+
+  // start transmitting as soon as there is something in FIFO, FifoLevel is then used to refill it
+  state = _mod->SPIsetRegValue(RADIOLIB_RF69_REG_FIFO_THRESH, RADIOLIB_RF69_TX_START_CONDITION_FIFO_NOT_EMPTY | RADIOLIB_RF69_FIFO_THRESH, 7, 0);
+  RADIOLIB_ASSERT(state);
+
+  uint8_t roundKeys[RADIOLIB_SECURE_LINK_AES_ROUND_KEYS_LEN];
+  uint8_t macRoundKeys[RADIOLIB_SECURE_LINK_AES_ROUND_KEYS_LEN];
+  expandKey(_peers[peer].key, roundKeys);
+  macKey(roundKeys, macRoundKeys);
+
+  // length and header are sent in plaintext, but are covered by the MAC
+  uint8_t mac[RADIOLIB_SECURE_LINK_BLOCK_LEN] = { 0 };
+  size_t macPos = 0;
+  macUpdate(macRoundKeys, mac, &macPos, header, RADIOLIB_SECURE_LINK_HEADER_LEN);
+  _mod->SPIwriteRegister(RADIOLIB_RF69_REG_FIFO, RADIOLIB_SECURE_LINK_HEADER_LEN + len + RADIOLIB_SECURE_LINK_MAC_LEN);
+  _mod->SPIwriteRegisterBurst(RADIOLIB_RF69_REG_FIFO, header, RADIOLIB_SECURE_LINK_HEADER_LEN);
+
+  // fill FIFO up to the packet limit before transmission starts, then refill one chunk each time level drops below threshold
+  uint8_t keyStream[RADIOLIB_SECURE_LINK_BLOCK_LEN];
+  uint8_t chunk[RADIOLIB_SECURE_LINK_FIFO_CHUNK];
+  size_t sent = 0;
+  size_t total = len + RADIOLIB_SECURE_LINK_MAC_LEN;
+  size_t fill = RADIOLIB_RF69_MAX_PACKET_LENGTH - 1 - RADIOLIB_SECURE_LINK_HEADER_LEN;
+  bool started = false;
+  uint32_t timeout = 5000 + (uint32_t)((((float)((total + RADIOLIB_SECURE_LINK_HEADER_LEN) * 8)) / (_radio->_br * 1000.0)) * 5000000.0);
+  uint32_t start = _mod->micros();
+  while(sent < total) {
+    if(!started || !(_mod->SPIreadRegister(RADIOLIB_RF69_REG_IRQ_FLAGS_2) & RADIOLIB_RF69_IRQ_FIFO_LEVEL)) {
+      size_t num = total - sent;
+      if(num > RADIOLIB_SECURE_LINK_FIFO_CHUNK) {
+        num = RADIOLIB_SECURE_LINK_FIFO_CHUNK;
+      }
+      if(!started && (num > fill - sent)) {
+        num = fill - sent;
+      }
+
+      // encrypt the chunk, next key stream block is generated at each block boundary
+      size_t encNum = (sent < len) ? len - sent : 0;
+      if(encNum > num) {
+        encNum = num;
+      }
+      for(size_t i = 0; i < encNum; i++) {
+        size_t pos = sent + i;
+        if(pos % RADIOLIB_SECURE_LINK_BLOCK_LEN == 0) {
+          counterBlock(header, pos / RADIOLIB_SECURE_LINK_BLOCK_LEN, keyStream);
+          encryptBlock(roundKeys, keyStream);
+        }
+        chunk[i] = data[pos] ^ keyStream[pos % RADIOLIB_SECURE_LINK_BLOCK_LEN];
+      }
+      macUpdate(macRoundKeys, mac, &macPos, chunk, encNum);
+
+      // MAC is appended once the whole payload is encrypted
+      if((encNum > 0) && (sent + encNum == len)) {
+        macFinish(macRoundKeys, mac, macPos);
+      }
+      for(size_t i = encNum; i < num; i++) {
+        chunk[i] = mac[sent + i - len];
+      }
+      _mod->SPIwriteRegisterBurst(RADIOLIB_RF69_REG_FIFO, chunk, num);
+      sent += num;
+    }
+
+    if(!started && ((sent >= fill) || (sent >= total))) {
+      // enable +20 dBm operation
+      if(_radio->_power > 17) {
+        state = _mod->SPIsetRegValue(RADIOLIB_RF69_REG_OCP, RADIOLIB_RF69_OCP_OFF | 0x0F);
+        state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_TEST_PA1, RADIOLIB_RF69_PA1_20_DBM);
+        state |= _mod->SPIsetRegValue(RADIOLIB_RF69_REG_TEST_PA2, RADIOLIB_RF69_PA2_20_DBM);
+        RADIOLIB_ASSERT(state);
+      }
+
+      // set RF switch (if present)
+      _mod->setRfSwitchState(LOW, HIGH);
+
+      state = _radio->setMode(RADIOLIB_RF69_TX);
+      RADIOLIB_ASSERT(state);
+      started = true;
+      start = _mod->micros();
+    }
+
+    if(_mod->micros() - start > timeout) {
+      _radio->finishTransmit();
+      return(RADIOLIB_ERR_TX_TIMEOUT);
+    }
+  }
+
+  // wait for the rest of the packet
+  while(!(_mod->SPIreadRegister(RADIOLIB_RF69_REG_IRQ_FLAGS_2) & RADIOLIB_RF69_IRQ_PACKET_SENT)) {
+    _mod->yield();
+    if(_mod->micros() - start > timeout) {
+      _radio->finishTransmit();
+      return(RADIOLIB_ERR_TX_TIMEOUT);
+    }
+  }
+
+  return(_radio->finishTransmit());
+}
+
+int16_t SecureLinkClient::receiveFrame(uint8_t* frame, uint8_t* data, size_t* frameLen, uint32_t timeout) {
+  int16_t state = _radio->startReceive();
+  RADIOLIB_ASSERT(state);
+
+  // wait for the length byte
+  uint32_t start = _mod->millis();
+  while(!(_mod->SPIreadRegister(RADIOLIB_RF69_REG_IRQ_FLAGS_2) & RADIOLIB_RF69_IRQ_FIFO_NOT_EMPTY)) {
+    _mod->yield();
+    if(_mod->millis() - start > timeout) {
+      _radio->standby();
+      _radio->clearIRQFlags();
+      return(RADIOLIB_ERR_RX_TIMEOUT);
+    }
+  }
+  size_t length = _mod->SPIreadRegister(RADIOLIB_RF69_REG_FIFO);
+  *frameLen = length;
+
+  // short frames are read as a whole, header and MAC of long frames are kept apart from the payload
+  bool isLong = length > RADIOLIB_RF69_MAX_PACKET_LENGTH;
+  size_t macStart = length - RADIOLIB_SECURE_LINK_MAC_LEN;
+  size_t rcv = 0;
+  uint32_t frameTimeout = 5000 + (uint32_t)((((float)(length * 8)) / (_radio->_br * 1000.0)) * 5000000.0);
+  uint32_t frameStart = _mod->micros();
+  while(rcv < length) {
+    uint8_t flags = _mod->SPIreadRegister(RADIOLIB_RF69_REG_IRQ_FLAGS_2);
+    if(flags & RADIOLIB_RF69_IRQ_FIFO_OVERRUN) {
+      break;
+    }
+
+    // FifoLevel means there are more than threshold bytes in FIFO, PayloadReady means the rest of the packet is there
+    size_t num = 0;
+    if(flags & RADIOLIB_RF69_IRQ_PAYLOAD_READY) {
+      num = length - rcv;
+    } else if(flags & RADIOLIB_RF69_IRQ_FIFO_LEVEL) {
+      num = RADIOLIB_RF69_FIFO_THRESH;
+      if(num > length - rcv) {
+        num = length - rcv;
+      }
+    } else if(_mod->micros() - frameStart > frameTimeout) {
+      // packet was discarded by CRC check or the transmitter went silent
+      break;
+    }
+
+    while(num > 0) {
+      uint8_t* ptr = &frame[rcv];
+      size_t n = num;
+      if(isLong && (rcv >= macStart)) {
+        ptr = &frame[RADIOLIB_SECURE_LINK_HEADER_LEN + rcv - macStart];
+      } else if(isLong && (rcv >= RADIOLIB_SECURE_LINK_HEADER_LEN)) {
+        ptr = &data[rcv - RADIOLIB_SECURE_LINK_HEADER_LEN];
+        if(rcv + n > macStart) {
+          n = macStart - rcv;
+        }
+      } else if(isLong && (rcv + n > RADIOLIB_SECURE_LINK_HEADER_LEN)) {
+        n = RADIOLIB_SECURE_LINK_HEADER_LEN - rcv;
+      }
+      _mod->SPIreadRegisterBurst(RADIOLIB_RF69_REG_FIFO, n, ptr);
+      rcv += n;
+      num -= n;
+    }
+  }
+
+  // clearing the flags also flushes FIFO
+  _radio->standby();
+  _radio->clearIRQFlags();
+  if(rcv < length) {
+    return(RADIOLIB_ERR_CRC_MISMATCH);
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+int16_t SecureLinkClient::openShort(uint8_t* frame, size_t frameLen, uint8_t* data, size_t* len, uint8_t* peer) {
+  if((frameLen < RADIOLIB_SECURE_LINK_BLOCK_LEN) || (frameLen % RADIOLIB_SECURE_LINK_BLOCK_LEN != 0)) {
+    return(RADIOLIB_ERR_INVALID_PEER);
+  }
+
+  // source is encrypted, so try the first block with all keys until the header makes sense
+  uint8_t roundKeys[RADIOLIB_SECURE_LINK_AES_ROUND_KEYS_LEN];
+  uint8_t block[RADIOLIB_SECURE_LINK_BLOCK_LEN];
+  for(uint8_t i = 0; i < _numPeers; i++) {
+    SecureLinkPeer_t* p = &_peers[i];
+    for(uint8_t prev = 0; prev < 2; prev++) {
+      if(prev && !p->prevValid) {
+        continue;
+      }
+
+      expandKey(prev ? p->prevKey : p->key, roundKeys);
+      memcpy(block, frame, RADIOLIB_SECURE_LINK_BLOCK_LEN);
+      decryptBlock(roundKeys, block);
+
+      uint8_t dst = block[RADIOLIB_SECURE_LINK_HEADER_DST];
+      uint8_t keyId = prev ? p->keyId - 1 : p->keyId;
+      size_t payloadLen = block[RADIOLIB_SECURE_LINK_HEADER_LEN_FLAGS];
+      size_t padLen = ((RADIOLIB_SECURE_LINK_HEADER_LEN + payloadLen + RADIOLIB_SECURE_LINK_BLOCK_LEN - 1) / RADIOLIB_SECURE_LINK_BLOCK_LEN) * RADIOLIB_SECURE_LINK_BLOCK_LEN;
+      if((block[RADIOLIB_SECURE_LINK_HEADER_SRC] != p->addr) || ((dst != _addr) && (dst != RADIOLIB_SECURE_LINK_BROADCAST)) ||
+         (block[RADIOLIB_SECURE_LINK_HEADER_KEY_ID] != keyId) || (padLen != frameLen)) {
+        continue;
+      }
+
+      // header matches, decrypt the rest
+      memcpy(frame, block, RADIOLIB_SECURE_LINK_BLOCK_LEN);
+      for(size_t j = RADIOLIB_SECURE_LINK_BLOCK_LEN; j < frameLen; j += RADIOLIB_SECURE_LINK_BLOCK_LEN) {
+        decryptBlock(roundKeys, &frame[j]);
+      }
+      int16_t state = checkCounter(p, frame, prev);
+      RADIOLIB_ASSERT(state);
+
+      memcpy(data, &frame[RADIOLIB_SECURE_LINK_HEADER_LEN], payloadLen);
+      *len = payloadLen;
+      if(peer != NULL) {
+        *peer = i;
+      }
+      return(state);
+    }
+  }
+
+  return(RADIOLIB_ERR_INVALID_PEER);
+}
+
+int16_t SecureLinkClient::openLong(uint8_t* header, uint8_t* data, size_t len, uint8_t* peer) {
+  uint8_t dst = header[RADIOLIB_SECURE_LINK_HEADER_DST];
+  if((header[RADIOLIB_SECURE_LINK_HEADER_LEN_FLAGS] != RADIOLIB_SECURE_LINK_FLAG_CTR) || ((dst != _addr) && (dst != RADIOLIB_SECURE_LINK_BROADCAST))) {
+    return(RADIOLIB_ERR_INVALID_PEER);
+  }
+
+  // header is in plaintext, so the key can be looked up directly
+  for(uint8_t i = 0; i < _numPeers; i++) {
+    SecureLinkPeer_t* p = &_peers[i];
+    if(p->addr != header[RADIOLIB_SECURE_LINK_HEADER_SRC]) {
+      continue;
+    }
+
+    bool prev = false;
+    if(header[RADIOLIB_SECURE_LINK_HEADER_KEY_ID] != p->keyId) {
+      if(!p->prevValid || (header[RADIOLIB_SECURE_LINK_HEADER_KEY_ID] != (uint8_t)(p->keyId - 1))) {
+        return(RADIOLIB_ERR_UNKNOWN_KEY);
+      }
+      prev = true;
+    }
+
+    // header is only trusted once the MAC matches, replay state must not be changed by forged frames
+    uint8_t roundKeys[RADIOLIB_SECURE_LINK_AES_ROUND_KEYS_LEN];
+    uint8_t macRoundKeys[RADIOLIB_SECURE_LINK_AES_ROUND_KEYS_LEN];
+    expandKey(prev ? p->prevKey : p->key, roundKeys);
+    macKey(roundKeys, macRoundKeys);
+    uint8_t mac[RADIOLIB_SECURE_LINK_BLOCK_LEN] = { 0 };
+    size_t macPos = 0;
+    macUpdate(macRoundKeys, mac, &macPos, header, RADIOLIB_SECURE_LINK_HEADER_LEN);
+    macUpdate(macRoundKeys, mac, &macPos, data, len);
+    macFinish(macRoundKeys, mac, macPos);
+
+    // compare all bytes, so that the time taken does not depend on the position of the first mismatch
+    uint8_t diff = 0;
+    for(uint8_t j = 0; j < RADIOLIB_SECURE_LINK_MAC_LEN; j++) {
+      diff |= mac[j] ^ header[RADIOLIB_SECURE_LINK_HEADER_LEN + j];
+    }
+    if(diff != 0) {
+      return(RADIOLIB_ERR_MAC_MISMATCH);
+    }
+
+    int16_t state = checkCounter(p, header, prev);
+    RADIOLIB_ASSERT(state);
+
+    uint8_t keyStream[RADIOLIB_SECURE_LINK_BLOCK_LEN];
+    for(size_t j = 0; j < len; j++) {
+      if(j % RADIOLIB_SECURE_LINK_BLOCK_LEN == 0) {
+        counterBlock(header, j / RADIOLIB_SECURE_LINK_BLOCK_LEN, keyStream);
+        encryptBlock(roundKeys, keyStream);
+      }
+      data[j] ^= keyStream[j % RADIOLIB_SECURE_LINK_BLOCK_LEN];
+    }
+
+    if(peer != NULL) {
+      *peer = i;
+    }
+    return(state);
+  }
+
+  return(RADIOLIB_ERR_INVALID_PEER);
+}
+
+int16_t SecureLinkClient::checkCounter(SecureLinkPeer_t* p, uint8_t* header, bool prevKey) {
+  uint32_t counter = ((uint32_t)header[RADIOLIB_SECURE_LINK_HEADER_COUNTER] << 24) | ((uint32_t)header[RADIOLIB_SECURE_LINK_HEADER_COUNTER + 1] << 16) |
+                     ((uint32_t)header[RADIOLIB_SECURE_LINK_HEADER_COUNTER + 2] << 8) | (uint32_t)header[RADIOLIB_SECURE_LINK_HEADER_COUNTER + 3];
+  if((counter == 0) || (counter == p->rxCounter)) {
+    return(RADIOLIB_ERR_FRAME_REPLAYED);
+  }
+
+  if(counter > p->rxCounter) {
+    // slide the window, the previous highest counter becomes one of the older ones
+    uint32_t shift = counter - p->rxCounter;
+    if(shift > RADIOLIB_SECURE_LINK_REPLAY_WINDOW) {
+      p->rxWindow = 0;
+    } else {
+      p->rxWindow = (shift == RADIOLIB_SECURE_LINK_REPLAY_WINDOW) ? 0 : (p->rxWindow << shift);
+      p->rxWindow |= (uint32_t)1 << (shift - 1);
+    }
+    p->rxCounter = counter;
+
+  } else {
+    // older frame, only accepted when it is within the window and was not received yet
+    uint32_t age = p->rxCounter - counter;
+    if(age > RADIOLIB_SECURE_LINK_REPLAY_WINDOW) {
+      return(RADIOLIB_ERR_FRAME_REPLAYED);
+    }
+    uint32_t bit = (uint32_t)1 << (age - 1);
+    if(p->rxWindow & bit) {
+      return(RADIOLIB_ERR_FRAME_REPLAYED);
+    }
+    p->rxWindow |= bit;
+  }
+
+  // peer has switched to the current key, the previous one is no longer needed
+  if(!prevKey) {
+    p->prevValid = false;
+  }
+  return(RADIOLIB_ERR_NONE);
+}
+
+void SecureLinkClient::counterBlock(uint8_t* header, uint8_t index, uint8_t* block) {
+  memcpy(block, header, RADIOLIB_SECURE_LINK_HEADER_LEN);
+  memset(&block[RADIOLIB_SECURE_LINK_HEADER_LEN], 0x00, RADIOLIB_SECURE_LINK_BLOCK_LEN - RADIOLIB_SECURE_LINK_HEADER_LEN - 1);
+  block[RADIOLIB_SECURE_LINK_BLOCK_LEN - 1] = index;
+}
+
+void SecureLinkClient::macKey(uint8_t* roundKeys, uint8_t* macRoundKeys) {
+  // short frames and key stream only ever use encryption, so the inverse of a constant block is not available to an attacker
+  uint8_t key[RADIOLIB_SECURE_LINK_BLOCK_LEN] = { 0 };
+  decryptBlock(roundKeys, key);
+  expandKey(key, macRoundKeys);
+}
+
+void SecureLinkClient::macUpdate(uint8_t* roundKeys, uint8_t* mac, size_t* pos, uint8_t* data, size_t len) {
+  // CBC chaining, a full block is only encrypted once it is known not to be the last one
+  for(size_t i = 0; i < len; i++) {
+    if((*pos > 0) && (*pos % RADIOLIB_SECURE_LINK_BLOCK_LEN == 0)) {
+      encryptBlock(roundKeys, mac);
+    }
+    mac[*pos % RADIOLIB_SECURE_LINK_BLOCK_LEN] ^= data[i];
+    (*pos)++;
+  }
+}
+
+void SecureLinkClient::macFinish(uint8_t* roundKeys, uint8_t* mac, size_t pos) {
+  // subkeys K1 and K2 are derived from encrypted zero block (RFC 4493)
+  uint8_t subkey[RADIOLIB_SECURE_LINK_BLOCK_LEN] = { 0 };
+  encryptBlock(roundKeys, subkey);
+  macDouble(subkey);
+  if((pos == 0) || (pos % RADIOLIB_SECURE_LINK_BLOCK_LEN != 0)) {
+    // incomplete last block is padded with a single one bit followed by zeros
+    mac[pos % RADIOLIB_SECURE_LINK_BLOCK_LEN] ^= 0x80;
+    macDouble(subkey);
+  }
+
+  for(uint8_t i = 0; i < RADIOLIB_SECURE_LINK_BLOCK_LEN; i++) {
+    mac[i] ^= subkey[i];
+  }
+  encryptBlock(roundKeys, mac);
+}
+
+void SecureLinkClient::macDouble(uint8_t* block) {
+  // multiplication by x in GF(2^128)
+  uint8_t carry = block[0] & 0x80;
+  for(uint8_t i = 0; i < RADIOLIB_SECURE_LINK_BLOCK_LEN - 1; i++) {
+    block[i] = (block[i] << 1) | (block[i + 1] >> 7);
+  }
+  block[RADIOLIB_SECURE_LINK_BLOCK_LEN - 1] <<= 1;
+  if(carry) {
+    block[RADIOLIB_SECURE_LINK_BLOCK_LEN - 1] ^= 0x87;
+  }
+}
+
+void SecureLinkClient::expandKey(uint8_t* key, uint8_t* roundKeys) {
+  memcpy(roundKeys, key, RADIOLIB_SECURE_LINK_BLOCK_LEN);
+  uint8_t rcon = 0x01;
+  for(uint8_t i = RADIOLIB_SECURE_LINK_BLOCK_LEN; i < RADIOLIB_SECURE_LINK_AES_ROUND_KEYS_LEN; i += 4) {
+    uint8_t t[4];
+    memcpy(t, &roundKeys[i - 4], 4);
+    if(i % RADIOLIB_SECURE_LINK_BLOCK_LEN == 0) {
+      // rotate, substitute and add round constant
+      uint8_t tmp = t[0];
+      t[0] = RADIOLIB_NONVOLATILE_READ_BYTE(&SecureLinkSbox[t[1]]) ^ rcon;
+      t[1] = RADIOLIB_NONVOLATILE_READ_BYTE(&SecureLinkSbox[t[2]]);
+      t[2] = RADIOLIB_NONVOLATILE_READ_BYTE(&SecureLinkSbox[t[3]]);
+      t[3] = RADIOLIB_NONVOLATILE_READ_BYTE(&SecureLinkSbox[tmp]);
+      rcon = RADIOLIB_SECURE_LINK_XTIME(rcon);
+    }
+    for(uint8_t j = 0; j < 4; j++) {
+      roundKeys[i + j] = roundKeys[i + j - RADIOLIB_SECURE_LINK_BLOCK_LEN] ^ t[j];
+    }
+  }
+}
+
+void SecureLinkClient::encryptBlock(uint8_t* roundKeys, uint8_t* block) {
+  uint8_t tmp[RADIOLIB_SECURE_LINK_BLOCK_LEN];
+  for(uint8_t i = 0; i < RADIOLIB_SECURE_LINK_BLOCK_LEN; i++) {
+    block[i] ^= roundKeys[i];
+  }
+
+  for(uint8_t round = 1; round <= RADIOLIB_SECURE_LINK_AES_ROUNDS; round++) {
+    // SubBytes and ShiftRows, state is stored column by column
+    for(uint8_t i = 0; i < RADIOLIB_SECURE_LINK_BLOCK_LEN; i++) {
+      uint8_t row = i % 4;
+      uint8_t col = i / 4;
+      tmp[i] = RADIOLIB_NONVOLATILE_READ_BYTE(&SecureLinkSbox[block[row + 4*((col + row) % 4)]]);
+    }
+
+    // MixColumns, skipped in the last round
+    if(round < RADIOLIB_SECURE_LINK_AES_ROUNDS) {
+      for(uint8_t c = 0; c < RADIOLIB_SECURE_LINK_BLOCK_LEN; c += 4) {
+        uint8_t a0 = tmp[c];
+        uint8_t all = tmp[c] ^ tmp[c + 1] ^ tmp[c + 2] ^ tmp[c + 3];
+        tmp[c] ^= all ^ RADIOLIB_SECURE_LINK_XTIME(tmp[c] ^ tmp[c + 1]);
+        tmp[c + 1] ^= all ^ RADIOLIB_SECURE_LINK_XTIME(tmp[c + 1] ^ tmp[c + 2]);
+        tmp[c + 2] ^= all ^ RADIOLIB_SECURE_LINK_XTIME(tmp[c + 2] ^ tmp[c + 3]);
+        tmp[c + 3] ^= all ^ RADIOLIB_SECURE_LINK_XTIME(tmp[c + 3] ^ a0);
+      }
+    }
+
+    for(uint8_t i = 0; i < RADIOLIB_SECURE_LINK_BLOCK_LEN; i++) {
+      block[i] = tmp[i] ^ roundKeys[round*RADIOLIB_SECURE_LINK_BLOCK_LEN + i];
+    }
+  }
+}
+
+void SecureLinkClient::decryptBlock(uint8_t* roundKeys, uint8_t* block) {
+  uint8_t tmp[RADIOLIB_SECURE_LINK_BLOCK_LEN];
+  for(uint8_t i = 0; i < RADIOLIB_SECURE_LINK_BLOCK_LEN; i++) {
+    block[i] ^= roundKeys[RADIOLIB_SECURE_LINK_AES_ROUNDS*RADIOLIB_SECURE_LINK_BLOCK_LEN + i];
+  }
+
+  for(int8_t round = RADIOLIB_SECURE_LINK_AES_ROUNDS - 1; round >= 0; round--) {
+    // inverse ShiftRows and SubBytes
+    for(uint8_t i = 0; i < RADIOLIB_SECURE_LINK_BLOCK_LEN; i++) {
+      uint8_t row = i % 4;
+      uint8_t col = i / 4;
+      tmp[row + 4*((col + row) % 4)] = RADIOLIB_NONVOLATILE_READ_BYTE(&SecureLinkInvSbox[block[i]]);
+    }
+
+    for(uint8_t i = 0; i < RADIOLIB_SECURE_LINK_BLOCK_LEN; i++) {
+      tmp[i] ^= roundKeys[round*RADIOLIB_SECURE_LINK_BLOCK_LEN + i];
+    }
+
+    // inverse MixColumns, done as a preprocessing step followed by regular MixColumns
+    if(round > 0) {
+      for(uint8_t c = 0; c < RADIOLIB_SECURE_LINK_BLOCK_LEN; c += 4) {
+        uint8_t u = RADIOLIB_SECURE_LINK_XTIME(RADIOLIB_SECURE_LINK_XTIME(tmp[c] ^ tmp[c + 2]));
+        uint8_t v = RADIOLIB_SECURE_LINK_XTIME(RADIOLIB_SECURE_LINK_XTIME(tmp[c + 1] ^ tmp[c + 3]));
+        tmp[c] ^= u;
+        tmp[c + 1] ^= v;
+        tmp[c + 2] ^= u;
+        tmp[c + 3] ^= v;
+
+        uint8_t a0 = tmp[c];
+        uint8_t all = tmp[c] ^ tmp[c + 1] ^ tmp[c + 2] ^ tmp[c + 3];
+        tmp[c] ^= all ^ RADIOLIB_SECURE_LINK_XTIME(tmp[c] ^ tmp[c + 1]);
+        tmp[c + 1] ^= all ^ RADIOLIB_SECURE_LINK_XTIME(tmp[c + 1] ^ tmp[c + 2]);
+        tmp[c + 2] ^= all ^ RADIOLIB_SECURE_LINK_XTIME(tmp[c + 2] ^ tmp[c + 3]);
+        tmp[c + 3] ^= all ^ RADIOLIB_SECURE_LINK_XTIME(tmp[c + 3] ^ a0);
+      }
+    }
+
+    memcpy(block, tmp, RADIOLIB_SECURE_LINK_BLOCK_LEN);
+  }
+}
+
+#endif
@@ -0,0 +1,284 @@
+#if !defined(_RADIOLIB_SECURE_LINK_H)
+#define _RADIOLIB_SECURE_LINK_H
+
+#include "../../TypeDef.h"
+
+#if !defined(RADIOLIB_EXCLUDE_SECURE_LINK) && !defined(RADIOLIB_EXCLUDE_RF69)
+
+#include "../../modules/RF69/RF69.h"
+
+// maximum number of peers in the key table
+#if !defined(RADIOLIB_SECURE_LINK_MAX_PEERS)
+  #define RADIOLIB_SECURE_LINK_MAX_PEERS                        (4)
+#endif
+
+// frame layout
+#define RADIOLIB_SECURE_LINK_HEADER_LEN                         (8)
+#define RADIOLIB_SECURE_LINK_BLOCK_LEN                          (16)
+#define RADIOLIB_SECURE_LINK_MAX_FRAME_LENGTH                   (255)
+#define RADIOLIB_SECURE_LINK_MAX_SHORT_PAYLOAD_LENGTH           (RADIOLIB_RF69_MAX_PACKET_LENGTH - RADIOLIB_SECURE_LINK_HEADER_LEN)
+#define RADIOLIB_SECURE_LINK_MAC_LEN                            (8)
+#define RADIOLIB_SECURE_LINK_MAX_PAYLOAD_LENGTH                 (RADIOLIB_SECURE_LINK_MAX_FRAME_LENGTH - RADIOLIB_SECURE_LINK_HEADER_LEN - RADIOLIB_SECURE_LINK_MAC_LEN)
+
+// header fields
+#define RADIOLIB_SECURE_LINK_HEADER_SRC                         (0)
+#define RADIOLIB_SECURE_LINK_HEADER_DST                         (1)
+#define RADIOLIB_SECURE_LINK_HEADER_KEY_ID                      (2)
+#define RADIOLIB_SECURE_LINK_HEADER_COUNTER                     (3)
+#define RADIOLIB_SECURE_LINK_HEADER_LEN_FLAGS                   (7)
+
+// last header byte of long frames, keeps their counter blocks distinct from the first block of any short frame
+#define RADIOLIB_SECURE_LINK_FLAG_CTR                           (0x80)
+
+// destination address accepted by all nodes
+#define RADIOLIB_SECURE_LINK_BROADCAST                          (0xFF)
+
+// number of counter values below the highest one received that are still accepted
+#define RADIOLIB_SECURE_LINK_REPLAY_WINDOW                      (32)
+
+// number of FIFO bytes moved at once when streaming long frames
+#define RADIOLIB_SECURE_LINK_FIFO_CHUNK                         (RADIOLIB_RF69_FIFO_THRESH + 1)
+
+// AES-128 parameters
+#define RADIOLIB_SECURE_LINK_AES_ROUNDS                         (10)
+#define RADIOLIB_SECURE_LINK_AES_ROUND_KEYS_LEN                 (RADIOLIB_SECURE_LINK_BLOCK_LEN*(RADIOLIB_SECURE_LINK_AES_ROUNDS + 1))
+
+// multiplication by x in GF(2^8)
+#define RADIOLIB_SECURE_LINK_XTIME(x)                           ((uint8_t)(((x) << 1) ^ (((x) & 0x80) ? 0x1B : 0x00)))
+
+// AES S-box and its inverse
+static const uint8_t SecureLinkSbox[256] RADIOLIB_NONVOLATILE = {
+  0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+  0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+  0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+  0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+  0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+  0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+  0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+  0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+  0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+  0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+  0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+  0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+  0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+  0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+  0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+  0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
+};
+
+static const uint8_t SecureLinkInvSbox[256] RADIOLIB_NONVOLATILE = {
+  0x52, 0x09, 0x6A, 0xD5, 0x30, 0x36, 0xA5, 0x38, 0xBF, 0x40, 0xA3, 0x9E, 0x81, 0xF3, 0xD7, 0xFB,
+  0x7C, 0xE3, 0x39, 0x82, 0x9B, 0x2F, 0xFF, 0x87, 0x34, 0x8E, 0x43, 0x44, 0xC4, 0xDE, 0xE9, 0xCB,
+  0x54, 0x7B, 0x94, 0x32, 0xA6, 0xC2, 0x23, 0x3D, 0xEE, 0x4C, 0x95, 0x0B, 0x42, 0xFA, 0xC3, 0x4E,
+  0x08, 0x2E, 0xA1, 0x66, 0x28, 0xD9, 0x24, 0xB2, 0x76, 0x5B, 0xA2, 0x49, 0x6D, 0x8B, 0xD1, 0x25,
+  0x72, 0xF8, 0xF6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xD4, 0xA4, 0x5C, 0xCC, 0x5D, 0x65, 0xB6, 0x92,
+  0x6C, 0x70, 0x48, 0x50, 0xFD, 0xED, 0xB9, 0xDA, 0x5E, 0x15, 0x46, 0x57, 0xA7, 0x8D, 0x9D, 0x84,
+  0x90, 0xD8, 0xAB, 0x00, 0x8C, 0xBC, 0xD3, 0x0A, 0xF7, 0xE4, 0x58, 0x05, 0xB8, 0xB3, 0x45, 0x06,
+  0xD0, 0x2C, 0x1E, 0x8F, 0xCA, 0x3F, 0x0F, 0x02, 0xC1, 0xAF, 0xBD, 0x03, 0x01, 0x13, 0x8A, 0x6B,
+  0x3A, 0x91, 0x11, 0x41, 0x4F, 0x67, 0xDC, 0xEA, 0x97, 0xF2, 0xCF, 0xCE, 0xF0, 0xB4, 0xE6, 0x73,
+  0x96, 0xAC, 0x74, 0x22, 0xE7, 0xAD, 0x35, 0x85, 0xE2, 0xF9, 0x37, 0xE8, 0x1C, 0x75, 0xDF, 0x6E,
+  0x47, 0xF1, 0x1A, 0x71, 0x1D, 0x29, 0xC5, 0x89, 0x6F, 0xB7, 0x62, 0x0E, 0xAA, 0x18, 0xBE, 0x1B,
+  0xFC, 0x56, 0x3E, 0x4B, 0xC6, 0xD2, 0x79, 0x20, 0x9A, 0xDB, 0xC0, 0xFE, 0x78, 0xCD, 0x5A, 0xF4,
+  0x1F, 0xDD, 0xA8, 0x33, 0x88, 0x07, 0xC7, 0x31, 0xB1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xEC, 0x5F,
+  0x60, 0x51, 0x7F, 0xA9, 0x19, 0xB5, 0x4A, 0x0D, 0x2D, 0xE5, 0x7A, 0x9F, 0x93, 0xC9, 0x9C, 0xEF,
+  0xA0, 0xE0, 0x3B, 0x4D, 0xAE, 0x2A, 0xF5, 0xB0, 0xC8, 0xEB, 0xBB, 0x3C, 0x83, 0x53, 0x99, 0x61,
+  0x17, 0x2B, 0x04, 0x7E, 0xBA, 0x77, 0xD6, 0x26, 0xE1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0C, 0x7D
+};
+
+/*!
+  \struct SecureLinkPeer_t
+
+  \brief Key table entry of a single peer.
+*/
+struct SecureLinkPeer_t {
+  /*!
+    \brief Peer address.
+  */
+  uint8_t addr;
+
+  /*!
+    \brief Current key.
+  */
+  uint8_t key[16];
+
+  /*!
+    \brief Key used before the last rotation.
+  */
+  uint8_t prevKey[16];
+
+  /*!
+    \brief Identifier of the current key, incremented on every rotation.
+  */
+  uint8_t keyId;
+
+  /*!
+    \brief Whether the previous key is still accepted. Cleared once the peer sends a frame with the current key.
+  */
+  bool prevValid;
+
+  /*!
+    \brief Highest frame counter received from this peer.
+  */
+  uint32_t rxCounter;
+
+  /*!
+    \brief Counters received below rxCounter, bit n set means rxCounter - n - 1 was already received.
+  */
+  uint32_t rxWindow;
+};
+
+/*!
+  \class SecureLinkClient
+
+  \brief Encrypted link layer for %RF69 and SX1231 modules. Each frame carries source and destination address,
+  key identifier and a frame counter, which is checked against a sliding window to reject replayed frames.
+
+  Frames with up to 56 bytes of payload fit into a single 64-byte packet and are encrypted as a whole with AES-128 ECB,
+  using hardware AES of the radio. Longer frames (up to 239 bytes of payload) are streamed through the FIFO
+  with plaintext header and payload encrypted with AES-128 CTR in software, block by block as the FIFO drains.
+  Header and encrypted payload of long frames are authenticated by 8-byte AES-CMAC, which is checked before the frame counter.
+
+  Received frames are always decrypted in software, hardware AES can only use a single key and limits all received packets
+  to 64 bytes. Short frames are not authenticated: their header is protected by encryption of the first block only,
+  so replayed frames are rejected, but the following payload blocks can be modified or exchanged between frames without detection.
+  Short frames also leak equal 16-byte blocks beyond the first one, as a consequence of ECB mode.
+*/
+class SecureLinkClient {
+  public:
+    /*!
+      \brief Default constructor.
+
+      \param radio Pointer to the %RF69 module that will be used.
+    */
+    explicit SecureLinkClient(RF69* radio);
+
+    // basic methods
+
+    /*!
+      \brief Initialization method. Switches the radio to variable packet length mode with 255-byte limit and disables
+      address filtering and hardware decryption. Peer table is cleared.
+      Counter of the next transmitted frame must be restored by setTxCounter before calling this method.
+
+      \param addr Address of this node. Must not be 0xFF (broadcast).
+
+      \param hardwareAES Set to false to encrypt short frames in software as well.
+
+      \returns \ref status_codes
+    */
+    int16_t begin(uint8_t addr, bool hardwareAES = true);
+
+    /*!
+      \brief Adds peer to the key table.
+
+      \param addr Peer address. Frames to and from this node will use the provided key.
+
+      \param key AES-128 key shared with the peer, exactly 16 bytes long.
+
+      \returns Index of the peer, or \ref status_codes if the table is full.
+    */
+    int16_t addPeer(uint8_t addr, uint8_t* key);
+
+    /*!
+      \brief Replaces key of a peer. Frames sent with the previous key are still accepted until the peer
+      sends its first frame with the new key, so both sides do not have to rotate at the same time.
+      The receiving side should rotate first.
+
+      \param peer Index of the peer returned by addPeer.
+
+      \param key New AES-128 key, exactly 16 bytes long.
+
+      \returns \ref status_codes
+    */
+    int16_t rotateKey(uint8_t peer, uint8_t* key);
+
+    /*!
+      \brief Blocking encrypted transmit. Each call uses up one frame counter value, even if it fails.
+
+      \param peer Index of the peer returned by addPeer.
+
+      \param data Binary data to be sent.
+
+      \param len Number of bytes to send, up to 239 bytes.
+
+      \returns \ref status_codes
+    */
+    int16_t transmit(uint8_t peer, uint8_t* data, size_t len);
+
+    /*!
+      \brief Blocking encrypted receive. Frames addressed to other nodes or encrypted with unknown keys are skipped.
+
+      \param data Buffer to save the decrypted payload, must be at least 239 bytes long.
+
+      \param len Pointer to variable to save payload length.
+
+      \param peer Pointer to variable to save index of the sending peer. Can be NULL.
+
+      \param timeout Time to wait for a valid frame in ms.
+
+      \returns \ref status_codes
+    */
+    int16_t receive(uint8_t* data, size_t* len, uint8_t* peer, uint32_t timeout);
+
+    /*!
+      \brief Gets counter of the next transmitted frame.
+
+      \returns Frame counter.
+    */
+    uint32_t getTxCounter();
+
+    /*!
+      \brief Sets counter of the next transmitted frame. Required before begin, which refuses to start without it.
+      Counter is part of AES-CTR counter block and of the replay check, so it must never repeat with the same key:
+      reusing it repeats the key stream, and peers reject the frames as replayed. It has to be kept in non-volatile memory
+      and restored after every restart, starting from 1 on the very first start. To limit the number of writes, a block of counter values
+      can be reserved by saving its end and restoring from there, skipping values left unused before a restart.
+
+      \param counter Frame counter, must not be 0.
+    */
+    void setTxCounter(uint32_t counter);
+
+    /*!
+      \brief Gets identifier of the current key of a peer.
+
+      \param peer Index of the peer returned by addPeer.
+
+      \returns Key identifier.
+    */
+    uint8_t getKeyId(uint8_t peer);
+
+#if !defined(RADIOLIB_GODMODE)
+  private:
+#endif
+    RF69* _radio;
+    Module* _mod;
+
+    uint8_t _addr = 0;
+    bool _hardwareAES = true;
+    uint32_t _txCounter = 0;
+
+    SecureLinkPeer_t _peers[RADIOLIB_SECURE_LINK_MAX_PEERS];
+    uint8_t _numPeers = 0;
+
+    // peer whose key is currently loaded into hardware AES registers
+    int16_t _hwKeyPeer = -1;
+
+    int16_t transmitShort(uint8_t peer, uint8_t* header, uint8_t* data, size_t len);
+    int16_t transmitLong(uint8_t peer, uint8_t* header, uint8_t* data, size_t len);
+    int16_t receiveFrame(uint8_t* frame, uint8_t* data, size_t* frameLen, uint32_t timeout);
+    int16_t openShort(uint8_t* frame, size_t frameLen, uint8_t* data, size_t* len, uint8_t* peer);
+    int16_t openLong(uint8_t* header, uint8_t* data, size_t len, uint8_t* peer);
+    int16_t checkCounter(SecureLinkPeer_t* p, uint8_t* header, bool prevKey);
+
+    static void counterBlock(uint8_t* header, uint8_t index, uint8_t* block);
+    static void macKey(uint8_t* roundKeys, uint8_t* macRoundKeys);
+    static void macUpdate(uint8_t* roundKeys, uint8_t* mac, size_t* pos, uint8_t* data, size_t len);
+    static void macFinish(uint8_t* roundKeys, uint8_t* mac, size_t pos);
+    static void macDouble(uint8_t* block);
+    static void expandKey(uint8_t* key, uint8_t* roundKeys);
+    static void encryptBlock(uint8_t* roundKeys, uint8_t* block);
+    static void decryptBlock(uint8_t* roundKeys, uint8_t* block);
+};
+
+#endif
+
+#endif